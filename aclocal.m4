@@ -1029,5 +1029,6 @@ m4_include([m4/lt~obsolete.m4])
 m4_include([m4/nls.m4])
 m4_include([m4/po.m4])
 m4_include([m4/progtest.m4])
+m4_include([m4/pthread.m4])
 m4_include([m4/types.m4])
 m4_include([acinclude.m4])
@@ -0,0 +1,3415 @@
+/* 
+ * Apache Arrow IPC file writer
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "arrow_writer.h"
+
+/* The values of the Arrow columnar format flatbuffers schema (Schema.fbs and Message.fbs)
+ */
+#define ARROW_WRITER_METADATA_VERSION_V5		4
+
+#define ARROW_WRITER_MESSAGE_HEADER_SCHEMA		1
+#define ARROW_WRITER_MESSAGE_HEADER_DICTIONARY_BATCH	2
+#define ARROW_WRITER_MESSAGE_HEADER_RECORD_BATCH	3
+
+#define ARROW_WRITER_TYPE_INT				2
+#define ARROW_WRITER_TYPE_FLOATING_POINT		3
+#define ARROW_WRITER_TYPE_BINARY			4
+#define ARROW_WRITER_TYPE_UTF8				5
+#define ARROW_WRITER_TYPE_BOOL				6
+#define ARROW_WRITER_TYPE_TIMESTAMP			10
+
+#define ARROW_WRITER_PRECISION_SINGLE			1
+#define ARROW_WRITER_PRECISION_DOUBLE			2
+
+#define ARROW_WRITER_TIME_UNIT_MICROSECOND		2
+
+/* The size of an encoded Block structure
+ */
+#define ARROW_WRITER_BLOCK_SIZE				24
+
+/* The maximum number of buffers of a column in a record batch
+ */
+#define ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMN_BUFFERS	3
+
+/* Determines the size of a bitmap of a specific number of bits
+ */
+#define arrow_writer_bitmap_size( number_of_bits ) \
+	( ( (size_t) ( number_of_bits ) + 7 ) / 8 )
+
+/* Aligns a size to a multiple of 8
+ */
+#define arrow_writer_align_size( size ) \
+	( ( (size_t) ( size ) + 7 ) & ~( (size_t) 7 ) )
+
+static const uint8_t arrow_writer_file_signature[ 8 ] = {
+	'A', 'R', 'R', 'O', 'W', '1', 0, 0 };
+
+static const uint8_t arrow_writer_padding[ 8 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0 };
+
+/* Resizes an array so that it contains at least the required size
+ * The array grows at least twofold and its contents are preserved
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_resize_array(
+            uint8_t **array,
+            size_t *array_size,
+            size_t required_size,
+            liberror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "arrow_writer_resize_array";
+	size_t new_size       = 0;
+
+	if( required_size <= *array_size )
+	{
+		return( 1 );
+	}
+	if( required_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	new_size = *array_size * 2;
+
+	if( new_size < 256 )
+	{
+		new_size = 256;
+	}
+	if( ( new_size < required_size )
+	 || ( new_size > (size_t) SSIZE_MAX ) )
+	{
+		new_size = required_size;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            *array,
+	                            sizeof( uint8_t ) * new_size );
+
+	if( reallocation == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize array.",
+		 function );
+
+		return( -1 );
+	}
+	*array      = reallocation;
+	*array_size = new_size;
+
+	return( 1 );
+}
+
+/* Appends zero bytes to the metadata
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_append(
+            arrow_writer_t *writer,
+            size_t size,
+            size_t *offset,
+            liberror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_append";
+
+	if( arrow_writer_resize_array(
+	     &( writer->metadata ),
+	     &( writer->metadata_allocated_size ),
+	     writer->metadata_size + size,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( writer->metadata[ writer->metadata_size ] ),
+	     0,
+	     size ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset != NULL )
+	{
+		*offset = writer->metadata_size;
+	}
+	writer->metadata_size += size;
+
+	return( 1 );
+}
+
+/* Aligns the end of the metadata to a specific alignment
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_align(
+            arrow_writer_t *writer,
+            size_t alignment,
+            liberror_error_t **error )
+{
+	size_t remainder = writer->metadata_size % alignment;
+
+	if( remainder == 0 )
+	{
+		return( 1 );
+	}
+	return( arrow_writer_metadata_append(
+	         writer,
+	         alignment - remainder,
+	         NULL,
+	         error ) );
+}
+
+/* Sets an offset in the metadata that refers to a subsequent object
+ * The offset is relative to the offset of the field
+ */
+static void arrow_writer_metadata_set_offset(
+             arrow_writer_t *writer,
+             size_t field_offset,
+             size_t target_offset )
+{
+	byte_stream_copy_from_uint32_little_endian(
+	 &( writer->metadata[ field_offset ] ),
+	 (uint32_t) ( target_offset - field_offset ) );
+}
+
+/* Appends a flatbuffer table with its vtable to the metadata
+ * The field sizes contain the size of every field or 0 if the field is not present
+ * The offsets of the fields are returned in field offsets
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_add_table(
+            arrow_writer_t *writer,
+            int number_of_fields,
+            const uint8_t *field_sizes,
+            size_t *field_offsets,
+            size_t *table_offset,
+            liberror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_add_table";
+	size_t field_position = 4;
+	size_t table_size     = 0;
+	size_t vtable_offset  = 0;
+	size_t vtable_size    = 0;
+	int field_index       = 0;
+
+	vtable_size = 4 + ( 2 * (size_t) number_of_fields );
+
+	if( arrow_writer_metadata_align(
+	     writer,
+	     2,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_metadata_append(
+	     writer,
+	     vtable_size,
+	     &vtable_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The table is 8 byte aligned so that the fields are naturally aligned
+	 */
+	if( arrow_writer_metadata_align(
+	     writer,
+	     8,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*table_offset = writer->metadata_size;
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		if( field_sizes[ field_index ] == 0 )
+		{
+			field_offsets[ field_index ] = 0;
+
+			continue;
+		}
+		field_position = ( field_position + field_sizes[ field_index ] - 1 )
+		               & ~( (size_t) field_sizes[ field_index ] - 1 );
+
+		field_offsets[ field_index ] = *table_offset + field_position;
+		field_position              += field_sizes[ field_index ];
+	}
+	table_size = ( field_position + 3 ) & ~( (size_t) 3 );
+
+	if( arrow_writer_metadata_append(
+	     writer,
+	     table_size,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( writer->metadata[ vtable_offset ] ),
+	 (uint16_t) vtable_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( writer->metadata[ vtable_offset + 2 ] ),
+	 (uint16_t) table_size );
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		if( field_sizes[ field_index ] != 0 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( writer->metadata[ vtable_offset + 4 + ( 2 * field_index ) ] ),
+			 (uint16_t) ( field_offsets[ field_index ] - *table_offset ) );
+		}
+	}
+	/* The vtable precedes the table
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( writer->metadata[ *table_offset ] ),
+	 (uint32_t) ( *table_offset - vtable_offset ) );
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append table.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends a flatbuffer string to the metadata
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_add_string(
+            arrow_writer_t *writer,
+            const uint8_t *string,
+            size_t string_length,
+            size_t *string_offset,
+            liberror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_add_string";
+
+	if( arrow_writer_metadata_align(
+	     writer,
+	     4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The string is stored with a 32-bit length and an end of string character
+	 */
+	if( arrow_writer_metadata_append(
+	     writer,
+	     4 + string_length + 1,
+	     string_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( writer->metadata[ *string_offset ] ),
+	 (uint32_t) string_length );
+
+	if( string_length > 0 )
+	{
+		if( memory_copy(
+		     &( writer->metadata[ *string_offset + 4 ] ),
+		     string,
+		     string_length ) == NULL )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends a flatbuffer vector to the metadata
+ * The elements are cleared and start at vector offset + 4
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_add_vector(
+            arrow_writer_t *writer,
+            int number_of_elements,
+            size_t element_size,
+            size_t *vector_offset,
+            liberror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_add_vector";
+
+	if( arrow_writer_metadata_align(
+	     writer,
+	     4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Structures with 64-bit values require the elements to be 8 byte aligned
+	 */
+	if( ( ( element_size % 8 ) == 0 )
+	 && ( ( writer->metadata_size % 8 ) == 0 ) )
+	{
+		if( arrow_writer_metadata_append(
+		     writer,
+		     4,
+		     NULL,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( arrow_writer_metadata_append(
+	     writer,
+	     4 + ( element_size * (size_t) number_of_elements ),
+	     vector_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( writer->metadata[ *vector_offset ] ),
+	 (uint32_t) number_of_elements );
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append vector.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends an Int type table to the metadata
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_add_int_type(
+            arrow_writer_t *writer,
+            uint32_t bit_width,
+            uint8_t is_signed,
+            size_t *table_offset,
+            liberror_error_t **error )
+{
+	static const uint8_t field_sizes[ 2 ] = { 4, 1 };
+
+	size_t field_offsets[ 2 ];
+
+	static char *function = "arrow_writer_metadata_add_int_type";
+
+	if( arrow_writer_metadata_add_table(
+	     writer,
+	     2,
+	     field_sizes,
+	     field_offsets,
+	     table_offset,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append Int table.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( writer->metadata[ field_offsets[ 0 ] ] ),
+	 bit_width );
+
+	writer->metadata[ field_offsets[ 1 ] ] = is_signed;
+
+	return( 1 );
+}
+
+/* Appends the type table of a column to the metadata
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_add_type(
+            arrow_writer_t *writer,
+            arrow_writer_column_t *column,
+            uint8_t *type_type,
+            size_t *table_offset,
+            liberror_error_t **error )
+{
+	static const uint8_t floating_point_field_sizes[ 1 ] = { 2 };
+	static const uint8_t timestamp_field_sizes[ 2 ]      = { 2, 4 };
+
+	size_t field_offsets[ 2 ];
+
+	static char *function = "arrow_writer_metadata_add_type";
+	size_t string_offset  = 0;
+	uint32_t bit_width    = 0;
+	uint8_t is_signed     = 0;
+	int result            = 0;
+
+	switch( column->type )
+	{
+		case ARROW_WRITER_COLUMN_TYPE_BINARY:
+		case ARROW_WRITER_COLUMN_TYPE_BOOLEAN:
+		case ARROW_WRITER_COLUMN_TYPE_STRING:
+			if( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+			{
+				*type_type = ARROW_WRITER_TYPE_BINARY;
+			}
+			else if( column->type == ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+			{
+				*type_type = ARROW_WRITER_TYPE_BOOL;
+			}
+			else
+			{
+				*type_type = ARROW_WRITER_TYPE_UTF8;
+			}
+			result = arrow_writer_metadata_add_table(
+			          writer,
+			          0,
+			          NULL,
+			          NULL,
+			          table_offset,
+			          error );
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_FLOAT_32BIT:
+		case ARROW_WRITER_COLUMN_TYPE_FLOAT_64BIT:
+			*type_type = ARROW_WRITER_TYPE_FLOATING_POINT;
+
+			result = arrow_writer_metadata_add_table(
+			          writer,
+			          1,
+			          floating_point_field_sizes,
+			          field_offsets,
+			          table_offset,
+			          error );
+
+			if( result == 1 )
+			{
+				if( column->type == ARROW_WRITER_COLUMN_TYPE_FLOAT_32BIT )
+				{
+					byte_stream_copy_from_uint16_little_endian(
+					 &( writer->metadata[ field_offsets[ 0 ] ] ),
+					 ARROW_WRITER_PRECISION_SINGLE );
+				}
+				else
+				{
+					byte_stream_copy_from_uint16_little_endian(
+					 &( writer->metadata[ field_offsets[ 0 ] ] ),
+					 ARROW_WRITER_PRECISION_DOUBLE );
+				}
+			}
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_TIMESTAMP:
+			*type_type = ARROW_WRITER_TYPE_TIMESTAMP;
+
+			result = arrow_writer_metadata_add_table(
+			          writer,
+			          2,
+			          timestamp_field_sizes,
+			          field_offsets,
+			          table_offset,
+			          error );
+
+			if( result == 1 )
+			{
+				byte_stream_copy_from_uint16_little_endian(
+				 &( writer->metadata[ field_offsets[ 0 ] ] ),
+				 ARROW_WRITER_TIME_UNIT_MICROSECOND );
+
+				result = arrow_writer_metadata_add_string(
+				          writer,
+				          (uint8_t *) "UTC",
+				          3,
+				          &string_offset,
+				          error );
+			}
+			if( result == 1 )
+			{
+				arrow_writer_metadata_set_offset(
+				 writer,
+				 field_offsets[ 1 ],
+				 string_offset );
+			}
+			break;
+
+		default:
+			*type_type = ARROW_WRITER_TYPE_INT;
+			bit_width  = (uint32_t) column->value_size * 8;
+
+			if( ( column->type == ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+			 || ( column->type == ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+			 || ( column->type == ARROW_WRITER_COLUMN_TYPE_INTEGER_64BIT_SIGNED ) )
+			{
+				is_signed = 1;
+			}
+			result = arrow_writer_metadata_add_int_type(
+			          writer,
+			          bit_width,
+			          is_signed,
+			          table_offset,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append type table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the field table of a column to the metadata
+ * String columns are dictionary encoded with 32-bit signed indexes
+ * and use the column index as dictionary identifier
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_add_field(
+            arrow_writer_t *writer,
+            int column_index,
+            size_t *table_offset,
+            liberror_error_t **error )
+{
+	uint8_t field_sizes[ 6 ]                        = { 4, 1, 1, 4, 4, 4 };
+	static const uint8_t dictionary_field_sizes[ 3 ] = { 8, 4, 1 };
+
+	size_t dictionary_field_offsets[ 3 ];
+	size_t field_offsets[ 6 ];
+
+	arrow_writer_column_t *column   = NULL;
+	static char *function           = "arrow_writer_metadata_add_field";
+	size_t dictionary_offset        = 0;
+	size_t index_type_offset        = 0;
+	size_t name_offset              = 0;
+	size_t type_offset              = 0;
+	size_t vector_offset            = 0;
+	uint8_t type_type               = 0;
+
+	column = &( writer->columns[ column_index ] );
+
+	if( column->type != ARROW_WRITER_COLUMN_TYPE_STRING )
+	{
+		field_sizes[ 4 ] = 0;
+	}
+	if( arrow_writer_metadata_add_table(
+	     writer,
+	     6,
+	     field_sizes,
+	     field_offsets,
+	     table_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* All fields are nullable
+	 */
+	writer->metadata[ field_offsets[ 1 ] ] = 1;
+
+	if( arrow_writer_metadata_add_string(
+	     writer,
+	     column->name,
+	     column->name_size,
+	     &name_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 field_offsets[ 0 ],
+	 name_offset );
+
+	if( arrow_writer_metadata_add_type(
+	     writer,
+	     column,
+	     &type_type,
+	     &type_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	writer->metadata[ field_offsets[ 2 ] ] = type_type;
+
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 field_offsets[ 3 ],
+	 type_offset );
+
+	if( column->type == ARROW_WRITER_COLUMN_TYPE_STRING )
+	{
+		if( arrow_writer_metadata_add_table(
+		     writer,
+		     3,
+		     dictionary_field_sizes,
+		     dictionary_field_offsets,
+		     &dictionary_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( writer->metadata[ dictionary_field_offsets[ 0 ] ] ),
+		 (uint64_t) column_index );
+
+		arrow_writer_metadata_set_offset(
+		 writer,
+		 field_offsets[ 4 ],
+		 dictionary_offset );
+
+		if( arrow_writer_metadata_add_int_type(
+		     writer,
+		     32,
+		     1,
+		     &index_type_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		arrow_writer_metadata_set_offset(
+		 writer,
+		 dictionary_field_offsets[ 1 ],
+		 index_type_offset );
+	}
+	/* The children vector is required even if empty
+	 */
+	if( arrow_writer_metadata_add_vector(
+	     writer,
+	     0,
+	     4,
+	     &vector_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 field_offsets[ 5 ],
+	 vector_offset );
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append field: %d.",
+	 function,
+	 column_index );
+
+	return( -1 );
+}
+
+/* Appends the schema table to the metadata
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_add_schema(
+            arrow_writer_t *writer,
+            size_t *table_offset,
+            liberror_error_t **error )
+{
+	static const uint8_t field_sizes[ 2 ] = { 2, 4 };
+
+	size_t field_offsets[ 2 ];
+
+	static char *function = "arrow_writer_metadata_add_schema";
+	size_t field_offset   = 0;
+	size_t vector_offset  = 0;
+	int column_index      = 0;
+
+	if( arrow_writer_metadata_add_table(
+	     writer,
+	     2,
+	     field_sizes,
+	     field_offsets,
+	     table_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The endianness is little-endian (0)
+	 */
+	if( arrow_writer_metadata_add_vector(
+	     writer,
+	     writer->number_of_columns,
+	     4,
+	     &vector_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 field_offsets[ 1 ],
+	 vector_offset );
+
+	for( column_index = 0;
+	     column_index < writer->number_of_columns;
+	     column_index++ )
+	{
+		if( arrow_writer_metadata_add_field(
+		     writer,
+		     column_index,
+		     &field_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		arrow_writer_metadata_set_offset(
+		 writer,
+		 vector_offset + 4 + ( 4 * (size_t) column_index ),
+		 field_offset );
+	}
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append schema.",
+	 function );
+
+	return( -1 );
+}
+
+/* Starts the metadata of a message
+ * The header table is created by the caller and set at header offset
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_metadata_start_message(
+            arrow_writer_t *writer,
+            uint8_t header_type,
+            uint64_t body_length,
+            size_t *header_offset,
+            liberror_error_t **error )
+{
+	static const uint8_t field_sizes[ 4 ] = { 2, 1, 4, 8 };
+
+	size_t field_offsets[ 4 ];
+
+	static char *function = "arrow_writer_metadata_start_message";
+	size_t table_offset   = 0;
+
+	writer->metadata_size = 0;
+
+	/* The root table offset
+	 */
+	if( arrow_writer_metadata_append(
+	     writer,
+	     8,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_metadata_add_table(
+	     writer,
+	     4,
+	     field_sizes,
+	     field_offsets,
+	     &table_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 0,
+	 table_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( writer->metadata[ field_offsets[ 0 ] ] ),
+	 ARROW_WRITER_METADATA_VERSION_V5 );
+
+	writer->metadata[ field_offsets[ 1 ] ] = header_type;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( writer->metadata[ field_offsets[ 3 ] ] ),
+	 body_length );
+
+	*header_offset = field_offsets[ 2 ];
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append message.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes data to the file stream
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_write_data(
+            arrow_writer_t *writer,
+            const uint8_t *data,
+            size_t data_size,
+            liberror_error_t **error )
+{
+	static char *function = "arrow_writer_write_data";
+
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( file_stream_write(
+	     writer->stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	writer->stream_offset += data_size;
+
+	return( 1 );
+}
+
+/* Writes the metadata as an encapsulated message followed by the body buffers
+ * The block of the message is stored in block data
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_write_message(
+            arrow_writer_t *writer,
+            int number_of_body_buffers,
+            uint64_t body_length,
+            uint8_t *block_data,
+            liberror_error_t **error )
+{
+	uint8_t message_prefix[ 8 ];
+
+	static char *function = "arrow_writer_write_message";
+	size_t padding_size   = 0;
+	int buffer_index      = 0;
+
+	/* The prefix and the metadata are padded to a multiple of 8
+	 */
+	if( arrow_writer_metadata_align(
+	     writer,
+	     8,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to align metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data != NULL )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 block_data,
+		 writer->stream_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( block_data[ 8 ] ),
+		 (uint32_t) ( 8 + writer->metadata_size ) );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( block_data[ 12 ] ),
+		 0 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( block_data[ 16 ] ),
+		 body_length );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 message_prefix,
+	 0xffffffffUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( message_prefix[ 4 ] ),
+	 (uint32_t) writer->metadata_size );
+
+	if( arrow_writer_write_data(
+	     writer,
+	     message_prefix,
+	     8,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_write_data(
+	     writer,
+	     writer->metadata,
+	     writer->metadata_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_body_buffers;
+	     buffer_index++ )
+	{
+		if( arrow_writer_write_data(
+		     writer,
+		     writer->body_buffers[ buffer_index ],
+		     writer->body_buffer_sizes[ buffer_index ],
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		padding_size = arrow_writer_align_size(
+		                writer->body_buffer_sizes[ buffer_index ] )
+		             - writer->body_buffer_sizes[ buffer_index ];
+
+		if( arrow_writer_write_data(
+		     writer,
+		     arrow_writer_padding,
+		     padding_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_IO,
+	 LIBERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write message.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes a record batch or dictionary batch message
+ * The body buffers, body buffer sizes and node null counts must be set by the caller
+ * A dictionary identifier of -1 indicates a record batch
+ * The block of the message is appended to blocks
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_write_batch(
+            arrow_writer_t *writer,
+            int64_t dictionary_identifier,
+            uint8_t is_delta,
+            int64_t number_of_rows,
+            int number_of_nodes,
+            int number_of_buffers,
+            uint8_t **blocks,
+            int *number_of_blocks,
+            size_t *blocks_allocated_size,
+            liberror_error_t **error )
+{
+	static const uint8_t dictionary_batch_field_sizes[ 3 ] = { 8, 4, 1 };
+	static const uint8_t record_batch_field_sizes[ 3 ]     = { 8, 4, 4 };
+
+	size_t dictionary_batch_field_offsets[ 3 ];
+	size_t record_batch_field_offsets[ 3 ];
+
+	static char *function        = "arrow_writer_write_batch";
+	size_t block_offset          = 0;
+	size_t buffers_offset        = 0;
+	size_t dictionary_offset     = 0;
+	size_t header_offset         = 0;
+	size_t nodes_offset          = 0;
+	size_t record_batch_offset   = 0;
+	uint64_t body_length         = 0;
+	int buffer_index             = 0;
+	int node_index               = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		body_length += arrow_writer_align_size(
+		                writer->body_buffer_sizes[ buffer_index ] );
+	}
+	if( dictionary_identifier >= 0 )
+	{
+		if( arrow_writer_metadata_start_message(
+		     writer,
+		     ARROW_WRITER_MESSAGE_HEADER_DICTIONARY_BATCH,
+		     body_length,
+		     &header_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( arrow_writer_metadata_add_table(
+		     writer,
+		     3,
+		     dictionary_batch_field_sizes,
+		     dictionary_batch_field_offsets,
+		     &dictionary_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		arrow_writer_metadata_set_offset(
+		 writer,
+		 header_offset,
+		 dictionary_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( writer->metadata[ dictionary_batch_field_offsets[ 0 ] ] ),
+		 (uint64_t) dictionary_identifier );
+
+		writer->metadata[ dictionary_batch_field_offsets[ 2 ] ] = is_delta;
+
+		header_offset = dictionary_batch_field_offsets[ 1 ];
+	}
+	else
+	{
+		if( arrow_writer_metadata_start_message(
+		     writer,
+		     ARROW_WRITER_MESSAGE_HEADER_RECORD_BATCH,
+		     body_length,
+		     &header_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( arrow_writer_metadata_add_table(
+	     writer,
+	     3,
+	     record_batch_field_sizes,
+	     record_batch_field_offsets,
+	     &record_batch_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 header_offset,
+	 record_batch_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( writer->metadata[ record_batch_field_offsets[ 0 ] ] ),
+	 (uint64_t) number_of_rows );
+
+	/* The field nodes and buffers are vectors of 16 byte structures
+	 */
+	if( arrow_writer_metadata_add_vector(
+	     writer,
+	     number_of_nodes,
+	     16,
+	     &nodes_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 record_batch_field_offsets[ 1 ],
+	 nodes_offset );
+
+	if( arrow_writer_metadata_add_vector(
+	     writer,
+	     number_of_buffers,
+	     16,
+	     &buffers_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 record_batch_field_offsets[ 2 ],
+	 buffers_offset );
+
+	for( node_index = 0;
+	     node_index < number_of_nodes;
+	     node_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( writer->metadata[ nodes_offset + 4 + ( 16 * (size_t) node_index ) ] ),
+		 (uint64_t) number_of_rows );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( writer->metadata[ nodes_offset + 12 + ( 16 * (size_t) node_index ) ] ),
+		 (uint64_t) writer->node_null_counts[ node_index ] );
+	}
+	body_length = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( writer->metadata[ buffers_offset + 4 + ( 16 * (size_t) buffer_index ) ] ),
+		 body_length );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( writer->metadata[ buffers_offset + 12 + ( 16 * (size_t) buffer_index ) ] ),
+		 (uint64_t) writer->body_buffer_sizes[ buffer_index ] );
+
+		body_length += arrow_writer_align_size(
+		                writer->body_buffer_sizes[ buffer_index ] );
+	}
+	block_offset = (size_t) *number_of_blocks * ARROW_WRITER_BLOCK_SIZE;
+
+	if( arrow_writer_resize_array(
+	     blocks,
+	     blocks_allocated_size,
+	     block_offset + ARROW_WRITER_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_write_message(
+	     writer,
+	     number_of_buffers,
+	     body_length,
+	     &( ( *blocks )[ block_offset ] ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*number_of_blocks += 1;
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_IO,
+	 LIBERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write batch.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the dictionary batches of the string columns
+ * Only the dictionary entries added since the previous dictionary batch are written
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_write_dictionary_batches(
+            arrow_writer_t *writer,
+            liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_write_dictionary_batches";
+	uint32_t data_offset          = 0;
+	uint32_t end_entry_index      = 0;
+	uint32_t entry_index          = 0;
+	uint32_t entry_offset         = 0;
+	uint32_t first_entry_index    = 0;
+	uint32_t number_of_entries    = 0;
+	int column_index              = 0;
+
+	for( column_index = 0;
+	     column_index < writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( writer->columns[ column_index ] );
+
+		if( column->type != ARROW_WRITER_COLUMN_TYPE_STRING )
+		{
+			continue;
+		}
+		end_entry_index = column->dictionary_base_index
+		                + column->number_of_dictionary_entries;
+
+		if( ( column->dictionary_batch_written != 0 )
+		 && ( end_entry_index == column->number_of_written_dictionary_entries ) )
+		{
+			continue;
+		}
+		first_entry_index = column->number_of_written_dictionary_entries
+		                  - column->dictionary_base_index;
+		number_of_entries = end_entry_index
+		                  - column->number_of_written_dictionary_entries;
+
+		if( arrow_writer_resize_array(
+		     &( writer->dictionary_batch_offsets ),
+		     &( writer->dictionary_batch_offsets_allocated_size ),
+		     ( (size_t) number_of_entries + 1 ) * 4,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize dictionary batch offsets.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( column->dictionary_offsets[ first_entry_index * 4 ] ),
+		 data_offset );
+
+		/* The offsets of the dictionary batch start at 0
+		 */
+		for( entry_index = 0;
+		     entry_index <= number_of_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( column->dictionary_offsets[ ( first_entry_index + entry_index ) * 4 ] ),
+			 entry_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( writer->dictionary_batch_offsets[ entry_index * 4 ] ),
+			 entry_offset - data_offset );
+		}
+		writer->body_buffers[ 0 ]      = NULL;
+		writer->body_buffer_sizes[ 0 ] = 0;
+		writer->body_buffers[ 1 ]      = writer->dictionary_batch_offsets;
+		writer->body_buffer_sizes[ 1 ] = ( (size_t) number_of_entries + 1 ) * 4;
+		writer->body_buffers[ 2 ]      = &( column->dictionary_data[ data_offset ] );
+		writer->body_buffer_sizes[ 2 ] = (size_t) ( entry_offset - data_offset );
+		writer->node_null_counts[ 0 ]  = 0;
+
+		if( arrow_writer_write_batch(
+		     writer,
+		     (int64_t) column_index,
+		     column->dictionary_batch_written,
+		     (int64_t) number_of_entries,
+		     1,
+		     3,
+		     &( writer->dictionary_blocks ),
+		     &( writer->number_of_dictionary_blocks ),
+		     &( writer->dictionary_blocks_allocated_size ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write dictionary batch of column: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		column->number_of_written_dictionary_entries = end_entry_index;
+		column->dictionary_batch_written             = 1;
+
+		/* Once the retained dictionary becomes too large subsequent strings
+		 * are added as new entries, which bounds the memory usage
+		 */
+		if( column->dictionary_data_size > ARROW_WRITER_MAXIMUM_RETAINED_DICTIONARY_DATA_SIZE )
+		{
+			column->dictionary_base_index        = end_entry_index;
+			column->number_of_dictionary_entries = 0;
+			column->dictionary_data_size         = 0;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 column->dictionary_offsets,
+			 0 );
+
+			if( column->dictionary_hash_table != NULL )
+			{
+				if( memory_set(
+				     column->dictionary_hash_table,
+				     0,
+				     sizeof( uint32_t ) * column->dictionary_hash_table_size ) == NULL )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_MEMORY,
+					 LIBERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear dictionary hash table.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the current record batch preceded by the dictionary batches it depends on
+ * Only the complete rows are written, the values already appended to the current row
+ * are moved to the first row of the next record batch
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_write_record_batch(
+            arrow_writer_t *writer,
+            liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_write_record_batch";
+	size_t bitmap_size            = 0;
+	size_t copy_size              = 0;
+	size_t row_data_offset        = 0;
+	size_t row_data_size          = 0;
+	uint32_t value_data_offset    = 0;
+	uint8_t row_is_valid          = 0;
+	uint8_t row_value             = 0;
+	int buffer_index              = 0;
+	int column_index              = 0;
+	int row_index                 = 0;
+
+	if( arrow_writer_write_dictionary_batches(
+	     writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	bitmap_size = arrow_writer_bitmap_size(
+	               writer->number_of_rows );
+
+	for( column_index = 0;
+	     column_index < writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( writer->columns[ column_index ] );
+
+		writer->node_null_counts[ column_index ] = (int64_t) column->number_of_null_values;
+
+		/* A null value appended to the current row is not part of the record batch
+		 */
+		if( ( column->number_of_values > writer->number_of_rows )
+		 && ( ( column->validity_bitmap[ writer->number_of_rows / 8 ] & ( 1 << ( writer->number_of_rows % 8 ) ) ) == 0 ) )
+		{
+			writer->node_null_counts[ column_index ] -= 1;
+		}
+
+		/* The validity bitmap can be omitted if all values are set
+		 */
+		writer->body_buffers[ buffer_index ] = column->validity_bitmap;
+
+		if( writer->node_null_counts[ column_index ] == 0 )
+		{
+			writer->body_buffer_sizes[ buffer_index++ ] = 0;
+		}
+		else
+		{
+			writer->body_buffer_sizes[ buffer_index++ ] = bitmap_size;
+		}
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( column->value_offsets[ writer->number_of_rows * 4 ] ),
+			 value_data_offset );
+
+			writer->body_buffers[ buffer_index ]        = column->value_offsets;
+			writer->body_buffer_sizes[ buffer_index++ ] = ( (size_t) writer->number_of_rows + 1 ) * 4;
+			writer->body_buffers[ buffer_index ]        = column->value_data;
+			writer->body_buffer_sizes[ buffer_index++ ] = (size_t) value_data_offset;
+		}
+		else if( column->type == ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+		{
+			writer->body_buffers[ buffer_index ]        = column->values;
+			writer->body_buffer_sizes[ buffer_index++ ] = bitmap_size;
+		}
+		else
+		{
+			writer->body_buffers[ buffer_index ]        = column->values;
+			writer->body_buffer_sizes[ buffer_index++ ] = (size_t) writer->number_of_rows * column->value_size;
+		}
+	}
+	if( arrow_writer_write_batch(
+	     writer,
+	     -1,
+	     0,
+	     (int64_t) writer->number_of_rows,
+	     writer->number_of_columns,
+	     buffer_index,
+	     &( writer->record_batch_blocks ),
+	     &( writer->number_of_record_batch_blocks ),
+	     &( writer->record_batch_blocks_allocated_size ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	row_index = writer->number_of_rows;
+
+	for( column_index = 0;
+	     column_index < writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( writer->columns[ column_index ] );
+
+		if( column->number_of_values <= row_index )
+		{
+			if( memory_set(
+			     column->validity_bitmap,
+			     0,
+			     bitmap_size ) == NULL )
+			{
+				goto on_error;
+			}
+			if( column->type == ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+			{
+				if( memory_set(
+				     column->values,
+				     0,
+				     bitmap_size ) == NULL )
+				{
+					goto on_error;
+				}
+			}
+			column->number_of_null_values = 0;
+			column->number_of_values      = 0;
+			column->value_data_size       = 0;
+
+			continue;
+		}
+		/* Move the value of the current row to the first row
+		 */
+		row_is_valid = (uint8_t) ( column->validity_bitmap[ row_index / 8 ] & ( 1 << ( row_index % 8 ) ) );
+
+		if( memory_set(
+		     column->validity_bitmap,
+		     0,
+		     arrow_writer_bitmap_size( row_index + 1 ) ) == NULL )
+		{
+			goto on_error;
+		}
+		if( row_is_valid != 0 )
+		{
+			column->validity_bitmap[ 0 ] = 1;
+		}
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( column->value_offsets[ row_index * 4 ] ),
+			 value_data_offset );
+
+			row_data_offset = (size_t) value_data_offset;
+			row_data_size   = column->value_data_size - row_data_offset;
+
+			/* The data is copied in parts that do not overlap
+			 */
+			while( ( row_data_offset > 0 )
+			    && ( row_data_size > 0 ) )
+			{
+				copy_size = row_data_size;
+
+				if( copy_size > (size_t) value_data_offset )
+				{
+					copy_size = (size_t) value_data_offset;
+				}
+				if( memory_copy(
+				     &( column->value_data[ row_data_offset - value_data_offset ] ),
+				     &( column->value_data[ row_data_offset ] ),
+				     copy_size ) == NULL )
+				{
+					goto on_error;
+				}
+				row_data_offset += copy_size;
+				row_data_size   -= copy_size;
+			}
+			column->value_data_size -= (size_t) value_data_offset;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( column->value_offsets[ 4 ] ),
+			 (uint32_t) column->value_data_size );
+		}
+		else if( column->type == ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+		{
+			row_value = (uint8_t) ( column->values[ row_index / 8 ] & ( 1 << ( row_index % 8 ) ) );
+
+			if( memory_set(
+			     column->values,
+			     0,
+			     arrow_writer_bitmap_size( row_index + 1 ) ) == NULL )
+			{
+				goto on_error;
+			}
+			if( row_value != 0 )
+			{
+				column->values[ 0 ] = 1;
+			}
+		}
+		else if( row_index > 0 )
+		{
+			if( memory_copy(
+			     column->values,
+			     &( column->values[ row_index * column->value_size ] ),
+			     column->value_size ) == NULL )
+			{
+				goto on_error;
+			}
+		}
+		if( row_is_valid != 0 )
+		{
+			column->number_of_null_values = 0;
+		}
+		else
+		{
+			column->number_of_null_values = 1;
+		}
+		column->number_of_values = 1;
+	}
+	writer->number_of_rows = 0;
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_IO,
+	 LIBERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record batch.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the dictionary index of a string value
+ * The value is added to the dictionary if it is not retained
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_column_get_dictionary_index(
+            arrow_writer_column_t *column,
+            const uint8_t *data,
+            size_t data_size,
+            uint32_t *dictionary_index,
+            liberror_error_t **error )
+{
+	uint32_t *hash_table     = NULL;
+	static char *function    = "arrow_writer_column_get_dictionary_index";
+	size_t data_index        = 0;
+	uint32_t entry_hash      = 0;
+	uint32_t entry_index     = 0;
+	uint32_t entry_offset    = 0;
+	uint32_t entry_size      = 0;
+	uint32_t hash            = 2166136261UL;
+	uint32_t hash_table_size = 0;
+	uint32_t slot_index      = 0;
+
+	/* The FNV-1a hash of the data
+	 */
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		hash ^= data[ data_index ];
+		hash *= 16777619UL;
+	}
+	if( column->dictionary_hash_table != NULL )
+	{
+		slot_index = hash & ( column->dictionary_hash_table_size - 1 );
+
+		while( column->dictionary_hash_table[ slot_index ] != 0 )
+		{
+			entry_index = column->dictionary_hash_table[ slot_index ] - 1;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( column->dictionary_hashes[ entry_index * 4 ] ),
+			 entry_hash );
+
+			if( entry_hash == hash )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( column->dictionary_offsets[ entry_index * 4 ] ),
+				 entry_offset );
+				byte_stream_copy_to_uint32_little_endian(
+				 &( column->dictionary_offsets[ ( entry_index + 1 ) * 4 ] ),
+				 entry_size );
+
+				entry_size -= entry_offset;
+
+				if( ( (size_t) entry_size == data_size )
+				 && ( ( data_size == 0 )
+				  || ( memory_compare(
+				        &( column->dictionary_data[ entry_offset ] ),
+				        data,
+				        data_size ) == 0 ) ) )
+				{
+					*dictionary_index = column->dictionary_base_index + entry_index;
+
+					return( 1 );
+				}
+			}
+			slot_index = ( slot_index + 1 ) & ( column->dictionary_hash_table_size - 1 );
+		}
+	}
+	entry_index = column->number_of_dictionary_entries;
+
+	if( ( (size_t) column->dictionary_base_index + entry_index + 1 ) > (size_t) INT32_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of dictionary entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) INT32_MAX - column->dictionary_data_size ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid dictionary data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor of the hash table at most 0.5
+	 */
+	if( ( ( entry_index + 1 ) * 2 ) > column->dictionary_hash_table_size )
+	{
+		hash_table_size = column->dictionary_hash_table_size * 2;
+
+		if( hash_table_size < 1024 )
+		{
+			hash_table_size = 1024;
+		}
+		hash_table = (uint32_t *) memory_allocate(
+		                           sizeof( uint32_t ) * hash_table_size );
+
+		if( hash_table == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create dictionary hash table.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     hash_table,
+		     0,
+		     sizeof( uint32_t ) * hash_table_size ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear dictionary hash table.",
+			 function );
+
+			memory_free(
+			 hash_table );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < column->number_of_dictionary_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( column->dictionary_hashes[ entry_index * 4 ] ),
+			 entry_hash );
+
+			slot_index = entry_hash & ( hash_table_size - 1 );
+
+			while( hash_table[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( hash_table_size - 1 );
+			}
+			hash_table[ slot_index ] = entry_index + 1;
+		}
+		if( column->dictionary_hash_table != NULL )
+		{
+			memory_free(
+			 column->dictionary_hash_table );
+		}
+		column->dictionary_hash_table      = hash_table;
+		column->dictionary_hash_table_size = hash_table_size;
+
+		slot_index = hash & ( hash_table_size - 1 );
+
+		while( hash_table[ slot_index ] != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & ( hash_table_size - 1 );
+		}
+	}
+	if( arrow_writer_resize_array(
+	     &( column->dictionary_data ),
+	     &( column->dictionary_data_allocated_size ),
+	     column->dictionary_data_size + data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_resize_array(
+	     &( column->dictionary_offsets ),
+	     &( column->dictionary_offsets_allocated_size ),
+	     ( (size_t) entry_index + 2 ) * 4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_resize_array(
+	     &( column->dictionary_hashes ),
+	     &( column->dictionary_hashes_allocated_size ),
+	     ( (size_t) entry_index + 1 ) * 4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( column->dictionary_data[ column->dictionary_data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			goto on_error;
+		}
+	}
+	column->dictionary_data_size += data_size;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( column->dictionary_offsets[ ( entry_index + 1 ) * 4 ] ),
+	 (uint32_t) column->dictionary_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( column->dictionary_hashes[ entry_index * 4 ] ),
+	 hash );
+
+	column->dictionary_hash_table[ slot_index ] = entry_index + 1;
+
+	column->number_of_dictionary_entries += 1;
+
+	*dictionary_index = column->dictionary_base_index + entry_index;
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append dictionary entry.",
+	 function );
+
+	return( -1 );
+}
+
+/* Initializes the writer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_initialize(
+     arrow_writer_t **writer,
+     FILE *stream,
+     int number_of_columns,
+     liberror_error_t **error )
+{
+	static char *function            = "arrow_writer_initialize";
+	size_t columns_size              = 0;
+	size_t maximum_number_of_buffers = 0;
+
+	if( writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *writer != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_columns < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of columns value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_columns > ( (size_t) SSIZE_MAX / ( ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMN_BUFFERS * sizeof( arrow_writer_column_t ) ) ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of columns value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	columns_size = sizeof( arrow_writer_column_t ) * (size_t) number_of_columns;
+
+	/* A dictionary batch requires 3 buffers and 1 field node
+	 */
+	maximum_number_of_buffers = ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMN_BUFFERS * (size_t) number_of_columns;
+
+	if( maximum_number_of_buffers < ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMN_BUFFERS )
+	{
+		maximum_number_of_buffers = ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMN_BUFFERS;
+	}
+	*writer = memory_allocate_structure(
+	           arrow_writer_t );
+
+	if( *writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *writer,
+	     0,
+	     sizeof( arrow_writer_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear writer.",
+		 function );
+
+		memory_free(
+		 *writer );
+
+		*writer = NULL;
+
+		return( -1 );
+	}
+	if( number_of_columns > 0 )
+	{
+		( *writer )->columns = (arrow_writer_column_t *) memory_allocate(
+		                                                  columns_size );
+
+		if( ( *writer )->columns == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *writer )->columns,
+		     0,
+		     columns_size ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *writer )->body_buffers = (const uint8_t **) memory_allocate(
+	                                                sizeof( const uint8_t * ) * maximum_number_of_buffers );
+
+	if( ( *writer )->body_buffers == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create body buffers.",
+		 function );
+
+		goto on_error;
+	}
+	( *writer )->body_buffer_sizes = (size_t *) memory_allocate(
+	                                             sizeof( size_t ) * maximum_number_of_buffers );
+
+	if( ( *writer )->body_buffer_sizes == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create body buffer sizes.",
+		 function );
+
+		goto on_error;
+	}
+	( *writer )->node_null_counts = (int64_t *) memory_allocate(
+	                                             sizeof( int64_t ) * ( number_of_columns + 1 ) );
+
+	if( ( *writer )->node_null_counts == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node null counts.",
+		 function );
+
+		goto on_error;
+	}
+	( *writer )->stream            = stream;
+	( *writer )->number_of_columns = number_of_columns;
+
+	return( 1 );
+
+on_error:
+	if( *writer != NULL )
+	{
+		arrow_writer_free(
+		 writer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the writer
+ * The file stream is not closed
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_free(
+     arrow_writer_t **writer,
+     liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_free";
+	int column_index              = 0;
+
+	if( writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *writer != NULL )
+	{
+		if( ( *writer )->columns != NULL )
+		{
+			for( column_index = 0;
+			     column_index < ( *writer )->number_of_columns;
+			     column_index++ )
+			{
+				column = &( ( *writer )->columns[ column_index ] );
+
+				if( column->name != NULL )
+				{
+					memory_free(
+					 column->name );
+				}
+				if( column->validity_bitmap != NULL )
+				{
+					memory_free(
+					 column->validity_bitmap );
+				}
+				if( column->values != NULL )
+				{
+					memory_free(
+					 column->values );
+				}
+				if( column->value_offsets != NULL )
+				{
+					memory_free(
+					 column->value_offsets );
+				}
+				if( column->value_data != NULL )
+				{
+					memory_free(
+					 column->value_data );
+				}
+				if( column->dictionary_data != NULL )
+				{
+					memory_free(
+					 column->dictionary_data );
+				}
+				if( column->dictionary_offsets != NULL )
+				{
+					memory_free(
+					 column->dictionary_offsets );
+				}
+				if( column->dictionary_hashes != NULL )
+				{
+					memory_free(
+					 column->dictionary_hashes );
+				}
+				if( column->dictionary_hash_table != NULL )
+				{
+					memory_free(
+					 column->dictionary_hash_table );
+				}
+			}
+			memory_free(
+			 ( *writer )->columns );
+		}
+		if( ( *writer )->metadata != NULL )
+		{
+			memory_free(
+			 ( *writer )->metadata );
+		}
+		if( ( *writer )->body_buffers != NULL )
+		{
+			memory_free(
+			 (void *) ( *writer )->body_buffers );
+		}
+		if( ( *writer )->body_buffer_sizes != NULL )
+		{
+			memory_free(
+			 ( *writer )->body_buffer_sizes );
+		}
+		if( ( *writer )->node_null_counts != NULL )
+		{
+			memory_free(
+			 ( *writer )->node_null_counts );
+		}
+		if( ( *writer )->dictionary_batch_offsets != NULL )
+		{
+			memory_free(
+			 ( *writer )->dictionary_batch_offsets );
+		}
+		if( ( *writer )->dictionary_blocks != NULL )
+		{
+			memory_free(
+			 ( *writer )->dictionary_blocks );
+		}
+		if( ( *writer )->record_batch_blocks != NULL )
+		{
+			memory_free(
+			 ( *writer )->record_batch_blocks );
+		}
+		memory_free(
+		 *writer );
+
+		*writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Allocates a cleared column buffer
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_allocate_column_buffer(
+            uint8_t **buffer,
+            size_t buffer_size,
+            liberror_error_t **error )
+{
+	static char *function = "arrow_writer_allocate_column_buffer";
+
+	*buffer = (uint8_t *) memory_allocate(
+	                       sizeof( uint8_t ) * buffer_size );
+
+	if( *buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *buffer,
+	     0,
+	     buffer_size ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name and type of a specific column
+ * The name is an UTF-8 string without end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_set_column(
+     arrow_writer_t *writer,
+     int column_index,
+     const uint8_t *name,
+     size_t name_size,
+     int column_type,
+     liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_set_column";
+	size_t value_size             = 0;
+
+	if( writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( writer->schema_written != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid writer - schema already written.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= writer->number_of_columns ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name == NULL )
+	 && ( name_size > 0 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) INT32_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_type )
+	{
+		case ARROW_WRITER_COLUMN_TYPE_BINARY:
+		case ARROW_WRITER_COLUMN_TYPE_BOOLEAN:
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			value_size = 1;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			value_size = 2;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_FLOAT_32BIT:
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case ARROW_WRITER_COLUMN_TYPE_STRING:
+			value_size = 4;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_FLOAT_64BIT:
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case ARROW_WRITER_COLUMN_TYPE_TIMESTAMP:
+			value_size = 8;
+			break;
+
+		default:
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %d.",
+			 function,
+			 column_type );
+
+			return( -1 );
+	}
+	column = &( writer->columns[ column_index ] );
+
+	if( column->name != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column: %d value already set.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( arrow_writer_allocate_column_buffer(
+	     &( column->name ),
+	     name_size + 1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( name_size > 0 )
+	{
+		if( memory_copy(
+		     column->name,
+		     name,
+		     name_size ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	column->name_size  = name_size;
+	column->type       = column_type;
+	column->value_size = value_size;
+
+	if( column_type == ARROW_WRITER_COLUMN_TYPE_STRING )
+	{
+		if( arrow_writer_allocate_column_buffer(
+		     &( column->dictionary_offsets ),
+		     4,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		column->dictionary_offsets_allocated_size = 4;
+	}
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+	 "%s: unable to set column: %d.",
+	 function,
+	 column_index );
+
+	return( -1 );
+}
+
+/* Allocates the record batch buffers of the columns
+ * The number of rows of a record batch is limited so that the fixed size
+ * buffers of the columns do not exceed the maximum record batch buffers size
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_allocate_record_batch(
+            arrow_writer_t *writer,
+            liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_allocate_record_batch";
+	size_t bitmap_size            = 0;
+	size_t maximum_number_of_rows = 0;
+	size_t row_size               = 1;
+	int column_index              = 0;
+
+	/* Every column requires a validity bit and a value, offset or bit per row
+	 * which is approximated by a byte
+	 */
+	for( column_index = 0;
+	     column_index < writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( writer->columns[ column_index ] );
+
+		if( ( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+		 || ( column->type == ARROW_WRITER_COLUMN_TYPE_BOOLEAN ) )
+		{
+			row_size += 4 + 1;
+		}
+		else
+		{
+			row_size += column->value_size + 1;
+		}
+	}
+	maximum_number_of_rows = ARROW_WRITER_MAXIMUM_RECORD_BATCH_BUFFERS_SIZE / row_size;
+
+	if( maximum_number_of_rows > ARROW_WRITER_MAXIMUM_NUMBER_OF_ROWS )
+	{
+		maximum_number_of_rows = ARROW_WRITER_MAXIMUM_NUMBER_OF_ROWS;
+	}
+	else if( maximum_number_of_rows < 1 )
+	{
+		maximum_number_of_rows = 1;
+	}
+	bitmap_size = arrow_writer_bitmap_size(
+	               maximum_number_of_rows );
+
+	for( column_index = 0;
+	     column_index < writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( writer->columns[ column_index ] );
+
+		if( arrow_writer_allocate_column_buffer(
+		     &( column->validity_bitmap ),
+		     bitmap_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+		{
+			if( arrow_writer_allocate_column_buffer(
+			     &( column->value_offsets ),
+			     ( maximum_number_of_rows + 1 ) * 4,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else if( column->type == ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+		{
+			if( arrow_writer_allocate_column_buffer(
+			     &( column->values ),
+			     bitmap_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( arrow_writer_allocate_column_buffer(
+			     &( column->values ),
+			     maximum_number_of_rows * column->value_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	writer->maximum_number_of_rows = (int) maximum_number_of_rows;
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+	 "%s: unable to create buffers of column: %d.",
+	 function,
+	 column_index );
+
+	return( -1 );
+}
+
+/* Writes the file signature and the schema
+ * All columns must be set before the schema is written
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_schema(
+     arrow_writer_t *writer,
+     liberror_error_t **error )
+{
+	static char *function = "arrow_writer_write_schema";
+	size_t header_offset  = 0;
+	size_t schema_offset  = 0;
+	int column_index      = 0;
+
+	if( writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( writer->schema_written != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid writer - schema already written.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < writer->number_of_columns;
+	     column_index++ )
+	{
+		if( writer->columns[ column_index ].name == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid writer - missing column: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+	}
+	if( arrow_writer_allocate_record_batch(
+	     writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_write_data(
+	     writer,
+	     arrow_writer_file_signature,
+	     8,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_metadata_start_message(
+	     writer,
+	     ARROW_WRITER_MESSAGE_HEADER_SCHEMA,
+	     0,
+	     &header_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_metadata_add_schema(
+	     writer,
+	     &schema_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 header_offset,
+	 schema_offset );
+
+	if( arrow_writer_write_message(
+	     writer,
+	     0,
+	     0,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	writer->schema_written = 1;
+
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_IO,
+	 LIBERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write schema.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves a specific column to append a value to
+ * Returns 1 if successful or -1 on error
+ */
+static int arrow_writer_get_append_column(
+            arrow_writer_t *writer,
+            int column_index,
+            arrow_writer_column_t **column,
+            liberror_error_t **error )
+{
+	static char *function = "arrow_writer_get_append_column";
+
+	if( writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( writer->schema_written == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid writer - schema not written.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= writer->number_of_columns ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*column = &( writer->columns[ column_index ] );
+
+	return( 1 );
+}
+
+/* Appends a null value to a specific column of the current row
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_null(
+     arrow_writer_t *writer,
+     int column_index,
+     liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_null";
+	size_t row_index              = 0;
+
+	if( arrow_writer_get_append_column(
+	     writer,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	row_index = (size_t) writer->number_of_rows;
+
+	if( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( column->value_offsets[ ( row_index + 1 ) * 4 ] ),
+		 (uint32_t) column->value_data_size );
+	}
+	else if( column->type != ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+	{
+		if( memory_set(
+		     &( column->values[ row_index * column->value_size ] ),
+		     0,
+		     column->value_size ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	column->number_of_null_values += 1;
+	column->number_of_values      += 1;
+
+	return( 1 );
+}
+
+/* Appends a boolean value to a specific column of the current row
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_boolean(
+     arrow_writer_t *writer,
+     int column_index,
+     uint8_t value,
+     liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_boolean";
+	size_t row_index              = 0;
+
+	if( arrow_writer_get_append_column(
+	     writer,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( column->type != ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %d.",
+		 function,
+		 column->type );
+
+		return( -1 );
+	}
+	row_index = (size_t) writer->number_of_rows;
+
+	if( value != 0 )
+	{
+		column->values[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+	}
+	column->validity_bitmap[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Appends an integer value to a specific column of the current row
+ * The value is truncated to the size of the integer or timestamp column
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_integer(
+     arrow_writer_t *writer,
+     int column_index,
+     uint64_t value,
+     liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	uint8_t *value_data           = NULL;
+	static char *function         = "arrow_writer_append_integer";
+	size_t row_index              = 0;
+
+	if( arrow_writer_get_append_column(
+	     writer,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( ( column->type != ARROW_WRITER_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED )
+	 && ( column->type != ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+	 && ( column->type != ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED )
+	 && ( column->type != ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+	 && ( column->type != ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED )
+	 && ( column->type != ARROW_WRITER_COLUMN_TYPE_INTEGER_64BIT_SIGNED )
+	 && ( column->type != ARROW_WRITER_COLUMN_TYPE_TIMESTAMP ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %d.",
+		 function,
+		 column->type );
+
+		return( -1 );
+	}
+	row_index  = (size_t) writer->number_of_rows;
+	value_data = &( column->values[ row_index * column->value_size ] );
+
+	switch( column->value_size )
+	{
+		case 1:
+			value_data[ 0 ] = (uint8_t) value;
+			break;
+
+		case 2:
+			byte_stream_copy_from_uint16_little_endian(
+			 value_data,
+			 (uint16_t) value );
+			break;
+
+		case 4:
+			byte_stream_copy_from_uint32_little_endian(
+			 value_data,
+			 (uint32_t) value );
+			break;
+
+		default:
+			byte_stream_copy_from_uint64_little_endian(
+			 value_data,
+			 value );
+			break;
+	}
+	column->validity_bitmap[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Appends a 32-bit floating point value to a specific column of the current row
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_float_32bit(
+     arrow_writer_t *writer,
+     int column_index,
+     float value,
+     liberror_error_t **error )
+{
+	union
+	{
+		float floating_point;
+		uint32_t integer;
+	} value_32bit;
+
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_float_32bit";
+	size_t row_index              = 0;
+
+	if( arrow_writer_get_append_column(
+	     writer,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( column->type != ARROW_WRITER_COLUMN_TYPE_FLOAT_32BIT )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %d.",
+		 function,
+		 column->type );
+
+		return( -1 );
+	}
+	row_index = (size_t) writer->number_of_rows;
+
+	value_32bit.floating_point = value;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( column->values[ row_index * 4 ] ),
+	 value_32bit.integer );
+
+	column->validity_bitmap[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Appends a 64-bit floating point value to a specific column of the current row
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_float_64bit(
+     arrow_writer_t *writer,
+     int column_index,
+     double value,
+     liberror_error_t **error )
+{
+	union
+	{
+		double floating_point;
+		uint64_t integer;
+	} value_64bit;
+
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_float_64bit";
+	size_t row_index              = 0;
+
+	if( arrow_writer_get_append_column(
+	     writer,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( column->type != ARROW_WRITER_COLUMN_TYPE_FLOAT_64BIT )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %d.",
+		 function,
+		 column->type );
+
+		return( -1 );
+	}
+	row_index = (size_t) writer->number_of_rows;
+
+	value_64bit.floating_point = value;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( column->values[ row_index * 8 ] ),
+	 value_64bit.integer );
+
+	column->validity_bitmap[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Appends binary data or an UTF-8 string to a specific column of the current row
+ * The string is stored without end of string character
+ * The record batch is written before the current row if the data would not fit in it
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_data(
+     arrow_writer_t *writer,
+     int column_index,
+     const uint8_t *data,
+     size_t data_size,
+     liberror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_data";
+	size_t batch_data_size        = 0;
+	size_t row_index              = 0;
+	uint32_t dictionary_index     = 0;
+
+	if( arrow_writer_get_append_column(
+	     writer,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( column->type == ARROW_WRITER_COLUMN_TYPE_STRING )
+	{
+		batch_data_size = column->dictionary_data_size;
+	}
+	else if( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+	{
+		batch_data_size = column->value_data_size;
+	}
+	/* The data offsets of a batch are 32-bit signed integers, if the data
+	 * does not fit the complete rows are written and a new record batch is started
+	 */
+	if( ( ( column->type == ARROW_WRITER_COLUMN_TYPE_STRING )
+	  || ( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY ) )
+	 && ( writer->number_of_rows > 0 )
+	 && ( data_size > ( (size_t) INT32_MAX - batch_data_size ) ) )
+	{
+		if( arrow_writer_write_record_batch(
+		     writer,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record batch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	row_index = (size_t) writer->number_of_rows;
+
+	if( column->type == ARROW_WRITER_COLUMN_TYPE_STRING )
+	{
+		if( arrow_writer_column_get_dictionary_index(
+		     column,
+		     data,
+		     data_size,
+		     &dictionary_index,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve dictionary index.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( column->values[ row_index * 4 ] ),
+		 dictionary_index );
+	}
+	else if( column->type == ARROW_WRITER_COLUMN_TYPE_BINARY )
+	{
+		if( data_size > ( (size_t) INT32_MAX - column->value_data_size ) )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( arrow_writer_resize_array(
+		     &( column->value_data ),
+		     &( column->value_data_allocated_size ),
+		     column->value_data_size + data_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size > 0 )
+		{
+			if( memory_copy(
+			     &( column->value_data[ column->value_data_size ] ),
+			     data,
+			     data_size ) == NULL )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_MEMORY,
+				 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		column->value_data_size += data_size;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( column->value_offsets[ ( row_index + 1 ) * 4 ] ),
+		 (uint32_t) column->value_data_size );
+	}
+	else
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %d.",
+		 function,
+		 column->type );
+
+		return( -1 );
+	}
+	column->validity_bitmap[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Ends the current row
+ * A value must have been appended to every column of the row
+ * The record batch is written when it contains the maximum number of rows
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_end_row(
+     arrow_writer_t *writer,
+     liberror_error_t **error )
+{
+	static char *function = "arrow_writer_end_row";
+
+	if( writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( writer->schema_written == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid writer - schema not written.",
+		 function );
+
+		return( -1 );
+	}
+	writer->number_of_rows += 1;
+
+	if( writer->number_of_rows >= writer->maximum_number_of_rows )
+	{
+		if( arrow_writer_write_record_batch(
+		     writer,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record batch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the writer
+ * Writes the remaining rows, the end of stream marker and the footer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_finalize(
+     arrow_writer_t *writer,
+     liberror_error_t **error )
+{
+	static const uint8_t end_of_stream[ 8 ] = {
+		0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0 };
+
+	static const uint8_t field_sizes[ 4 ] = { 2, 4, 4, 4 };
+
+	uint8_t footer_trailer[ 10 ];
+	size_t field_offsets[ 4 ];
+
+	static char *function = "arrow_writer_finalize";
+	size_t schema_offset  = 0;
+	size_t table_offset   = 0;
+	size_t vector_offset  = 0;
+
+	if( writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( writer->schema_written == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid writer - schema not written.",
+		 function );
+
+		return( -1 );
+	}
+	/* At least one record batch is written so that the dictionaries are defined
+	 */
+	if( ( writer->number_of_rows > 0 )
+	 || ( writer->number_of_record_batch_blocks == 0 ) )
+	{
+		if( arrow_writer_write_record_batch(
+		     writer,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( arrow_writer_write_data(
+	     writer,
+	     end_of_stream,
+	     8,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	writer->metadata_size = 0;
+
+	if( arrow_writer_metadata_append(
+	     writer,
+	     8,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_metadata_add_table(
+	     writer,
+	     4,
+	     field_sizes,
+	     field_offsets,
+	     &table_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 0,
+	 table_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( writer->metadata[ field_offsets[ 0 ] ] ),
+	 ARROW_WRITER_METADATA_VERSION_V5 );
+
+	if( arrow_writer_metadata_add_schema(
+	     writer,
+	     &schema_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 field_offsets[ 1 ],
+	 schema_offset );
+
+	if( arrow_writer_metadata_add_vector(
+	     writer,
+	     writer->number_of_dictionary_blocks,
+	     ARROW_WRITER_BLOCK_SIZE,
+	     &vector_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 field_offsets[ 2 ],
+	 vector_offset );
+
+	if( writer->number_of_dictionary_blocks > 0 )
+	{
+		if( memory_copy(
+		     &( writer->metadata[ vector_offset + 4 ] ),
+		     writer->dictionary_blocks,
+		     (size_t) writer->number_of_dictionary_blocks * ARROW_WRITER_BLOCK_SIZE ) == NULL )
+		{
+			goto on_error;
+		}
+	}
+	if( arrow_writer_metadata_add_vector(
+	     writer,
+	     writer->number_of_record_batch_blocks,
+	     ARROW_WRITER_BLOCK_SIZE,
+	     &vector_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 writer,
+	 field_offsets[ 3 ],
+	 vector_offset );
+
+	if( writer->number_of_record_batch_blocks > 0 )
+	{
+		if( memory_copy(
+		     &( writer->metadata[ vector_offset + 4 ] ),
+		     writer->record_batch_blocks,
+		     (size_t) writer->number_of_record_batch_blocks * ARROW_WRITER_BLOCK_SIZE ) == NULL )
+		{
+			goto on_error;
+		}
+	}
+	if( arrow_writer_metadata_align(
+	     writer,
+	     8,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_write_data(
+	     writer,
+	     writer->metadata,
+	     writer->metadata_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 footer_trailer,
+	 (uint32_t) writer->metadata_size );
+
+	if( memory_copy(
+	     &( footer_trailer[ 4 ] ),
+	     arrow_writer_file_signature,
+	     6 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_write_data(
+	     writer,
+	     footer_trailer,
+	     10,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	liberror_error_set(
+	 error,
+	 LIBERROR_ERROR_DOMAIN_IO,
+	 LIBERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to finalize writer.",
+	 function );
+
+	return( -1 );
+}
+
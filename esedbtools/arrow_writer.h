@@ -0,0 +1,333 @@
+/* 
+ * Apache Arrow IPC file writer
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARROW_WRITER_H )
+#define _ARROW_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of rows in a record batch
+ */
+#define ARROW_WRITER_MAXIMUM_NUMBER_OF_ROWS			65536
+
+/* The size of the fixed size buffers of a record batch, which
+ * limits the number of rows in a record batch of tables with many columns
+ */
+#define ARROW_WRITER_MAXIMUM_RECORD_BATCH_BUFFERS_SIZE		( 32 * 1024 * 1024 )
+
+/* The dictionary data size above which the dictionary of a column
+ * no longer retains the previously written strings to detect duplicates
+ */
+#define ARROW_WRITER_MAXIMUM_RETAINED_DICTIONARY_DATA_SIZE	( 16 * 1024 * 1024 )
+
+enum ARROW_WRITER_COLUMN_TYPES
+{
+	ARROW_WRITER_COLUMN_TYPE_BINARY,
+	ARROW_WRITER_COLUMN_TYPE_BOOLEAN,
+	ARROW_WRITER_COLUMN_TYPE_FLOAT_32BIT,
+	ARROW_WRITER_COLUMN_TYPE_FLOAT_64BIT,
+	ARROW_WRITER_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED,
+	ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_SIGNED,
+	ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED,
+	ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	ARROW_WRITER_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	ARROW_WRITER_COLUMN_TYPE_STRING,
+	ARROW_WRITER_COLUMN_TYPE_TIMESTAMP
+};
+
+typedef struct arrow_writer_column arrow_writer_column_t;
+
+struct arrow_writer_column
+{
+	/* The name
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The column type
+	 */
+	int type;
+
+	/* The value size of fixed size values
+	 */
+	size_t value_size;
+
+	/* The validity bitmap of the current record batch
+	 */
+	uint8_t *validity_bitmap;
+
+	/* The number of null values in the current record batch
+	 */
+	int number_of_null_values;
+
+	/* The number of values in the current record batch, which exceeds
+	 * the number of rows if a value was appended to the current row
+	 */
+	int number_of_values;
+
+	/* The fixed size values, boolean bitmap or dictionary indexes
+	 * of the current record batch
+	 */
+	uint8_t *values;
+
+	/* The value offsets of binary values of the current record batch
+	 */
+	uint8_t *value_offsets;
+
+	/* The value data of binary values of the current record batch
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The allocated value data size
+	 */
+	size_t value_data_allocated_size;
+
+	/* The data of the retained dictionary entries
+	 */
+	uint8_t *dictionary_data;
+
+	/* The dictionary data size
+	 */
+	size_t dictionary_data_size;
+
+	/* The allocated dictionary data size
+	 */
+	size_t dictionary_data_allocated_size;
+
+	/* The 32-bit data offsets of the retained dictionary entries
+	 */
+	uint8_t *dictionary_offsets;
+
+	/* The allocated dictionary offsets size
+	 */
+	size_t dictionary_offsets_allocated_size;
+
+	/* The 32-bit hashes of the retained dictionary entries
+	 */
+	uint8_t *dictionary_hashes;
+
+	/* The allocated dictionary hashes size
+	 */
+	size_t dictionary_hashes_allocated_size;
+
+	/* The hash table that maps a hash to a retained dictionary entry
+	 * An entry contains the entry index + 1 or 0 if not set
+	 */
+	uint32_t *dictionary_hash_table;
+
+	/* The number of dictionary hash table entries, which is a power of 2
+	 */
+	uint32_t dictionary_hash_table_size;
+
+	/* The number of retained dictionary entries
+	 */
+	uint32_t number_of_dictionary_entries;
+
+	/* The dictionary index of the first retained dictionary entry
+	 */
+	uint32_t dictionary_base_index;
+
+	/* The number of dictionary entries written to the file
+	 */
+	uint32_t number_of_written_dictionary_entries;
+
+	/* Value to indicate the dictionary batch was written
+	 */
+	uint8_t dictionary_batch_written;
+};
+
+typedef struct arrow_writer arrow_writer_t;
+
+struct arrow_writer
+{
+	/* The file stream
+	 */
+	FILE *stream;
+
+	/* The offset of the file stream
+	 */
+	uint64_t stream_offset;
+
+	/* The columns
+	 */
+	arrow_writer_column_t *columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of rows in the current record batch
+	 */
+	int number_of_rows;
+
+	/* The maximum number of rows in a record batch
+	 */
+	int maximum_number_of_rows;
+
+	/* The flatbuffer data of the message or footer metadata
+	 */
+	uint8_t *metadata;
+
+	/* The metadata size
+	 */
+	size_t metadata_size;
+
+	/* The allocated metadata size
+	 */
+	size_t metadata_allocated_size;
+
+	/* The body buffers of the current message
+	 */
+	const uint8_t **body_buffers;
+
+	/* The body buffer sizes of the current message
+	 */
+	size_t *body_buffer_sizes;
+
+	/* The null counts of the field nodes of the current message
+	 */
+	int64_t *node_null_counts;
+
+	/* The rebased 32-bit offsets of the current dictionary batch
+	 */
+	uint8_t *dictionary_batch_offsets;
+
+	/* The allocated dictionary batch offsets size
+	 */
+	size_t dictionary_batch_offsets_allocated_size;
+
+	/* The encoded blocks of the dictionary batches
+	 */
+	uint8_t *dictionary_blocks;
+
+	/* The number of dictionary blocks
+	 */
+	int number_of_dictionary_blocks;
+
+	/* The allocated dictionary blocks size
+	 */
+	size_t dictionary_blocks_allocated_size;
+
+	/* The encoded blocks of the record batches
+	 */
+	uint8_t *record_batch_blocks;
+
+	/* The number of record batch blocks
+	 */
+	int number_of_record_batch_blocks;
+
+	/* The allocated record batch blocks size
+	 */
+	size_t record_batch_blocks_allocated_size;
+
+	/* Value to indicate the schema was written
+	 */
+	uint8_t schema_written;
+};
+
+int arrow_writer_initialize(
+     arrow_writer_t **writer,
+     FILE *stream,
+     int number_of_columns,
+     liberror_error_t **error );
+
+int arrow_writer_free(
+     arrow_writer_t **writer,
+     liberror_error_t **error );
+
+int arrow_writer_set_column(
+     arrow_writer_t *writer,
+     int column_index,
+     const uint8_t *name,
+     size_t name_size,
+     int column_type,
+     liberror_error_t **error );
+
+int arrow_writer_write_schema(
+     arrow_writer_t *writer,
+     liberror_error_t **error );
+
+int arrow_writer_append_null(
+     arrow_writer_t *writer,
+     int column_index,
+     liberror_error_t **error );
+
+int arrow_writer_append_boolean(
+     arrow_writer_t *writer,
+     int column_index,
+     uint8_t value,
+     liberror_error_t **error );
+
+int arrow_writer_append_integer(
+     arrow_writer_t *writer,
+     int column_index,
+     uint64_t value,
+     liberror_error_t **error );
+
+int arrow_writer_append_float_32bit(
+     arrow_writer_t *writer,
+     int column_index,
+     float value,
+     liberror_error_t **error );
+
+int arrow_writer_append_float_64bit(
+     arrow_writer_t *writer,
+     int column_index,
+     double value,
+     liberror_error_t **error );
+
+int arrow_writer_append_data(
+     arrow_writer_t *writer,
+     int column_index,
+     const uint8_t *data,
+     size_t data_size,
+     liberror_error_t **error );
+
+int arrow_writer_end_row(
+     arrow_writer_t *writer,
+     liberror_error_t **error );
+
+int arrow_writer_finalize(
+     arrow_writer_t *writer,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
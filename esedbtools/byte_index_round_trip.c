@@ -0,0 +1,724 @@
+/*
+ * Round trips and fuzzes the byte-index decompression
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedbtools_libesedb.h"
+
+/* The number of Huffman symbols
+ */
+#define BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS		512
+
+/* The maximum Huffman code size in bits
+ */
+#define BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE		15
+
+/* The maximum size of the uncompressed data of a round trip
+ */
+#define BYTE_INDEX_ROUND_TRIP_MAXIMUM_DATA_SIZE		8192
+
+/* The maximum size of the compressed data
+ * a symbol takes at most 15 code and 15 offset bits
+ */
+#define BYTE_INDEX_ROUND_TRIP_MAXIMUM_COMPRESSED_SIZE	( 2 + 256 + ( 4 * BYTE_INDEX_ROUND_TRIP_MAXIMUM_DATA_SIZE ) + 8 )
+
+/* The maximum size of a fuzz input file
+ */
+#define BYTE_INDEX_ROUND_TRIP_MAXIMUM_INPUT_SIZE	( 1024 * 1024 )
+
+/* The default number of round trips
+ */
+#define BYTE_INDEX_ROUND_TRIP_DEFAULT_NUMBER_OF_ROUNDS	2000
+
+typedef struct byte_index_round_trip_encoder byte_index_round_trip_encoder_t;
+
+struct byte_index_round_trip_encoder
+{
+	/* The code sizes of the symbols
+	 */
+	uint8_t code_sizes[ BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS ];
+
+	/* The canonical codes of the symbols
+	 */
+	uint16_t codes[ BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS ];
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data offset
+	 */
+	size_t compressed_data_offset;
+
+	/* The bits that were not yet stored in a 16-bit value
+	 */
+	uint16_t bit_value;
+
+	/* The number of bits in the bit value
+	 */
+	uint8_t number_of_bits;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use byte_index_round_trip to round trip randomly generated data through\n"
+	                 "the byte-index decompression and to run mutated or provided compressed\n"
+	                 "data through it.\n\n" );
+
+	fprintf( stream, "Usage: byte_index_round_trip [ -h ] [ -n rounds ] [ -s seed ] [ input ... ]\n\n" );
+
+	fprintf( stream, "\tinput: a file that contains byte-index compressed data without\n"
+	                 "\t       the leading compression type byte, the inputs are only\n"
+	                 "\t       checked for errors detected by the compiler instrumentation\n\n" );
+
+	fprintf( stream, "\t-h:    shows this help\n" );
+	fprintf( stream, "\t-n:    number of round trips, default is 2000\n" );
+	fprintf( stream, "\t-s:    seed of the random number generator, default is 1\n" );
+}
+
+/* Returns a random value in the range 0 to maximum_value - 1
+ */
+int byte_index_round_trip_random(
+     int maximum_value )
+{
+	return( (int) ( ( ( (uint32_t) rand() << 15 ) ^ (uint32_t) rand() ) % (uint32_t) maximum_value ) );
+}
+
+/* Generates code sizes for which the codes fit in the code space
+ * Returns the number of the literal symbol that is guaranteed to have a code
+ */
+int byte_index_round_trip_generate_code_sizes(
+     byte_index_round_trip_encoder_t *encoder )
+{
+	uint32_t code_space = 0;
+	int literal_symbol  = 0;
+	int symbol          = 0;
+
+	literal_symbol = byte_index_round_trip_random(
+	                  256 );
+
+	/* Every other round uses the complete code of 9 bits per symbol
+	 */
+	if( byte_index_round_trip_random( 2 ) == 0 )
+	{
+		for( symbol = 0;
+		     symbol < BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS;
+		     symbol++ )
+		{
+			encoder->code_sizes[ symbol ] = 9;
+		}
+		return( literal_symbol );
+	}
+	for( symbol = 0;
+	     symbol < BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		if( byte_index_round_trip_random( 4 ) == 0 )
+		{
+			encoder->code_sizes[ symbol ] = 0;
+		}
+		else
+		{
+			encoder->code_sizes[ symbol ] = (uint8_t) ( 1 + byte_index_round_trip_random( BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE ) );
+		}
+		if( encoder->code_sizes[ symbol ] != 0 )
+		{
+			code_space += (uint32_t) 1 << ( BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE - encoder->code_sizes[ symbol ] );
+		}
+	}
+	if( encoder->code_sizes[ literal_symbol ] == 0 )
+	{
+		encoder->code_sizes[ literal_symbol ] = BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE;
+
+		code_space += 1;
+	}
+	/* Lengthen or drop codes until they fit in the code space
+	 */
+	while( code_space > ( (uint32_t) 1 << BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE ) )
+	{
+		symbol = byte_index_round_trip_random(
+		          BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS );
+
+		if( encoder->code_sizes[ symbol ] == 0 )
+		{
+			continue;
+		}
+		code_space -= (uint32_t) 1 << ( BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE - encoder->code_sizes[ symbol ] );
+
+		if( encoder->code_sizes[ symbol ] < BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE )
+		{
+			encoder->code_sizes[ symbol ] += 1;
+
+			code_space += (uint32_t) 1 << ( BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE - encoder->code_sizes[ symbol ] );
+		}
+		else if( symbol != literal_symbol )
+		{
+			encoder->code_sizes[ symbol ] = 0;
+		}
+		else
+		{
+			code_space += 1;
+		}
+	}
+	return( literal_symbol );
+}
+
+/* Assigns the canonical codes in order of code size and then symbol
+ */
+void byte_index_round_trip_assign_codes(
+      byte_index_round_trip_encoder_t *encoder )
+{
+	uint16_t next_codes[ BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE + 1 ];
+	int code_size_counts[ BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE + 1 ];
+
+	uint16_t code = 0;
+	int code_size = 0;
+	int symbol    = 0;
+
+	for( code_size = 0;
+	     code_size <= BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		code_size_counts[ code_size ] = 0;
+	}
+	for( symbol = 0;
+	     symbol < BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		code_size_counts[ encoder->code_sizes[ symbol ] ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+
+	for( code_size = 1;
+	     code_size <= BYTE_INDEX_ROUND_TRIP_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		code = (uint16_t) ( ( code + code_size_counts[ code_size - 1 ] ) << 1 );
+
+		next_codes[ code_size ] = code;
+	}
+	for( symbol = 0;
+	     symbol < BYTE_INDEX_ROUND_TRIP_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		code_size = encoder->code_sizes[ symbol ];
+
+		if( code_size != 0 )
+		{
+			encoder->codes[ symbol ] = next_codes[ code_size ];
+
+			next_codes[ code_size ] += 1;
+		}
+	}
+}
+
+/* Writes bits to the compressed data, the most significant bit first
+ */
+void byte_index_round_trip_write_bits(
+      byte_index_round_trip_encoder_t *encoder,
+      uint16_t value,
+      uint8_t number_of_bits )
+{
+	while( number_of_bits > 0 )
+	{
+		number_of_bits--;
+
+		encoder->bit_value      = (uint16_t) ( ( encoder->bit_value << 1 ) | ( ( value >> number_of_bits ) & 1 ) );
+		encoder->number_of_bits += 1;
+
+		if( encoder->number_of_bits == 16 )
+		{
+			encoder->compressed_data[ encoder->compressed_data_offset++ ] = (uint8_t) ( encoder->bit_value & 0xff );
+			encoder->compressed_data[ encoder->compressed_data_offset++ ] = (uint8_t) ( encoder->bit_value >> 8 );
+
+			encoder->bit_value      = 0;
+			encoder->number_of_bits = 0;
+		}
+	}
+}
+
+/* Generates random data and compresses it using literals and matches
+ * Returns the compressed data size
+ */
+size_t byte_index_round_trip_compress(
+        byte_index_round_trip_encoder_t *encoder,
+        uint8_t *data,
+        size_t data_size )
+{
+	size_t data_offset     = 0;
+	size_t match_offset    = 0;
+	size_t match_size      = 0;
+	int literal_symbol     = 0;
+	int number_of_attempts = 0;
+	int offset_bits        = 0;
+	int symbol             = 0;
+	int symbol_index       = 0;
+
+	literal_symbol = byte_index_round_trip_generate_code_sizes(
+	                  encoder );
+
+	byte_index_round_trip_assign_codes(
+	 encoder );
+
+	encoder->compressed_data[ 0 ] = (uint8_t) ( data_size & 0xff );
+	encoder->compressed_data[ 1 ] = (uint8_t) ( data_size >> 8 );
+
+	for( symbol_index = 0;
+	     symbol_index < 256;
+	     symbol_index++ )
+	{
+		encoder->compressed_data[ 2 + symbol_index ] = (uint8_t) ( ( encoder->code_sizes[ ( 2 * symbol_index ) + 1 ] << 4 )
+		                                             | encoder->code_sizes[ 2 * symbol_index ] );
+	}
+	encoder->compressed_data_offset = 2 + 256;
+	encoder->bit_value              = 0;
+	encoder->number_of_bits         = 0;
+
+	while( data_offset < data_size )
+	{
+		symbol = -1;
+
+		/* Matches use symbols 256 - 511 where bits 0 - 3 contain the match size - 3
+		 * and bits 4 - 7 the number of match offset bits, match size 18 and larger
+		 * are stored in additional bytes and are not generated
+		 */
+		for( number_of_attempts = 0;
+		     ( data_offset > 0 ) && ( number_of_attempts < 4 );
+		     number_of_attempts++ )
+		{
+			symbol = 256 + byte_index_round_trip_random( 256 );
+
+			offset_bits = ( symbol >> 4 ) & 0x0f;
+			match_size  = (size_t) ( symbol & 0x0f ) + 3;
+
+			if( ( encoder->code_sizes[ symbol ] != 0 )
+			 && ( ( symbol & 0x0f ) != 0x0f )
+			 && ( ( (size_t) 1 << offset_bits ) <= data_offset )
+			 && ( match_size <= ( data_size - data_offset ) ) )
+			{
+				break;
+			}
+			symbol = -1;
+		}
+		if( symbol == -1 )
+		{
+			symbol = byte_index_round_trip_random(
+			          256 );
+
+			if( encoder->code_sizes[ symbol ] == 0 )
+			{
+				symbol = literal_symbol;
+			}
+			byte_index_round_trip_write_bits(
+			 encoder,
+			 encoder->codes[ symbol ],
+			 encoder->code_sizes[ symbol ] );
+
+			data[ data_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		match_offset = (size_t) 1 << offset_bits;
+
+		if( offset_bits > 0 )
+		{
+			match_offset |= (size_t) byte_index_round_trip_random( 1 << offset_bits );
+		}
+		if( match_offset > data_offset )
+		{
+			match_offset = data_offset;
+		}
+		byte_index_round_trip_write_bits(
+		 encoder,
+		 encoder->codes[ symbol ],
+		 encoder->code_sizes[ symbol ] );
+
+		byte_index_round_trip_write_bits(
+		 encoder,
+		 (uint16_t) ( match_offset - ( (size_t) 1 << offset_bits ) ),
+		 (uint8_t) offset_bits );
+
+		/* Overlapping matches repeat the data
+		 */
+		while( match_size > 0 )
+		{
+			data[ data_offset ] = data[ data_offset - match_offset ];
+
+			data_offset++;
+			match_size--;
+		}
+	}
+	/* Flush the remaining bits and add 2 16-bit values of padding
+	 */
+	byte_index_round_trip_write_bits(
+	 encoder,
+	 0,
+	 (uint8_t) ( 16 - encoder->number_of_bits ) );
+
+	byte_index_round_trip_write_bits(
+	 encoder,
+	 0,
+	 16 );
+
+	byte_index_round_trip_write_bits(
+	 encoder,
+	 0,
+	 16 );
+
+	return( encoder->compressed_data_offset );
+}
+
+/* Decompresses an input, errors are expected for invalid inputs
+ * The uncompressed data is allocated with the exact size so that
+ * the compiler instrumentation detects out of bounds access
+ * Returns 1 if the input was decompressed, 0 if not or -1 on error
+ */
+int byte_index_round_trip_fuzz_input(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size )
+{
+	libesedb_error_t *error       = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( libesedb_compression_byte_index_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data_size,
+	     &error ) != 1 )
+	{
+		libesedb_error_free(
+		 &error );
+
+		return( 0 );
+	}
+	if( uncompressed_data_size == 0 )
+	{
+		return( 0 );
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		return( -1 );
+	}
+	result = libesedb_compression_byte_index_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          &error );
+
+	if( result != 1 )
+	{
+		libesedb_error_free(
+		 &error );
+
+		result = 0;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	return( result );
+}
+
+/* The main program
+ */
+int main( int argc, char * const argv[] )
+{
+	byte_index_round_trip_encoder_t encoder;
+
+	libesedb_error_t *error       = NULL;
+	FILE *input_stream            = NULL;
+	uint8_t *data                 = NULL;
+	uint8_t *input_data           = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t compressed_data_size   = 0;
+	size_t data_size              = 0;
+	size_t input_data_size        = 0;
+	size_t mutation_offset        = 0;
+	int argument_index            = 1;
+	int number_of_decompressed    = 0;
+	int number_of_failures        = 0;
+	int number_of_mutations       = 0;
+	int number_of_rounds          = BYTE_INDEX_ROUND_TRIP_DEFAULT_NUMBER_OF_ROUNDS;
+	int result                    = 0;
+	int round                     = 0;
+	unsigned int seed             = 1;
+
+	encoder.compressed_data = NULL;
+
+	while( ( argument_index < argc )
+	    && ( argv[ argument_index ][ 0 ] == '-' ) )
+	{
+		if( ( argv[ argument_index ][ 1 ] == 'h' )
+		 && ( argv[ argument_index ][ 2 ] == 0 ) )
+		{
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		else if( ( argv[ argument_index ][ 1 ] == 'n' )
+		      && ( argv[ argument_index ][ 2 ] == 0 )
+		      && ( ( argument_index + 1 ) < argc ) )
+		{
+			number_of_rounds = atoi(
+			                    argv[ argument_index + 1 ] );
+
+			argument_index += 2;
+		}
+		else if( ( argv[ argument_index ][ 1 ] == 's' )
+		      && ( argv[ argument_index ][ 2 ] == 0 )
+		      && ( ( argument_index + 1 ) < argc ) )
+		{
+			seed = (unsigned int) atoi(
+			                       argv[ argument_index + 1 ] );
+
+			argument_index += 2;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Invalid argument: %s\n",
+			 argv[ argument_index ] );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( argument_index < argc )
+	{
+		input_data = (uint8_t *) memory_allocate(
+		                          BYTE_INDEX_ROUND_TRIP_MAXIMUM_INPUT_SIZE );
+
+		if( input_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create input data.\n" );
+
+			goto on_error;
+		}
+		while( argument_index < argc )
+		{
+			input_stream = file_stream_open(
+			                argv[ argument_index ],
+			                FILE_STREAM_OPEN_READ );
+
+			if( input_stream == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open input: %s.\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+			input_data_size = file_stream_read(
+			                   input_stream,
+			                   input_data,
+			                   BYTE_INDEX_ROUND_TRIP_MAXIMUM_INPUT_SIZE );
+
+			file_stream_close(
+			 input_stream );
+
+			if( byte_index_round_trip_fuzz_input(
+			     input_data,
+			     input_data_size ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress input: %s.\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+			argument_index++;
+		}
+		memory_free(
+		 input_data );
+
+		return( EXIT_SUCCESS );
+	}
+	srand(
+	 seed );
+
+	data = (uint8_t *) memory_allocate(
+	                    BYTE_INDEX_ROUND_TRIP_MAXIMUM_DATA_SIZE );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 BYTE_INDEX_ROUND_TRIP_MAXIMUM_DATA_SIZE );
+
+	encoder.compressed_data = (uint8_t *) memory_allocate(
+	                                       BYTE_INDEX_ROUND_TRIP_MAXIMUM_COMPRESSED_SIZE );
+
+	if( ( data == NULL )
+	 || ( uncompressed_data == NULL )
+	 || ( encoder.compressed_data == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create data.\n" );
+
+		goto on_error;
+	}
+	for( round = 0;
+	     round < number_of_rounds;
+	     round++ )
+	{
+		data_size = 1 + (size_t) byte_index_round_trip_random(
+		                          BYTE_INDEX_ROUND_TRIP_MAXIMUM_DATA_SIZE );
+
+		compressed_data_size = byte_index_round_trip_compress(
+		                        &encoder,
+		                        data,
+		                        data_size );
+
+		if( libesedb_compression_byte_index_decompress(
+		     encoder.compressed_data,
+		     compressed_data_size,
+		     uncompressed_data,
+		     data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stdout,
+			 "Round: %d unable to decompress data of size: %" PRIzd ".\n",
+			 round,
+			 data_size );
+
+			libesedb_error_backtrace_fprint(
+			 error,
+			 stdout );
+			libesedb_error_free(
+			 &error );
+
+			number_of_failures++;
+		}
+		else if( memory_compare(
+		          data,
+		          uncompressed_data,
+		          data_size ) != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Round: %d decompressed data of size: %" PRIzd " does not match.\n",
+			 round,
+			 data_size );
+
+			number_of_failures++;
+		}
+		/* Mutate the compressed data and truncate it at random
+		 */
+		for( number_of_mutations = 1 + byte_index_round_trip_random( 8 );
+		     number_of_mutations > 0;
+		     number_of_mutations-- )
+		{
+			mutation_offset = (size_t) byte_index_round_trip_random(
+			                            (int) compressed_data_size );
+
+			encoder.compressed_data[ mutation_offset ] ^= (uint8_t) ( 1 + byte_index_round_trip_random( 255 ) );
+		}
+		if( byte_index_round_trip_random( 2 ) == 0 )
+		{
+			compressed_data_size = (size_t) byte_index_round_trip_random(
+			                                 (int) compressed_data_size );
+		}
+		result = byte_index_round_trip_fuzz_input(
+		          encoder.compressed_data,
+		          compressed_data_size );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress mutated data.\n" );
+
+			goto on_error;
+		}
+		number_of_decompressed += result;
+	}
+	fprintf(
+	 stdout,
+	 "Round trips: %d, failures: %d, mutated inputs decompressed without error: %d.\n",
+	 number_of_rounds,
+	 number_of_failures,
+	 number_of_decompressed );
+
+	memory_free(
+	 encoder.compressed_data );
+	memory_free(
+	 uncompressed_data );
+	memory_free(
+	 data );
+
+	if( number_of_failures != 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( encoder.compressed_data != NULL )
+	{
+		memory_free(
+		 encoder.compressed_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( input_data != NULL )
+	{
+		memory_free(
+		 input_data );
+	}
+	return( EXIT_FAILURE );
+}
+
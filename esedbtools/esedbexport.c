@@ -57,8 +57,9 @@ void usage_fprint(
 	fprintf( stream, "Use esedbexport to export items stored in an Extensible Storage Engine (ESE)\n"
 	                 "Database (EDB) file\n\n" );
 
-	fprintf( stream, "Usage: esedbexport [ -c codepage ] [ -l logfile ] [ -m mode ] [ -t target ]\n"
-	                 "                   [ -T table_name ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: esedbexport [ -c codepage ] [ -f format ] [ -j threads ] [ -l logfile ]\n"
+	                 "                   [ -m mode ] [ -t target ] [ -T table_name ] [ -hMvV ]\n"
+	                 "                   source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -66,8 +67,17 @@ void usage_fprint(
 	                 "\t        windows-932, windows-936, windows-1250, windows-1251,\n"
 	                 "\t        windows-1252 (default), windows-1253, windows-1254\n"
 	                 "\t        windows-1255, windows-1256, windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-f:     export format, options: columnar, text (default)\n"
+	                 "\t        columnar exports the tables as Apache Arrow IPC files,\n"
+	                 "\t        long values, multi values and compressed values of fixed size\n"
+	                 "\t        columns are exported as null\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     the number of threads used to export tables concurrently,\n"
+	                 "\t        every thread opens the source file separately (default is 1)\n"
+	                 "\t        a table is always exported by a single thread, so more threads\n"
+	                 "\t        do not speed up the export of a single table\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
+	fprintf( stream, "\t-M:     use memory mapped file I/O to read the source file\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, tables (default)\n"
 	                 "\t        'all' exports all the tables or a single specified table with indexes,\n"
 	                 "\t        'tables' exports all the tables or a single specified table\n" );
@@ -126,21 +136,24 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcstring_system_character_t *log_filename          = NULL;
-	libcstring_system_character_t *option_ascii_codepage = NULL;
-	libcstring_system_character_t *option_export_mode    = NULL;
-	libcstring_system_character_t *option_table_name     = NULL;
-	libcstring_system_character_t *option_target_path    = NULL;
-	libcstring_system_character_t *path_separator        = NULL;
-	libcstring_system_character_t *source                = NULL;
-	liberror_error_t *error                              = NULL;
-	log_handle_t *log_handle                             = NULL;
-	char *program                                        = "esedbexport";
-	size_t source_length                                 = 0;
-	size_t option_table_name_length                      = 0;
-	libcstring_system_integer_t option                   = 0;
-	int result                                           = 0;
-	int verbose                                          = 0;
+	libcstring_system_character_t *log_filename             = NULL;
+	libcstring_system_character_t *option_ascii_codepage    = NULL;
+	libcstring_system_character_t *option_export_format     = NULL;
+	libcstring_system_character_t *option_export_mode       = NULL;
+	libcstring_system_character_t *option_number_of_threads = NULL;
+	libcstring_system_character_t *option_table_name        = NULL;
+	libcstring_system_character_t *option_target_path       = NULL;
+	libcstring_system_character_t *path_separator           = NULL;
+	libcstring_system_character_t *source                   = NULL;
+	liberror_error_t *error                                 = NULL;
+	log_handle_t *log_handle                                = NULL;
+	char *program                                           = "esedbexport";
+	size_t source_length                                    = 0;
+	size_t option_table_name_length                         = 0;
+	libcstring_system_integer_t option                      = 0;
+	int result                                              = 0;
+	int use_memory_map                                      = 0;
+	int verbose                                             = 0;
 
 	libsystem_notify_set_stream(
 	 stderr,
@@ -171,7 +184,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "c:hl:m:t:T:vV" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "c:f:hj:l:m:Mt:T:vV" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -192,12 +205,22 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'f':
+				option_export_format = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -208,6 +231,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'M':
+				use_memory_map = 1;
+
+				break;
+
 			case (libcstring_system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -299,6 +327,10 @@ int main( int argc, char * const argv[] )
 /* TODO
 	esedbexport_export_handle->print_status_information = print_status_information;
 */
+	if( use_memory_map != 0 )
+	{
+		esedbexport_export_handle->access_flags |= LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED;
+	}
 	if( option_export_mode != NULL )
 	{
 		result = export_handle_set_export_mode(
@@ -321,6 +353,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported export mode defaulting to: tables.\n" );
 		}
 	}
+	if( option_export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+			  esedbexport_export_handle,
+			  option_export_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format defaulting to: text.\n" );
+		}
+	}
 	if( option_ascii_codepage != NULL )
 	{
 		result = export_handle_set_ascii_codepage(
@@ -343,6 +397,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          esedbexport_export_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
 	if( export_handle_set_target_path(
 	     esedbexport_export_handle,
 	     option_target_path,
@@ -406,6 +482,22 @@ int main( int argc, char * const argv[] )
 		 &error );
 	}
 #endif
+	/* Only the catalog definitions of the exported table are needed
+	 */
+	if( option_table_name != NULL )
+	{
+		if( libesedb_file_set_catalog_read_on_demand(
+		     esedbexport_export_handle->input_file,
+		     1,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set catalog read on demand.\n" );
+
+			goto on_error;
+		}
+	}
 	if( export_handle_open(
 	     esedbexport_export_handle,
 	     source,
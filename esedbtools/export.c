@@ -27,25 +27,54 @@
 
 #include "export.h"
 
+/* The size of the chunks in which the formatted output is written
+ */
+#define EXPORT_CHUNK_SIZE		512
+
+static const uint8_t export_hexadecimal_digits[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+static const char *export_month_strings[ 12 ] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
 /* Exports binary data
+ * The data is written as hexadecimal characters
  */
 void export_binary_data(
       const uint8_t *data,
       size_t data_size,
       FILE *stream )
 {
+	uint8_t chunk[ EXPORT_CHUNK_SIZE ];
+
+	size_t chunk_index = 0;
+
 	if( data != NULL )
 	{
 		while( data_size > 0 )
 		{
-			fprintf(
-			 stream,
-			 "%02" PRIx8 "",
-			 *data );
+			chunk[ chunk_index++ ] = export_hexadecimal_digits[ *data >> 4 ];
+			chunk[ chunk_index++ ] = export_hexadecimal_digits[ *data & 0x0f ];
 
+			if( chunk_index >= EXPORT_CHUNK_SIZE )
+			{
+				file_stream_write(
+				 stream,
+				 chunk,
+				 chunk_index );
+
+				chunk_index = 0;
+			}
 			data      += 1;
 			data_size -= 1;
 		}
+		if( chunk_index > 0 )
+		{
+			file_stream_write(
+			 stream,
+			 chunk,
+			 chunk_index );
+		}
 	}
 }
 
@@ -57,53 +86,72 @@ void export_narrow_text(
       size_t string_size,
       FILE *stream )
 {
+	char chunk[ EXPORT_CHUNK_SIZE ];
+
+	size_t chunk_index    = 0;
+	char escape_character = 0;
+
 	if( string != NULL )
 	{
 		while( string_size > 0 )
 		{
-			if( *string == 0 )
-			{
-				if( string_size > 1 )
-				{
-					fprintf(
-					 stream,
-					 "\\0" );
-				}
-			}
-			else if( *string == '\\' )
-			{
-				fprintf(
-				 stream,
-				 "\\\\" );
-			}
-			else if( *string == '\n' )
+			switch( *string )
 			{
-				fprintf(
-				 stream,
-				 "\\n" );
-			}
-			else if( *string == '\r' )
-			{
-				fprintf(
-				 stream,
-				 "\\r" );
+				case 0:
+					/* The end of string character is not exported
+					 */
+					escape_character = ( string_size > 1 ) ? '0' : 0;
+					break;
+
+				case '\\':
+					escape_character = '\\';
+					break;
+
+				case '\n':
+					escape_character = 'n';
+					break;
+
+				case '\r':
+					escape_character = 'r';
+					break;
+
+				case '\t':
+					escape_character = 't';
+					break;
+
+				default:
+					escape_character = 0;
+
+					chunk[ chunk_index++ ] = *string;
+
+					break;
 			}
-			else if( *string == '\t' )
+			if( escape_character != 0 )
 			{
-				fprintf(
-				 stream,
-				 "\\t" );
+				chunk[ chunk_index++ ] = '\\';
+				chunk[ chunk_index++ ] = escape_character;
 			}
-			else
+			/* Make sure there is room for an escaped character
+			 */
+			if( chunk_index >= ( EXPORT_CHUNK_SIZE - 1 ) )
 			{
-				fprintf(
+				file_stream_write(
 				 stream,
-				 "%c",
-				 *string );
+				 chunk,
+				 chunk_index );
+
+				chunk_index = 0;
 			}
 			string      += 1;
 			string_size -= 1;
 		}
+		if( chunk_index > 0 )
+		{
+			file_stream_write(
+			 stream,
+			 chunk,
+			 chunk_index );
+		}
 	}
 }
 
@@ -115,6 +163,7 @@ void export_text(
       size_t string_size,
       FILE *stream )
 {
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 	if( string != NULL )
 	{
 		while( string_size > 0 )
@@ -163,5 +212,224 @@ void export_text(
 			string_size -= 1;
 		}
 	}
+#else
+	export_narrow_text(
+	 (const char *) string,
+	 string_size,
+	 stream );
+#endif
+}
+
+/* Exports an unsigned integer
+ * The integer is written as decimal characters
+ */
+void export_unsigned_integer(
+      uint64_t value,
+      FILE *stream )
+{
+	uint8_t digits[ 20 ];
+
+	size_t digit_index = 20;
+
+	do
+	{
+		digits[ --digit_index ] = (uint8_t) '0' + (uint8_t) ( value % 10 );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	file_stream_write(
+	 stream,
+	 &( digits[ digit_index ] ),
+	 20 - digit_index );
+}
+
+/* Exports a signed integer
+ * The integer is written as decimal characters
+ */
+void export_signed_integer(
+      int64_t value,
+      FILE *stream )
+{
+	if( value < 0 )
+	{
+		fputc(
+		 '-',
+		 stream );
+
+		/* Negate as an unsigned value to support the smallest negative value
+		 */
+		export_unsigned_integer(
+		 (uint64_t) 0 - (uint64_t) value,
+		 stream );
+	}
+	else
+	{
+		export_unsigned_integer(
+		 (uint64_t) value,
+		 stream );
+	}
+}
+
+/* Exports a FILETIME
+ * The FILETIME is written as: Mon dd, yyyy hh:mm:ss.uuuuuu
+ * or as: (0x######## 0x########) if the year exceeds 9999
+ * which is the same as libfdatetime using the ctime format with micro seconds
+ */
+void export_filetime(
+      uint64_t filetime,
+      FILE *stream )
+{
+	uint8_t string[ 32 ];
+
+	uint64_t timestamp       = filetime;
+	size_t string_index      = 0;
+	uint32_t days_in_century = 0;
+	uint32_t micro_seconds   = 0;
+	uint32_t year            = 0;
+	uint16_t days_in_year    = 0;
+	uint8_t days_in_month    = 0;
+	uint8_t hours            = 0;
+	uint8_t minutes          = 0;
+	uint8_t month            = 0;
+	uint8_t seconds          = 0;
+	int digit_index          = 0;
+
+	/* The timestamp is in units of 100 nano seconds
+	 */
+	micro_seconds = (uint32_t) ( ( timestamp % 10000000 ) / 10 );
+	timestamp    /= 10000000;
+	seconds       = (uint8_t) ( timestamp % 60 );
+	timestamp    /= 60;
+	minutes       = (uint8_t) ( timestamp % 60 );
+	timestamp    /= 60;
+	hours         = (uint8_t) ( timestamp % 24 );
+	timestamp    /= 24;
+
+	/* Add 1 day to compensate that Jan 1 1601 is represented as 0
+	 * The days are reduced per century, year and month in the same
+	 * way as libfdatetime to produce exactly the same output
+	 */
+	timestamp += 1;
+	year       = 1601;
+
+	if( timestamp >= 36159 )
+	{
+		year       = 1700;
+		timestamp -= 36159;
+	}
+	while( timestamp > 0 )
+	{
+		days_in_century = ( ( year % 400 ) == 0 ) ? 36525 : 36524;
+
+		if( timestamp <= days_in_century )
+		{
+			break;
+		}
+		timestamp -= days_in_century;
+		year      += 100;
+	}
+	while( timestamp > 0 )
+	{
+		days_in_year = ( ( ( ( year % 4 ) == 0 ) && ( ( year % 100 ) != 0 ) ) || ( ( year % 400 ) == 0 ) ) ? 366 : 365;
+
+		if( timestamp <= days_in_year )
+		{
+			break;
+		}
+		timestamp -= days_in_year;
+		year      += 1;
+	}
+	month = 1;
+
+	while( timestamp > 0 )
+	{
+		switch( month )
+		{
+			case 2:
+				days_in_month = ( ( ( ( year % 4 ) == 0 ) && ( ( year % 100 ) != 0 ) ) || ( ( year % 400 ) == 0 ) ) ? 29 : 28;
+				break;
+
+			case 4:
+			case 6:
+			case 9:
+			case 11:
+				days_in_month = 30;
+				break;
+
+			default:
+				days_in_month = 31;
+				break;
+		}
+		if( timestamp <= days_in_month )
+		{
+			break;
+		}
+		timestamp -= days_in_month;
+		month     += 1;
+	}
+	/* The remaining days are the day of the month, which is 0 on the last day of 1699
+	 */
+	if( ( year > 9999 )
+	 || ( timestamp == 0 ) )
+	{
+		string[ string_index++ ] = (uint8_t) '(';
+
+		for( digit_index = 0;
+		     digit_index < 16;
+		     digit_index++ )
+		{
+			if( digit_index == 8 )
+			{
+				string[ string_index++ ] = (uint8_t) ' ';
+			}
+			if( ( digit_index % 8 ) == 0 )
+			{
+				string[ string_index++ ] = (uint8_t) '0';
+				string[ string_index++ ] = (uint8_t) 'x';
+			}
+			string[ string_index++ ] = export_hexadecimal_digits[ ( filetime >> ( 60 - ( 4 * digit_index ) ) ) & 0x0f ];
+		}
+		string[ string_index++ ] = (uint8_t) ')';
+	}
+	else
+	{
+		string[ string_index++ ] = (uint8_t) export_month_strings[ month - 1 ][ 0 ];
+		string[ string_index++ ] = (uint8_t) export_month_strings[ month - 1 ][ 1 ];
+		string[ string_index++ ] = (uint8_t) export_month_strings[ month - 1 ][ 2 ];
+		string[ string_index++ ] = (uint8_t) ' ';
+		string[ string_index++ ] = (uint8_t) '0' + (uint8_t) ( timestamp / 10 );
+		string[ string_index++ ] = (uint8_t) '0' + (uint8_t) ( timestamp % 10 );
+		string[ string_index++ ] = (uint8_t) ',';
+		string[ string_index++ ] = (uint8_t) ' ';
+		string[ string_index++ ] = (uint8_t) '0' + (uint8_t) ( year / 1000 );
+		string[ string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( year / 100 ) % 10 );
+		string[ string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( year / 10 ) % 10 );
+		string[ string_index++ ] = (uint8_t) '0' + (uint8_t) ( year % 10 );
+		string[ string_index++ ] = (uint8_t) ' ';
+		string[ string_index++ ] = (uint8_t) '0' + ( hours / 10 );
+		string[ string_index++ ] = (uint8_t) '0' + ( hours % 10 );
+		string[ string_index++ ] = (uint8_t) ':';
+		string[ string_index++ ] = (uint8_t) '0' + ( minutes / 10 );
+		string[ string_index++ ] = (uint8_t) '0' + ( minutes % 10 );
+		string[ string_index++ ] = (uint8_t) ':';
+		string[ string_index++ ] = (uint8_t) '0' + ( seconds / 10 );
+		string[ string_index++ ] = (uint8_t) '0' + ( seconds % 10 );
+		string[ string_index++ ] = (uint8_t) '.';
+
+		for( digit_index = 5;
+		     digit_index >= 0;
+		     digit_index-- )
+		{
+			string[ string_index + digit_index ] = (uint8_t) '0' + (uint8_t) ( micro_seconds % 10 );
+			micro_seconds                       /= 10;
+		}
+		string_index += 6;
+	}
+	file_stream_write(
+	 stream,
+	 string,
+	 string_index );
 }
 
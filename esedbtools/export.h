@@ -47,6 +47,18 @@ void export_text(
       size_t string_size,
       FILE *stream );
 
+void export_unsigned_integer(
+      uint64_t value,
+      FILE *stream );
+
+void export_signed_integer(
+      int64_t value,
+      FILE *stream );
+
+void export_filetime(
+      uint64_t filetime,
+      FILE *stream );
+
 #if defined( __cplusplus )
 }
 #endif
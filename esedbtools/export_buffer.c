@@ -0,0 +1,219 @@
+/* 
+ * Export buffer
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "export_buffer.h"
+
+/* Initializes the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_initialize(
+     export_buffer_t **buffer,
+     liberror_error_t **error )
+{
+	static char *function = "export_buffer_initialize";
+
+	if( buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer = memory_allocate_structure(
+	           export_buffer_t );
+
+	if( *buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *buffer,
+	     0,
+	     sizeof( export_buffer_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_free(
+     export_buffer_t **buffer,
+     liberror_error_t **error )
+{
+	static char *function = "export_buffer_free";
+
+	if( buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		if( ( *buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *buffer )->data );
+		}
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the buffer so that it can contain at least size bytes
+ * The buffer is only reallocated when it is too small and the contents
+ * of the data are not preserved
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_resize(
+     export_buffer_t *buffer,
+     size_t size,
+     liberror_error_t **error )
+{
+	static char *function = "export_buffer_resize";
+	size_t data_size      = 0;
+
+	if( buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size <= buffer->size )
+	{
+		return( 1 );
+	}
+	/* Grow the data at least twofold so that a sequence of increasing
+	 * value sizes only results in a few reallocations
+	 */
+	data_size = buffer->size * 2;
+
+	if( data_size < EXPORT_BUFFER_MINIMUM_SIZE )
+	{
+		data_size = EXPORT_BUFFER_MINIMUM_SIZE;
+	}
+	if( ( data_size < size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		data_size = size;
+	}
+	/* The contents are not preserved so the data is freed
+	 * instead of reallocated to prevent a needless copy
+	 */
+	if( buffer->data != NULL )
+	{
+		memory_free(
+		 buffer->data );
+
+		buffer->data = NULL;
+		buffer->size = 0;
+	}
+	buffer->data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * data_size );
+
+	if( buffer->data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		return( -1 );
+	}
+	buffer->size = data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,69 @@
+/* 
+ * Export buffer
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_BUFFER_H )
+#define _EXPORT_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum size of the buffer data
+ */
+#define EXPORT_BUFFER_MINIMUM_SIZE		4096
+
+typedef struct export_buffer export_buffer_t;
+
+struct export_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t size;
+};
+
+int export_buffer_initialize(
+     export_buffer_t **buffer,
+     liberror_error_t **error );
+
+int export_buffer_free(
+     export_buffer_t **buffer,
+     liberror_error_t **error );
+
+int export_buffer_resize(
+     export_buffer_t *buffer,
+     size_t size,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,249 @@
+/* 
+ * Export column plan
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "export_column_plan.h"
+
+/* Initializes the column plan
+ * The known column types of the entries are set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int export_column_plan_initialize(
+     export_column_plan_t **column_plan,
+     int number_of_entries,
+     liberror_error_t **error )
+{
+	static char *function = "export_column_plan_initialize";
+	size_t entries_size   = 0;
+
+	if( column_plan == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_plan != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column plan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = sizeof( export_column_plan_entry_t ) * (size_t) number_of_entries;
+
+	if( entries_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entries size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*column_plan = memory_allocate_structure(
+	                export_column_plan_t );
+
+	if( *column_plan == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column plan.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *column_plan,
+	     0,
+	     sizeof( export_column_plan_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column plan.",
+		 function );
+
+		memory_free(
+		 *column_plan );
+
+		*column_plan = NULL;
+
+		return( -1 );
+	}
+	if( number_of_entries > 0 )
+	{
+		( *column_plan )->entries = (export_column_plan_entry_t *) memory_allocate(
+		                                                            entries_size );
+
+		if( ( *column_plan )->entries == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *column_plan )->entries,
+		     0,
+		     entries_size ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *column_plan )->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *column_plan != NULL )
+	{
+		if( ( *column_plan )->entries != NULL )
+		{
+			memory_free(
+			 ( *column_plan )->entries );
+		}
+		memory_free(
+		 *column_plan );
+
+		*column_plan = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the column plan
+ * Returns 1 if successful or -1 on error
+ */
+int export_column_plan_free(
+     export_column_plan_t **column_plan,
+     liberror_error_t **error )
+{
+	static char *function = "export_column_plan_free";
+
+	if( column_plan == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_plan != NULL )
+	{
+		if( ( *column_plan )->entries != NULL )
+		{
+			memory_free(
+			 ( *column_plan )->entries );
+		}
+		memory_free(
+		 *column_plan );
+
+		*column_plan = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets a specific entry of the column plan
+ * Returns 1 if successful or -1 on error
+ */
+int export_column_plan_set_entry(
+     export_column_plan_t *column_plan,
+     int entry_index,
+     int known_column_type,
+     uint8_t byte_order,
+     uint8_t format,
+     liberror_error_t **error )
+{
+	static char *function = "export_column_plan_set_entry";
+
+	if( column_plan == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= column_plan->number_of_entries ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	column_plan->entries[ entry_index ].known_column_type = known_column_type;
+	column_plan->entries[ entry_index ].byte_order        = byte_order;
+	column_plan->entries[ entry_index ].format            = format;
+
+	return( 1 );
+}
+
@@ -0,0 +1,86 @@
+/* 
+ * Export column plan
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_COLUMN_PLAN_H )
+#define _EXPORT_COLUMN_PLAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct export_column_plan_entry export_column_plan_entry_t;
+
+struct export_column_plan_entry
+{
+	/* The known column type
+	 */
+	int known_column_type;
+
+	/* The byte order
+	 */
+	uint8_t byte_order;
+
+	/* The format
+	 */
+	uint8_t format;
+};
+
+typedef struct export_column_plan export_column_plan_t;
+
+struct export_column_plan
+{
+	/* The entries
+	 */
+	export_column_plan_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int export_column_plan_initialize(
+     export_column_plan_t **column_plan,
+     int number_of_entries,
+     liberror_error_t **error );
+
+int export_column_plan_free(
+     export_column_plan_t **column_plan,
+     liberror_error_t **error );
+
+int export_column_plan_set_entry(
+     export_column_plan_t *column_plan,
+     int entry_index,
+     int known_column_type,
+     uint8_t byte_order,
+     uint8_t format,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -84,6 +84,7 @@
 #include "esedbtools_libfguid.h"
 #include "esedbtools_libuna.h"
 #include "export.h"
+#include "export_column_plan.h"
 #include "export_exchange.h"
 #include "export_handle.h"
 
@@ -1627,18 +1628,17 @@ int export_exchange_record_value_string(
 	return( 1 );
 }
 
-/* Exports the values in a Folders table record
+/* Determines the column plan of a Folders table from the columns of a record
  * Returns 1 if successful or -1 on error
  */
-int export_exchange_record_folders(
+int export_exchange_get_folders_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "export_exchange_record_folders";
+	static char *function   = "export_exchange_get_folders_column_plan";
 	size_t column_name_size = 0;
 	uint32_t column_type    = 0;
 	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
@@ -1658,13 +1658,13 @@ int export_exchange_record_folders(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( column_plan == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid column plan.",
 		 function );
 
 		return( -1 );
@@ -1683,6 +1683,20 @@ int export_exchange_record_folders(
 
 		return( -1 );
 	}
+	if( export_column_plan_initialize(
+	     column_plan,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column plan.",
+		 function );
+
+		return( -1 );
+	}
 	for( value_iterator = 0;
 	     value_iterator < number_of_values;
 	     value_iterator++ )
@@ -1711,7 +1725,7 @@ int export_exchange_record_folders(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -1725,7 +1739,7 @@ int export_exchange_record_folders(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libesedb_record_get_utf16_column_name(
@@ -1752,7 +1766,7 @@ int export_exchange_record_folders(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_record_get_column_type(
 		     record,
@@ -1768,7 +1782,7 @@ int export_exchange_record_folders(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
@@ -1905,115 +1919,46 @@ int export_exchange_record_folders(
 				/* TODO add support for multi value entry identifiers MN36d8 and MN36e4 */
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = export_exchange_record_value_32bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = export_exchange_record_value_64bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = export_exchange_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = export_exchange_record_value_guid(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID )
-		{
-			result = export_exchange_record_value_mapi_entryid(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
-		{
-			result = export_exchange_record_value_sid(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = export_exchange_record_value_string(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
+		if( export_column_plan_set_entry(
+		     *column_plan,
+		     value_iterator,
+		     known_column_type,
+		     byte_order,
+		     0,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column plan entry: %d.",
 			 function,
 			 value_iterator );
 
-			return( -1 );
-		}
-		if( value_iterator == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			goto on_error;
 		}
 	}
 	return( 1 );
+
+on_error:
+	export_column_plan_free(
+	 column_plan,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Exports the values in a Global table record
+/* Determines the column plan of a Global table from the columns of a record
  * Returns 1 if successful or -1 on error
  */
-int export_exchange_record_global(
+int export_exchange_get_global_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "export_exchange_record_global";
+	static char *function   = "export_exchange_get_global_column_plan";
 	size_t column_name_size = 0;
 	uint32_t column_type    = 0;
 	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
@@ -2033,13 +1978,13 @@ int export_exchange_record_global(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( column_plan == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid column plan.",
 		 function );
 
 		return( -1 );
@@ -2058,6 +2003,20 @@ int export_exchange_record_global(
 
 		return( -1 );
 	}
+	if( export_column_plan_initialize(
+	     column_plan,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column plan.",
+		 function );
+
+		return( -1 );
+	}
 	for( value_iterator = 0;
 	     value_iterator < number_of_values;
 	     value_iterator++ )
@@ -2086,7 +2045,7 @@ int export_exchange_record_global(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -2100,7 +2059,7 @@ int export_exchange_record_global(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libesedb_record_get_utf16_column_name(
@@ -2127,7 +2086,7 @@ int export_exchange_record_global(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_record_get_column_type(
 		     record,
@@ -2143,7 +2102,7 @@ int export_exchange_record_global(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
@@ -2230,116 +2189,47 @@ int export_exchange_record_global(
 				}
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_BINARY_DATA )
-		{
-			result = export_exchange_record_binary_data(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = export_exchange_record_value_32bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = export_exchange_record_value_64bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = export_exchange_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = export_exchange_record_value_guid(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_MULTI_VALUE )
-		{
-			result = export_exchange_record_value_mapi_multi_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = export_exchange_record_value_string(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
+		if( export_column_plan_set_entry(
+		     *column_plan,
+		     value_iterator,
+		     known_column_type,
+		     byte_order,
+		     0,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column plan entry: %d.",
 			 function,
 			 value_iterator );
 
-			return( -1 );
-		}
-		if( value_iterator == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			goto on_error;
 		}
 	}
 	return( 1 );
+
+on_error:
+	export_column_plan_free(
+	 column_plan,
+	 NULL );
+
+	return( -1 );
 }
 
 
-/* Exports the values in a Mailbox table record
+/* Determines the column plan of a Mailbox table from the columns of a record
  * Returns 1 if successful or -1 on error
  */
-int export_exchange_record_mailbox(
+int export_exchange_get_mailbox_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "export_exchange_record_mailbox";
+	static char *function   = "export_exchange_get_mailbox_column_plan";
 	size_t column_name_size = 0;
 	uint32_t column_type    = 0;
 	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
@@ -2359,13 +2249,13 @@ int export_exchange_record_mailbox(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( column_plan == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid column plan.",
 		 function );
 
 		return( -1 );
@@ -2384,6 +2274,20 @@ int export_exchange_record_mailbox(
 
 		return( -1 );
 	}
+	if( export_column_plan_initialize(
+	     column_plan,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column plan.",
+		 function );
+
+		return( -1 );
+	}
 	for( value_iterator = 0;
 	     value_iterator < number_of_values;
 	     value_iterator++ )
@@ -2412,7 +2316,7 @@ int export_exchange_record_mailbox(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -2426,7 +2330,7 @@ int export_exchange_record_mailbox(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libesedb_record_get_utf16_column_name(
@@ -2453,7 +2357,7 @@ int export_exchange_record_mailbox(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_record_get_column_type(
 		     record,
@@ -2469,7 +2373,7 @@ int export_exchange_record_mailbox(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
@@ -2539,107 +2443,46 @@ int export_exchange_record_mailbox(
 				}
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = export_exchange_record_value_32bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = export_exchange_record_value_64bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = export_exchange_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = export_exchange_record_value_guid(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
-		{
-			result = export_exchange_record_value_sid(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = export_exchange_record_value_string(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
+		if( export_column_plan_set_entry(
+		     *column_plan,
+		     value_iterator,
+		     known_column_type,
+		     byte_order,
+		     0,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column plan entry: %d.",
 			 function,
 			 value_iterator );
 
-			return( -1 );
-		}
-		if( value_iterator == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			goto on_error;
 		}
 	}
 	return( 1 );
+
+on_error:
+	export_column_plan_free(
+	 column_plan,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Exports the values in a Msg table record
+/* Determines the column plan of a Msg table from the columns of a record
  * Returns 1 if successful or -1 on error
  */
-int export_exchange_record_msg(
+int export_exchange_get_msg_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "export_exchange_record_msg";
+	static char *function   = "export_exchange_get_msg_column_plan";
 	size_t column_name_size = 0;
 	uint32_t column_type    = 0;
 	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
@@ -2659,13 +2502,13 @@ int export_exchange_record_msg(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( column_plan == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid column plan.",
 		 function );
 
 		return( -1 );
@@ -2684,6 +2527,20 @@ int export_exchange_record_msg(
 
 		return( -1 );
 	}
+	if( export_column_plan_initialize(
+	     column_plan,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column plan.",
+		 function );
+
+		return( -1 );
+	}
 	for( value_iterator = 0;
 	     value_iterator < number_of_values;
 	     value_iterator++ )
@@ -2712,7 +2569,7 @@ int export_exchange_record_msg(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -2726,7 +2583,7 @@ int export_exchange_record_msg(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libesedb_record_get_utf16_column_name(
@@ -2753,7 +2610,7 @@ int export_exchange_record_msg(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_record_get_column_type(
 		     record,
@@ -2769,7 +2626,7 @@ int export_exchange_record_msg(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
@@ -2832,107 +2689,46 @@ int export_exchange_record_msg(
 				}
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = export_exchange_record_value_32bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = export_exchange_record_value_64bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = export_exchange_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = export_exchange_record_value_guid(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
-		{
-			result = export_exchange_record_value_sid(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = export_exchange_record_value_string(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
+		if( export_column_plan_set_entry(
+		     *column_plan,
+		     value_iterator,
+		     known_column_type,
+		     byte_order,
+		     0,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column plan entry: %d.",
 			 function,
 			 value_iterator );
 
-			return( -1 );
-		}
-		if( value_iterator == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			goto on_error;
 		}
 	}
 	return( 1 );
+
+on_error:
+	export_column_plan_free(
+	 column_plan,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Exports the values in a PerUserRead table record
+/* Determines the column plan of a PerUserRead table from the columns of a record
  * Returns 1 if successful or -1 on error
  */
-int export_exchange_record_per_user_read(
+int export_exchange_get_per_user_read_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "export_exchange_record_per_user_read";
+	static char *function   = "export_exchange_get_per_user_read_column_plan";
 	size_t column_name_size = 0;
 	uint32_t column_type    = 0;
 	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
@@ -2952,13 +2748,13 @@ int export_exchange_record_per_user_read(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( column_plan == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid column plan.",
 		 function );
 
 		return( -1 );
@@ -2977,6 +2773,20 @@ int export_exchange_record_per_user_read(
 
 		return( -1 );
 	}
+	if( export_column_plan_initialize(
+	     column_plan,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column plan.",
+		 function );
+
+		return( -1 );
+	}
 	for( value_iterator = 0;
 	     value_iterator < number_of_values;
 	     value_iterator++ )
@@ -3005,7 +2815,7 @@ int export_exchange_record_per_user_read(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -3019,7 +2829,7 @@ int export_exchange_record_per_user_read(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libesedb_record_get_utf16_column_name(
@@ -3046,7 +2856,7 @@ int export_exchange_record_per_user_read(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_record_get_column_type(
 		     record,
@@ -3062,7 +2872,7 @@ int export_exchange_record_per_user_read(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
@@ -3115,41 +2925,204 @@ int export_exchange_record_per_user_read(
 				}
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = export_exchange_record_value_64bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = export_exchange_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
+		if( export_column_plan_set_entry(
+		     *column_plan,
+		     value_iterator,
+		     known_column_type,
+		     byte_order,
+		     0,
+		     error ) != 1 )
 		{
-			result = export_exchange_record_value_guid(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column plan entry: %d.",
+			 function,
+			 value_iterator );
+
+			goto on_error;
 		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
+	}
+	return( 1 );
+
+on_error:
+	export_column_plan_free(
+	 column_plan,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Exports the values in a Exchange table record using the column plan
+ * Returns 1 if successful or -1 on error
+ */
+int export_exchange_export_record(
+     libesedb_record_t *record,
+     export_column_plan_t *column_plan,
+     export_buffer_t *value_buffer,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     liberror_error_t **error )
+{
+	export_column_plan_entry_t *column_plan_entry = NULL;
+	static char *function                         = "export_exchange_export_record";
+	int number_of_values                          = 0;
+	int result                                    = 0;
+	int value_iterator                            = 0;
+
+	if( record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_plan == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_file_stream == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values != column_plan->number_of_entries )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of values does not match column plan.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_values;
+	     value_iterator++ )
+	{
+		column_plan_entry = &( column_plan->entries[ value_iterator ] );
+
+		switch( column_plan_entry->known_column_type )
 		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_BINARY_DATA:
+				result = export_exchange_record_binary_data(
+					  record,
+					  value_iterator,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT:
+				result = export_exchange_record_value_32bit(
+					  record,
+					  value_iterator,
+					  column_plan_entry->byte_order,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT:
+				result = export_exchange_record_value_64bit(
+					  record,
+					  value_iterator,
+					  column_plan_entry->byte_order,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME:
+				result = export_exchange_record_value_filetime(
+					  record,
+					  value_iterator,
+					  column_plan_entry->byte_order,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID:
+				result = export_exchange_record_value_guid(
+					  record,
+					  value_iterator,
+					  column_plan_entry->byte_order,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID:
+				result = export_exchange_record_value_mapi_entryid(
+					  record,
+					  value_iterator,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_MULTI_VALUE:
+				result = export_exchange_record_value_mapi_multi_value(
+					  record,
+					  value_iterator,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID:
+				result = export_exchange_record_value_sid(
+					  record,
+					  value_iterator,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING:
+				result = export_exchange_record_value_string(
+					  record,
+					  value_iterator,
+					  record_file_stream,
+					  error );
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED:
+			default:
+				result = export_handle_export_record_value(
+					  record,
+					  value_iterator,
+					  value_buffer,
+					  record_file_stream,
+					  log_handle,
+					  error );
+				break;
 		}
 		if( result != 1 )
 		{
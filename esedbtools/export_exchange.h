@@ -29,6 +29,8 @@
 #include <liberror.h>
 
 #include "esedbtools_libesedb.h"
+#include "export_buffer.h"
+#include "export_column_plan.h"
 #include "log_handle.h"
 
 #if defined( __cplusplus )
@@ -93,32 +95,35 @@ int export_exchange_record_value_string(
      FILE *record_file_stream,
      liberror_error_t **error );
 
-int export_exchange_record_folders(
+int export_exchange_get_folders_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error );
 
-int export_exchange_record_global(
+int export_exchange_get_global_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error );
 
-int export_exchange_record_mailbox(
+int export_exchange_get_mailbox_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error );
 
-int export_exchange_record_msg(
+int export_exchange_get_msg_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
+     liberror_error_t **error );
+
+int export_exchange_get_per_user_read_column_plan(
+     libesedb_record_t *record,
+     export_column_plan_t **column_plan,
      liberror_error_t **error );
 
-int export_exchange_record_per_user_read(
+int export_exchange_export_record(
      libesedb_record_t *record,
+     export_column_plan_t *column_plan,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error );
@@ -29,10 +29,12 @@
 
 #include <libsystem.h>
 
+#include "arrow_writer.h"
 #include "esedbinput.h"
 #include "esedbtools_libesedb.h"
-#include "esedbtools_libfdatetime.h"
 #include "export.h"
+#include "export_buffer.h"
+#include "export_column_plan.h"
 #include "export_exchange.h"
 #include "export_handle.h"
 #include "windows_search.h"
@@ -40,6 +42,20 @@
 
 #define EXPORT_HANDLE_NOTIFY_STREAM	stdout
 
+enum EXPORT_HANDLE_KNOWN_TABLES
+{
+	EXPORT_HANDLE_KNOWN_TABLE_UNDEFINED,
+	EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_FOLDERS,
+	EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_GLOBAL,
+	EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MAILBOX,
+	EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MSG,
+	EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_PER_USER_READ,
+	EXPORT_HANDLE_KNOWN_TABLE_SECURITY_SMTBLSECTION,
+	EXPORT_HANDLE_KNOWN_TABLE_SECURITY_SMTBLVERSION,
+	EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_0A,
+	EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_GTHR
+};
+
 /* Initializes the export handle
  * Returns 1 if successful or -1 on error
  */
@@ -112,9 +128,12 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
-	( *export_handle )->export_mode    = EXPORT_MODE_TABLES;
-	( *export_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
-	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->export_mode       = EXPORT_MODE_TABLES;
+	( *export_handle )->export_format     = EXPORT_FORMAT_TEXT;
+	( *export_handle )->access_flags      = LIBESEDB_OPEN_READ;
+	( *export_handle )->ascii_codepage    = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	( *export_handle )->number_of_threads = 1;
+	( *export_handle )->notify_stream     = EXPORT_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
@@ -165,6 +184,11 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( ( *export_handle )->input_filename != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->input_filename );
+		}
 		if( ( *export_handle )->target_path != NULL )
 		{
 			memory_free(
@@ -272,6 +296,70 @@ int export_handle_set_export_mode(
 	return( result );
 }
 
+/* Sets the export format
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     liberror_error_t **error )
+{
+	static char *function = "export_handle_set_export_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_TEXT;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "columnar" ),
+		     8 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_COLUMNAR;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
 /* Sets the ascii codepage
  * Returns 1 if successful or -1 on error
  */
@@ -313,6 +401,74 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
+/* Sets the number of threads used to export tables
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     liberror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( libsystem_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+#if !defined( HAVE_PTHREAD )
+	if( value_64bit > 1 )
+	{
+		return( 0 );
+	}
+#endif
+	export_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
 /* Sets the target path
  * Returns 1 if successful or -1 on error
  */
@@ -678,7 +834,8 @@ int export_handle_open(
      const libcstring_system_character_t *filename,
      liberror_error_t **error )
 {
-	static char *function = "export_handle_open";
+	static char *function  = "export_handle_open";
+	size_t filename_length = 0;
 
 	if( export_handle == NULL )
 	{
@@ -691,17 +848,28 @@ int export_handle_open(
 
 		return( -1 );
 	}
+	if( filename == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libesedb_file_open_wide(
 	     export_handle->input_file,
 	     filename,
-	     LIBESEDB_OPEN_READ,
+	     export_handle->access_flags,
 	     error ) != 1 )
 #else
 	if( libesedb_file_open(
 	     export_handle->input_file,
 	     filename,
-	     LIBESEDB_OPEN_READ,
+	     export_handle->access_flags,
 	     error ) != 1 )
 #endif
 	{
@@ -714,6 +882,56 @@ int export_handle_open(
 
 		return( -1 );
 	}
+	/* Keep a copy of the filename so that every thread can open its own input file
+	 */
+	if( export_handle->input_filename != NULL )
+	{
+		memory_free(
+		 export_handle->input_filename );
+
+		export_handle->input_filename      = NULL;
+		export_handle->input_filename_size = 0;
+	}
+	filename_length = libcstring_system_string_length(
+	                   filename );
+
+	export_handle->input_filename = libcstring_system_string_allocate(
+	                                 filename_length + 1 );
+
+	if( export_handle->input_filename == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_system_string_copy(
+	     export_handle->input_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy input filename.",
+		 function );
+
+		memory_free(
+		 export_handle->input_filename );
+
+		export_handle->input_filename = NULL;
+
+		return( -1 );
+	}
+	( export_handle->input_filename )[ filename_length ] = 0;
+
+	export_handle->input_filename_size = filename_length + 1;
+
 	return( 1 );
 }
 
@@ -899,20 +1117,22 @@ on_error:
 	return( -1 );
 }
 
-/* Creates a text item file
+/* Creates an item file
+ * The mode is the file stream open mode, e.g. "w" for text or "wb" for binary
  * Returns 1 if successful, 0 if the file already exists or -1 on error
  */
-int export_handle_create_text_item_file(
+int export_handle_create_item_file(
      export_handle_t *export_handle,
      const libcstring_system_character_t *item_filename,
      size_t item_filename_length,
      const libcstring_system_character_t *export_path,
      size_t export_path_length,
+     const libcstring_system_character_t *mode,
      FILE **item_file_stream,
      liberror_error_t **error )
 {
 	libcstring_system_character_t *item_filename_path = NULL;
-	static char *function                             = "export_handle_create_text_item_file";
+	static char *function                             = "export_handle_create_item_file";
 	size_t item_filename_path_size                    = 0;
 	int result                                        = 0;
 
@@ -927,6 +1147,17 @@ int export_handle_create_text_item_file(
 
 		return( -1 );
 	}
+	if( mode == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mode.",
+		 function );
+
+		return( -1 );
+	}
 	if( item_file_stream == NULL )
 	{
 		liberror_error_set(
@@ -981,7 +1212,7 @@ int export_handle_create_text_item_file(
 	}
 	*item_file_stream = libsystem_file_stream_open(
 	                     item_filename_path,
-	                     _LIBCSTRING_SYSTEM_STRING( "w" ) );
+	                     mode );
 
 	if( *item_file_stream == NULL )
 	{
@@ -995,6 +1226,15 @@ int export_handle_create_text_item_file(
 
 		goto on_error;
 	}
+	/* Use a large write buffer since the records are written in many small parts
+	 * If the buffer cannot be set the stream keeps its default buffer
+	 */
+	setvbuf(
+	 *item_file_stream,
+	 NULL,
+	 _IOFBF,
+	 EXPORT_HANDLE_ITEM_FILE_STREAM_BUFFER_SIZE );
+
 	memory_free(
 	 item_filename_path );
 
@@ -1026,7 +1266,10 @@ int export_handle_export_table(
 	libcstring_system_character_t *item_filename = NULL;
 	libcstring_system_character_t *value_string  = NULL;
 	libesedb_column_t *column                    = NULL;
+	libesedb_cursor_t *cursor                    = NULL;
 	libesedb_record_t *record                    = NULL;
+	export_buffer_t *value_buffer                = NULL;
+	export_column_plan_t *column_plan            = NULL;
 	FILE *table_file_stream                      = NULL;
 	static char *function                        = "export_handle_export_table";
 	size_t item_filename_size                    = 0;
@@ -1034,7 +1277,6 @@ int export_handle_export_table(
 	int column_iterator                          = 0;
 	int known_table                              = 0;
 	int number_of_columns                        = 0;
-	int number_of_records                        = 0;
 	int record_iterator                          = 0;
 	int result                                   = 0;
 
@@ -1060,6 +1302,19 @@ int export_handle_export_table(
 
 		return( -1 );
 	}
+	if( export_handle->export_format == EXPORT_FORMAT_COLUMNAR )
+	{
+		return( export_handle_export_table_columnar(
+		         export_handle,
+		         table,
+		         table_index,
+		         table_name,
+		         table_name_length,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_item_filename(
 	     export_handle,
 	     table_index,
@@ -1078,12 +1333,13 @@ int export_handle_export_table(
 
 		goto on_error;
 	}
-	result = export_handle_create_text_item_file(
+	result = export_handle_create_item_file(
 	          export_handle,
 	          item_filename,
 	          item_filename_size - 1,
 	          export_path,
 	          export_path_length,
+	          _LIBCSTRING_SYSTEM_STRING( "w" ),
 	          &table_file_stream,
 	          error );
 
@@ -1260,29 +1516,152 @@ int export_handle_export_table(
 			 "\t" );
 		}
 	}
+	/* Determine the table specific export once instead of for every record
+	 */
+	known_table = EXPORT_HANDLE_KNOWN_TABLE_UNDEFINED;
+
+	if( table_name_length == 3 )
+	{
+		if( libcstring_system_string_compare(
+		     table_name,
+		     _LIBCSTRING_SYSTEM_STRING( "Msg" ),
+		     3 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MSG;
+		}
+	}
+	else if( table_name_length == 6 )
+	{
+		if( libcstring_system_string_compare(
+		     table_name,
+		     _LIBCSTRING_SYSTEM_STRING( "Global" ),
+		     6 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_GLOBAL;
+		}
+	}
+	else if( table_name_length == 7 )
+	{
+		if( libcstring_system_string_compare(
+		     table_name,
+		     _LIBCSTRING_SYSTEM_STRING( "Folders" ),
+		     7 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_FOLDERS;
+		}
+		else if( libcstring_system_string_compare(
+		          table_name,
+		          _LIBCSTRING_SYSTEM_STRING( "Mailbox" ),
+		          7 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MAILBOX;
+		}
+	}
+	else if( table_name_length == 11 )
+	{
+		if( libcstring_system_string_compare(
+		     table_name,
+		     _LIBCSTRING_SYSTEM_STRING( "PerUserRead" ),
+		     11 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_PER_USER_READ;
+		}
+	}
+	else if( table_name_length == 12 )
+	{
+		if( libcstring_system_string_compare(
+		     table_name,
+		     _LIBCSTRING_SYSTEM_STRING( "SmTblSection" ),
+		     12 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_SECURITY_SMTBLSECTION;
+		}
+		else if( libcstring_system_string_compare(
+		          table_name,
+		          _LIBCSTRING_SYSTEM_STRING( "SmTblVersion" ),
+		          12 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_SECURITY_SMTBLVERSION;
+		}
+	}
+	else if( table_name_length == 14 )
+	{
+		if( libcstring_system_string_compare(
+		     table_name,
+		     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_0A" ),
+		     14 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_0A;
+		}
+	}
+	else if( table_name_length == 16 )
+	{
+		if( libcstring_system_string_compare(
+		     table_name,
+		     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_Gthr" ),
+		     16 ) == 0 )
+		{
+			known_table = EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_GTHR;
+		}
+	}
+	/* The value buffer is reused for the values of all the records
+	 */
+	if( export_buffer_initialize(
+	     &value_buffer,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value buffer.",
+		 function );
+
+		goto on_error;
+	}
 	/* Write the record (row) values to the table file
+	 * The records are read sequentially using a cursor
 	 */
-	if( libesedb_table_get_number_of_records(
+	if( libesedb_table_open_cursor(
 	     table,
-	     &number_of_records,
+	     &cursor,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open cursor.",
 		 function );
 
 		goto on_error;
 	}
 	for( record_iterator = 0;
-	     record_iterator < number_of_records;
+	     export_handle->abort == 0;
 	     record_iterator++ )
 	{
-		if( libesedb_table_get_record(
-		     table,
-		     record_iterator,
+		result = libesedb_cursor_next(
+		          cursor,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to move cursor to record: %d.",
+			 function,
+			 record_iterator );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libesedb_cursor_get_record(
+		     cursor,
 		     &record,
 		     error ) != 1 )
 		{
@@ -1296,154 +1675,129 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
-		known_table = 0;
-
-		if( table_name_length == 3 )
+		if( column_plan == NULL )
 		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Msg" ),
-			     3 ) == 0 )
+			switch( known_table )
 			{
-				known_table = 1;
+				case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_FOLDERS:
+					result = export_exchange_get_folders_column_plan(
+						  record,
+						  &column_plan,
+						  error );
+					break;
 
-				result = export_exchange_record_msg(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-		}
-		else if( table_name_length == 6 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Global" ),
-			     6 ) == 0 )
-			{
-				known_table = 1;
+				case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_GLOBAL:
+					result = export_exchange_get_global_column_plan(
+						  record,
+						  &column_plan,
+						  error );
+					break;
 
-				result = export_exchange_record_global(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-		}
-		else if( table_name_length == 7 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Folders" ),
-			     7 ) == 0 )
-			{
-				known_table = 1;
+				case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MAILBOX:
+					result = export_exchange_get_mailbox_column_plan(
+						  record,
+						  &column_plan,
+						  error );
+					break;
 
-				result = export_exchange_record_folders(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-			else if( libcstring_system_string_compare(
-			          table_name,
-			          _LIBCSTRING_SYSTEM_STRING( "Mailbox" ),
-			          7 ) == 0 )
-			{
-				known_table = 1;
+				case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MSG:
+					result = export_exchange_get_msg_column_plan(
+						  record,
+						  &column_plan,
+						  error );
+					break;
 
-				result = export_exchange_record_mailbox(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
+				case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_PER_USER_READ:
+					result = export_exchange_get_per_user_read_column_plan(
+						  record,
+						  &column_plan,
+						  error );
+					break;
+
+				case EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_0A:
+					result = windows_search_get_systemindex_0a_column_plan(
+						  record,
+						  &column_plan,
+						  error );
+					break;
+
+				case EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_GTHR:
+					result = windows_search_get_systemindex_gthr_column_plan(
+						  record,
+						  &column_plan,
+						  error );
+					break;
+
+				default:
+					result = 1;
+					break;
 			}
-		}
-		else if( table_name_length == 11 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "PerUserRead" ),
-			     11 ) == 0 )
+			if( result != 1 )
 			{
-				known_table = 1;
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine column plan.",
+				 function );
 
-				result = export_exchange_record_per_user_read(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
+				goto on_error;
 			}
 		}
-		else if( table_name_length == 12 )
+		switch( known_table )
 		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "SmTblSection" ),
-			     12 ) == 0 )
-			{
-				known_table = 1;
+			case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_FOLDERS:
+			case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_GLOBAL:
+			case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MAILBOX:
+			case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_MSG:
+			case EXPORT_HANDLE_KNOWN_TABLE_EXCHANGE_PER_USER_READ:
+				result = export_exchange_export_record(
+					  record,
+					  column_plan,
+					  value_buffer,
+					  table_file_stream,
+					  log_handle,
+					  error );
+				break;
 
+			case EXPORT_HANDLE_KNOWN_TABLE_SECURITY_SMTBLSECTION:
 				result = windows_security_export_record_smtblsection(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-			else if( libcstring_system_string_compare(
-			          table_name,
-			          _LIBCSTRING_SYSTEM_STRING( "SmTblVersion" ),
-			          12 ) == 0 )
-			{
-				known_table = 1;
+					  record,
+					  value_buffer,
+					  table_file_stream,
+					  log_handle,
+					  error );
+				break;
 
+			case EXPORT_HANDLE_KNOWN_TABLE_SECURITY_SMTBLVERSION:
 				result = windows_security_export_record_smtblversion(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-		}
-		else if( table_name_length == 14 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_0A" ),
-			     14 ) == 0 )
-			{
-				known_table = 1;
+					  record,
+					  value_buffer,
+					  table_file_stream,
+					  log_handle,
+					  error );
+				break;
 
-				result = windows_search_export_record_systemindex_0a(
-				          record,
-				          export_handle->ascii_codepage,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-		}
-		else if( table_name_length == 16 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_Gthr" ),
-			     16 ) == 0 )
-			{
-				known_table = 1;
+			case EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_0A:
+			case EXPORT_HANDLE_KNOWN_TABLE_SEARCH_SYSTEMINDEX_GTHR:
+				result = windows_search_export_record(
+					  record,
+					  column_plan,
+					  export_handle->ascii_codepage,
+					  value_buffer,
+					  table_file_stream,
+					  log_handle,
+					  error );
+				break;
 
-				result = windows_search_export_record_systemindex_gthr(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-		}
-		if( known_table == 0 )
-		{
-			result = export_handle_export_record(
-			          record,
-			          table_file_stream,
-			          log_handle,
-			          error );
+			default:
+				result = export_handle_export_record(
+					  record,
+					  value_buffer,
+					  table_file_stream,
+					  log_handle,
+					  error );
+				break;
 		}
 		if( result != 1 )
 		{
@@ -1469,10 +1823,45 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
-		if( export_handle->abort != 0 )
-		{
-			break;
-		}
+	}
+	if( export_column_plan_free(
+	     &column_plan,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free column plan.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_buffer_free(
+	     &value_buffer,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_cursor_free(
+	     &cursor,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cursor.",
+		 function );
+
+		goto on_error;
 	}
 	if( libsystem_file_stream_close(
 	     table_file_stream ) != 0 )
@@ -1516,12 +1905,30 @@ int export_handle_export_table(
 	return( 1 );
 
 on_error:
+	if( value_buffer != NULL )
+	{
+		export_buffer_free(
+		 &value_buffer,
+		 NULL );
+	}
+	if( column_plan != NULL )
+	{
+		export_column_plan_free(
+		 &column_plan,
+		 NULL );
+	}
 	if( record != NULL )
 	{
 		libesedb_record_free(
 		 &record,
 		 NULL );
 	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
 	if( value_string != NULL )
 	{
 		memory_free(
@@ -1546,12 +1953,14 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the indexes of a specific table
+/* Exports the table in the columnar format
+ * The table is written as an Apache Arrow IPC file with a typed column per table column
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_indexes(
+int export_handle_export_table_columnar(
      export_handle_t *export_handle,
      libesedb_table_t *table,
+     int table_index,
      const libcstring_system_character_t *table_name,
      size_t table_name_length,
      const libcstring_system_character_t *export_path,
@@ -1559,16 +1968,33 @@ int export_handle_export_indexes(
      log_handle_t *log_handle,
      liberror_error_t **error )
 {
-	libcstring_system_character_t *index_directory_name = NULL;
-	libcstring_system_character_t *index_name           = NULL;
-	libesedb_index_t *index                             = NULL;
-	static char *function                               = "export_handle_export_indexes";
-	size_t index_directory_name_size                    = 0;
-	size_t index_name_size                              = 0;
-	int index_iterator                                  = 0;
-	int number_of_indexes                               = 0;
-	int result                                          = 0;
+	arrow_writer_t *arrow_writer                 = NULL;
+	libcstring_system_character_t *item_filename = NULL;
+	libesedb_column_t *column                    = NULL;
+	libesedb_cursor_t *cursor                    = NULL;
+	libesedb_record_t *record                    = NULL;
+	export_buffer_t *value_buffer                = NULL;
+	FILE *table_file_stream                      = NULL;
+	static char *function                        = "export_handle_export_table_columnar";
+	size_t column_name_size                      = 0;
+	size_t item_filename_size                    = 0;
+	uint32_t column_type                         = 0;
+	int column_iterator                          = 0;
+	int number_of_columns                        = 0;
+	int record_iterator                          = 0;
+	int result                                   = 0;
+
+	if( export_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
+		return( -1 );
+	}
 	if( table == NULL )
 	{
 		liberror_error_set(
@@ -1580,426 +2006,631 @@ int export_handle_export_indexes(
 
 		return( -1 );
 	}
-	if( libsystem_path_create(
+	if( table_name == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_create_item_filename(
+	     export_handle,
+	     table_index,
 	     table_name,
 	     table_name_length,
-	     export_path,
-	     export_path_length,
-	     &index_directory_name,
-	     &index_directory_name_size,
+	     &item_filename,
+	     &item_filename_size,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create index directory.",
+		 "%s: unable to create item filename.",
 		 function );
 
 		goto on_error;
 	}
-	result = libsystem_file_exists(
-	          index_directory_name,
+	result = export_handle_create_item_file(
+	          export_handle,
+	          item_filename,
+	          item_filename_size - 1,
+	          export_path,
+	          export_path_length,
+	          _LIBCSTRING_SYSTEM_STRING( "wb" ),
+	          &table_file_stream,
 	          error );
 
 	if( result == -1 )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-		 function,
-		 index_directory_name );
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table file.",
+		 function );
 
 		goto on_error;
 	}
-	else if( result == 1 )
+	else if( result == 0 )
 	{
 		log_handle_printf(
 		 log_handle,
-		 "Skipping indexes they already exists.\n" );
+		 "Skipping table: %" PRIs_LIBCSTRING_SYSTEM " it already exists.\n",
+		 item_filename );
 
 		memory_free(
-		 index_directory_name );
+		 item_filename );
 
 		return( 1 );
 	}
-	if( libsystem_directory_make(
-	     index_directory_name,
+	memory_free(
+	 item_filename );
+
+	item_filename = NULL;
+
+	/* The value buffer is reused for the column names and the values of all the records
+	 */
+	if( export_buffer_initialize(
+	     &value_buffer,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
-		 function,
-		 index_directory_name );
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value buffer.",
+		 function );
 
 		goto on_error;
 	}
-	log_handle_printf(
-	 log_handle,
-	 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
-	 index_directory_name );
-
-	memory_free(
-	 index_directory_name );
-
-	index_directory_name = NULL;
-
-	if( libesedb_table_get_number_of_indexes(
+	if( libesedb_table_get_number_of_columns(
 	     table,
-	     &number_of_indexes,
+	     &number_of_columns,
+	     0,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of indexes.",
+		 "%s: unable to retrieve number of columns.",
 		 function );
 
 		goto on_error;
 	}
-	/* Ignore index 1 because it is a build-in index that points to the table
+	if( arrow_writer_initialize(
+	     &arrow_writer,
+	     table_file_stream,
+	     number_of_columns,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arrow writer.",
+		 function );
+
+		goto on_error;
+	}
+	/* Define the schema using the column names and types
+	 * The names are stored as UTF-8 regardless of the system character type
 	 */
-	for( index_iterator = 1;
-	     index_iterator < number_of_indexes;
-	     index_iterator++ )
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
 	{
-		if( libesedb_table_get_index(
+		if( libesedb_table_get_column(
 		     table,
-		     index_iterator,
-		     &index,
+		     column_iterator,
+		     &column,
+		     0,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve index: %d.",
+			 "%s: unable to retrieve column: %d.",
 			 function,
-			 index_iterator + 1 );
+			 column_iterator );
 
 			goto on_error;
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_index_get_utf16_name_size(
-			  index,
-			  &index_name_size,
-			  error );
-#else
-		result = libesedb_index_get_utf8_name_size(
-			  index,
-			  &index_name_size,
-			  error );
-#endif
-		if( result != 1 )
+		if( libesedb_column_get_type(
+		     column,
+		     &column_type,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the size of the index name.",
+			 "%s: unable to retrieve column type.",
 			 function );
 
 			goto on_error;
 		}
-		if( index_name_size == 0 )
+		if( libesedb_column_get_utf8_name_size(
+		     column,
+		     &column_name_size,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing index name.",
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name.",
 			 function );
 
 			goto on_error;
 		}
-		index_name = libcstring_system_string_allocate(
-		              index_name_size );
-
-		if( index_name == NULL )
+		if( column_name_size == 0 )
 		{
 			liberror_error_set(
 			 error,
-			 LIBERROR_ERROR_DOMAIN_MEMORY,
-			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create index name string.",
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column name.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_index_get_utf16_name(
-			  index,
-			  (uint16_t *) index_name,
-			  index_name_size,
-			  error );
-#else
-		result = libesedb_index_get_utf8_name(
-			  index,
-			  (uint8_t *) index_name,
-			  index_name_size,
-			  error );
-#endif
-		if( result != 1 )
+		if( export_buffer_resize(
+		     value_buffer,
+		     column_name_size,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the index name.",
+			 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value buffer.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Exporting index %d (%" PRIs_LIBCSTRING_SYSTEM ")",
-		 index_iterator + 1,
-		 index_name );
-
-		/* TODO want to change this to an export index name or refactor */
-		if( index_name == NULL )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 " out of %d",
-			 number_of_indexes );
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 ".\n" );
-
-		if( libsystem_path_sanitize_filename(
-		     index_name,
-		     &index_name_size,
+		if( libesedb_column_get_utf8_name(
+		     column,
+		     value_buffer->data,
+		     column_name_size,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable sanitize index name.",
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
 			 function );
 
 			goto on_error;
 		}
-		if( export_handle_export_index(
-		     export_handle,
-		     index,
-		     index_iterator,
-		     index_name,
-		     index_name_size - 1,
-		     export_path,
-		     export_path_length,
-		     log_handle,
+		if( arrow_writer_set_column(
+		     arrow_writer,
+		     column_iterator,
+		     value_buffer->data,
+		     column_name_size - 1,
+		     export_handle_get_columnar_type(
+		      column_type ),
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export index: %d.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column: %d.",
 			 function,
-			 index_iterator );
+			 column_iterator );
 
 			goto on_error;
 		}
-		memory_free(
-		 index_name );
-
-		index_name = NULL;
-
-		if( libesedb_index_free(
-		     &index,
+		if( libesedb_column_free(
+		     &column,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free index.",
+			 "%s: unable to free column.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	return( 1 );
-
-on_error:
-	if( index_name != NULL )
+	if( arrow_writer_write_schema(
+	     arrow_writer,
+	     error ) != 1 )
 	{
-		memory_free(
-		 index_name );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write schema.",
+		 function );
+
+		goto on_error;
 	}
-	if( index != NULL )
+	/* Append the record (row) values to the columns
+	 * The records are read sequentially using a cursor
+	 */
+	if( libesedb_table_open_cursor(
+	     table,
+	     &cursor,
+	     error ) != 1 )
 	{
-		libesedb_index_free(
-		 &index,
-		 NULL );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open cursor.",
+		 function );
+
+		goto on_error;
 	}
-	if( index_directory_name != NULL )
+	for( record_iterator = 0;
+	     export_handle->abort == 0;
+	     record_iterator++ )
 	{
-		memory_free(
-		 index_directory_name );
-	}
-	return( -1 );
-}
+		result = libesedb_cursor_next(
+		          cursor,
+		          error );
 
-/* Exports the index
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_index(
-     export_handle_t *export_handle,
-     libesedb_index_t *index,
-     int index_iterator,
-     const libcstring_system_character_t *index_name,
-     size_t index_name_length,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
-     liberror_error_t **error )
-{
-	libcstring_system_character_t *item_filename = NULL;
-	libesedb_record_t *record                    = NULL;
-	FILE *index_file_stream                      = NULL;
-	static char *function                        = "export_handle_export_index";
-	int known_index                              = 0;
-	size_t item_filename_size                    = 0;
-	int number_of_records                        = 0;
-	int record_iterator                          = 0;
-	int result                                   = 0;
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to move cursor to record: %d.",
+			 function,
+			 record_iterator );
 
-	if( index == NULL )
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libesedb_cursor_get_record(
+		     cursor,
+		     &record,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_iterator );
+
+			goto on_error;
+		}
+		if( export_handle_export_record_columnar(
+		     record,
+		     value_buffer,
+		     arrow_writer,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The file is also finalized on abort so that the exported rows remain readable
+	 */
+	if( arrow_writer_finalize(
+	     arrow_writer,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid index.",
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to finalize arrow writer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( index_name == NULL )
+	if( arrow_writer_free(
+	     &arrow_writer,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid index name.",
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free arrow writer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( export_handle_create_item_filename(
-	     export_handle,
-	     index_iterator,
-	     index_name,
-	     index_name_length,
-	     &item_filename,
-	     &item_filename_size,
+	if( export_buffer_free(
+	     &value_buffer,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item filename.",
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value buffer.",
 		 function );
 
 		goto on_error;
 	}
-	result = export_handle_create_text_item_file(
-	          export_handle,
-	          item_filename,
-	          item_filename_size - 1,
-	          export_path,
-	          export_path_length,
-	          &index_file_stream,
-	          error );
-
-	if( result == -1 )
+	if( libesedb_cursor_free(
+	     &cursor,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create index file.",
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cursor.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result == 0 )
+	if( libsystem_file_stream_close(
+	     table_file_stream ) != 0 )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping index: %" PRIs_LIBCSTRING_SYSTEM " it already exists.\n",
-		 item_filename );
-
-		memory_free(
-		 item_filename );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close table file.",
+		 function );
+
+		goto on_error;
+	}
+	table_file_stream = NULL;
+
+	/* The indexes are exported in the text format
+	 */
+	if( export_handle->abort == 0 )
+	{
+		if( export_handle->export_mode != EXPORT_MODE_TABLES )
+		{
+			if( export_handle_export_indexes(
+			     export_handle,
+			     table,
+			     table_name,
+			     table_name_length,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export indexes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	if( value_buffer != NULL )
+	{
+		export_buffer_free(
+		 &value_buffer,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( table_file_stream != NULL )
+	{
+		libsystem_file_stream_close(
+		 table_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	return( -1 );
+}
+
+/* Exports the indexes of a specific table
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_indexes(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     const libcstring_system_character_t *table_name,
+     size_t table_name_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     liberror_error_t **error )
+{
+	libcstring_system_character_t *index_directory_name = NULL;
+	libcstring_system_character_t *index_name           = NULL;
+	libesedb_index_t *index                             = NULL;
+	static char *function                               = "export_handle_export_indexes";
+	size_t index_directory_name_size                    = 0;
+	size_t index_name_size                              = 0;
+	int index_iterator                                  = 0;
+	int number_of_indexes                               = 0;
+	int result                                          = 0;
+
+	if( table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsystem_path_create(
+	     table_name,
+	     table_name_length,
+	     export_path,
+	     export_path_length,
+	     &index_directory_name,
+	     &index_directory_name_size,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index directory.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsystem_file_exists(
+	          index_directory_name,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+		 function,
+		 index_directory_name );
+
+		goto on_error;
+	}
+	else if( result == 1 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping indexes they already exists.\n" );
+
+		memory_free(
+		 index_directory_name );
 
 		return( 1 );
 	}
+	if( libsystem_directory_make(
+	     index_directory_name,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 index_directory_name );
+
+		goto on_error;
+	}
+	log_handle_printf(
+	 log_handle,
+	 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+	 index_directory_name );
+
 	memory_free(
-	 item_filename );
+	 index_directory_name );
 
-	item_filename = NULL;
+	index_directory_name = NULL;
 
-#ifdef TODO
-	/* Write the column names to the index file
-	 */
-	if( libesedb_index_get_number_of_columns(
-	     index,
-	     &number_of_columns,
-	     0,
+	if( libesedb_table_get_number_of_indexes(
+	     table,
+	     &number_of_indexes,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of columns.",
+		 "%s: unable to retrieve number of indexes.",
 		 function );
 
 		goto on_error;
 	}
-	for( column_iterator = 0;
-	     column_iterator < number_of_columns;
-	     column_iterator++ )
+	/* Ignore index 1 because it is a build-in index that points to the table
+	 */
+	for( index_iterator = 1;
+	     index_iterator < number_of_indexes;
+	     index_iterator++ )
 	{
-		if( libesedb_index_get_column(
-		     index,
-		     column_iterator,
-		     &column,
-		     0,
+		if( libesedb_table_get_index(
+		     table,
+		     index_iterator,
+		     &index,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column: %d.",
+			 "%s: unable to retrieve index: %d.",
 			 function,
-			 column_iterator );
+			 index_iterator + 1 );
 
 			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_column_get_utf16_name_size(
-		          column,
-		          &value_string_size,
-		          error );
+		result = libesedb_index_get_utf16_name_size(
+			  index,
+			  &index_name_size,
+			  error );
 #else
-		result = libesedb_column_get_utf8_name_size(
-		          column,
-		          &value_string_size,
-		          error );
+		result = libesedb_index_get_utf8_name_size(
+			  index,
+			  &index_name_size,
+			  error );
 #endif
 		if( result != 1 )
 		{
@@ -2007,48 +2638,48 @@ int export_handle_export_index(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the size of the column name.",
+			 "%s: unable to retrieve the size of the index name.",
 			 function );
 
 			goto on_error;
 		}
-		if( value_string_size == 0 )
+		if( index_name_size == 0 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing column name.",
+			 "%s: missing index name.",
 			 function );
 
 			goto on_error;
 		}
-		value_string = libcstring_system_string_allocate(
-		                value_string_size );
+		index_name = libcstring_system_string_allocate(
+		              index_name_size );
 
-		if( value_string == NULL )
+		if( index_name == NULL )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_MEMORY,
 			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create column name string.",
+			 "%s: unable to create index name string.",
 			 function );
 
 			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_column_get_utf16_name(
-		          column,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
+		result = libesedb_index_get_utf16_name(
+			  index,
+			  (uint16_t *) index_name,
+			  index_name_size,
+			  error );
 #else
-		result = libesedb_column_get_utf8_name(
-		          column,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
+		result = libesedb_index_get_utf8_name(
+			  index,
+			  (uint8_t *) index_name,
+			  index_name_size,
+			  error );
 #endif
 		if( result != 1 )
 		{
@@ -2056,1335 +2687,2767 @@ int export_handle_export_index(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the column name.",
+			 "%s: unable to retrieve the index name.",
 			 function );
 
 			goto on_error;
 		}
 		fprintf(
-		 index_file_stream,
-		 "%" PRIs_LIBCSTRING_SYSTEM "",
-		 value_string );
-
-		memory_free(
-		 value_string );
+		 export_handle->notify_stream,
+		 "Exporting index %d (%" PRIs_LIBCSTRING_SYSTEM ")",
+		 index_iterator + 1,
+		 index_name );
 
-		value_string = NULL;
+		/* TODO want to change this to an export index name or refactor */
+		if( index_name == NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 " out of %d",
+			 number_of_indexes );
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 ".\n" );
 
-		if( libesedb_column_free(
-		     &column,
+		if( libsystem_path_sanitize_filename(
+		     index_name,
+		     &index_name_size,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free column.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable sanitize index name.",
 			 function );
 
 			goto on_error;
 		}
-		if( column_iterator == ( number_of_columns - 1 ) )
-		{
-			fprintf(
-			 index_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 index_file_stream,
-			 "\t" );
-		}
-	}
-#endif
-	/* Write the record (row) values to the index file
-	 */
-	if( libesedb_index_get_number_of_records(
-	     index,
-	     &number_of_records,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
-		 function );
-
-		goto on_error;
-	}
-	for( record_iterator = 0;
-	     record_iterator < number_of_records;
-	     record_iterator++ )
-	{
-		if( libesedb_index_get_record(
+		if( export_handle_export_index(
+		     export_handle,
 		     index,
-		     record_iterator,
-		     &record,
+		     index_iterator,
+		     index_name,
+		     index_name_size - 1,
+		     export_path,
+		     export_path_length,
+		     log_handle,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export index: %d.",
 			 function,
-			 record_iterator );
+			 index_iterator );
 
 			goto on_error;
 		}
-		known_index = 0;
+		memory_free(
+		 index_name );
 
-		if( known_index == 0 )
-		{
-			result = export_handle_export_record(
-			          record,
-			          index_file_stream,
-			          log_handle,
-			          error );
-		}
-		if( result != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record.",
-			 function );
+		index_name = NULL;
 
-			goto on_error;
-		}
-		if( libesedb_record_free(
-		     &record,
+		if( libesedb_index_free(
+		     &index,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record.",
+			 "%s: unable to free index.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( libsystem_file_stream_close(
-	     index_file_stream ) != 0 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close index file.",
-		 function );
-
-		goto on_error;
-	}
-	index_file_stream = NULL;
-
 	return( 1 );
 
 on_error:
-	if( record != NULL )
-	{
-		libesedb_record_free(
-		 &record,
-		 NULL );
-	}
-#ifdef TODO
-	if( value_string != NULL )
+	if( index_name != NULL )
 	{
 		memory_free(
-		 value_string );
+		 index_name );
 	}
-	if( column != NULL )
+	if( index != NULL )
 	{
-		libesedb_column_free(
-		 &column,
+		libesedb_index_free(
+		 &index,
 		 NULL );
 	}
-#endif
-	if( index_file_stream != NULL )
-	{
-		libsystem_file_stream_close(
-		 index_file_stream );
-	}
-	if( item_filename != NULL )
+	if( index_directory_name != NULL )
 	{
 		memory_free(
-		 item_filename );
+		 index_directory_name );
 	}
 	return( -1 );
 }
 
-/* Exports the values in a record
+/* Exports the index
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_record(
-     libesedb_record_t *record,
-     FILE *record_file_stream,
+int export_handle_export_index(
+     export_handle_t *export_handle,
+     libesedb_index_t *index,
+     int index_iterator,
+     const libcstring_system_character_t *index_name,
+     size_t index_name_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
      log_handle_t *log_handle,
      liberror_error_t **error )
 {
-	static char *function = "export_handle_export_record";
-	int number_of_values  = 0;
-	int value_iterator    = 0;
+	libcstring_system_character_t *item_filename = NULL;
+	libesedb_record_t *record                    = NULL;
+	export_buffer_t *value_buffer                = NULL;
+	FILE *index_file_stream                      = NULL;
+	static char *function                        = "export_handle_export_index";
+	int known_index                              = 0;
+	size_t item_filename_size                    = 0;
+	int number_of_records                        = 0;
+	int record_iterator                          = 0;
+	int result                                   = 0;
 
-	if( record == NULL )
+	if( index == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid index.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( index_name == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid index name.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_record_get_number_of_values(
-	     record,
-	     &number_of_values,
+	if( export_handle_create_item_filename(
+	     export_handle,
+	     index_iterator,
+	     index_name,
+	     index_name_length,
+	     &item_filename,
+	     &item_filename_size,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( value_iterator = 0;
-	     value_iterator < number_of_values;
-	     value_iterator++ )
+	result = export_handle_create_item_file(
+	          export_handle,
+	          item_filename,
+	          item_filename_size - 1,
+	          export_path,
+	          export_path_length,
+	          _LIBCSTRING_SYSTEM_STRING( "w" ),
+	          &index_file_stream,
+	          error );
+
+	if( result == -1 )
 	{
-		if( export_handle_export_record_value(
-		     record,
-		     value_iterator,
-		     record_file_stream,
-		     log_handle,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
-			 function,
-			 value_iterator );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file.",
+		 function );
 
-			return( -1 );
-		}
-		if( value_iterator == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
-		}
+		goto on_error;
 	}
-	return( 1 );
-}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping index: %" PRIs_LIBCSTRING_SYSTEM " it already exists.\n",
+		 item_filename );
 
-/* Exports a record value
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_record_value(
-     libesedb_record_t *record,
-     int record_value_entry,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
-     liberror_error_t **error )
-{
-	libcstring_system_character_t filetime_string[ 32 ];
+		memory_free(
+		 item_filename );
 
-	libcstring_system_character_t *value_string = NULL;
-        libesedb_long_value_t *long_value           = NULL;
-        libesedb_multi_value_t *multi_value         = NULL;
-	libfdatetime_filetime_t *filetime           = NULL;
-	uint8_t *binary_data                        = NULL;
-	uint8_t *value_data                         = NULL;
-	static char *function                       = "export_handle_export_record_value";
-	size_t binary_data_size                     = 0;
-	size_t value_data_size                      = 0;
-	size_t value_string_size                    = 0;
-	double value_double                         = 0.0;
-	float value_float                           = 0.0;
-	uint64_t value_64bit                        = 0;
-	uint32_t column_identifier                  = 0;
-	uint32_t column_type                        = 0;
-	uint32_t value_32bit                        = 0;
-	uint16_t value_16bit                        = 0;
-	uint8_t value_8bit                          = 0;
-	uint8_t value_flags                         = 0;
-	int long_value_segment_iterator             = 0;
-	int multi_value_iterator                    = 0;
-	int number_of_long_value_segments           = 0;
-	int number_of_multi_values                  = 0;
-	int result                                  = 0;
+		return( 1 );
+	}
+	memory_free(
+	 item_filename );
 
-	if( record == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
+	item_filename = NULL;
 
-		return( -1 );
-	}
-	if( record_file_stream == NULL )
+#ifdef TODO
+	/* Write the column names to the index file
+	 */
+	if( libesedb_index_get_number_of_columns(
+	     index,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libesedb_record_get_column_identifier(
-	     record,
-	     record_value_entry,
-	     &column_identifier,
-	     error ) != 1 )
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
 	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve column identifier of value: %d.",
-		 function,
-		 record_value_entry );
+		if( libesedb_index_get_column(
+		     index,
+		     column_iterator,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_iterator );
 
-		return( -1 );
+			goto on_error;
+		}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_column_get_utf16_name_size(
+		          column,
+		          &value_string_size,
+		          error );
+#else
+		result = libesedb_column_get_utf8_name_size(
+		          column,
+		          &value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_string_size == 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column name.",
+			 function );
+
+			goto on_error;
+		}
+		value_string = libcstring_system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column name string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_column_get_utf16_name(
+		          column,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libesedb_column_get_utf8_name(
+		          column,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 index_file_stream,
+		 "%" PRIs_LIBCSTRING_SYSTEM "",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+		if( column_iterator == ( number_of_columns - 1 ) )
+		{
+			fprintf(
+			 index_file_stream,
+			 "\n" );
+		}
+		else
+		{
+			fprintf(
+			 index_file_stream,
+			 "\t" );
+		}
 	}
-	if( libesedb_record_get_column_type(
-	     record,
-	     record_value_entry,
-	     &column_type,
+#endif
+	/* Write the record (row) values to the index file
+	 */
+	if( libesedb_index_get_number_of_records(
+	     index,
+	     &number_of_records,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve column type of value: %d.",
-		 function,
-		 record_value_entry );
+		 "%s: unable to retrieve number of records.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libesedb_record_get_value(
-	     record,
-	     record_value_entry,
-	     &value_data,
-	     &value_data_size,
-	     &value_flags,
+	if( export_buffer_initialize(
+	     &value_buffer,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d.",
-		 function,
-		 record_value_entry );
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value buffer.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( value_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE ) ) == 0 )
+	for( record_iterator = 0;
+	     record_iterator < number_of_records;
+	     record_iterator++ )
 	{
-		switch( column_type )
+		if( libesedb_index_get_record(
+		     index,
+		     record_iterator,
+		     &record,
+		     error ) != 1 )
 		{
-			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-				result = libesedb_record_get_value_boolean(
-					  record,
-					  record_value_entry,
-					  &value_8bit,
-					  error );
-
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_iterator );
+
+			goto on_error;
+		}
+		known_index = 0;
+
+		if( known_index == 0 )
+		{
+			result = export_handle_export_record(
+			          record,
+			          value_buffer,
+			          index_file_stream,
+			          log_handle,
+			          error );
+		}
+		if( result != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_buffer_free(
+	     &value_buffer,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsystem_file_stream_close(
+	     index_file_stream ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( value_buffer != NULL )
+	{
+		export_buffer_free(
+		 &value_buffer,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+#ifdef TODO
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+#endif
+	if( index_file_stream != NULL )
+	{
+		libsystem_file_stream_close(
+		 index_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	return( -1 );
+}
+
+/* Exports the values in a record
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record(
+     libesedb_record_t *record,
+     export_buffer_t *value_buffer,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     liberror_error_t **error )
+{
+	static char *function = "export_handle_export_record";
+	int number_of_values  = 0;
+	int value_iterator    = 0;
+
+	if( record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_file_stream == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_values;
+	     value_iterator++ )
+	{
+		if( export_handle_export_record_value(
+		     record,
+		     value_iterator,
+		     value_buffer,
+		     record_file_stream,
+		     log_handle,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record value: %d.",
+			 function,
+			 value_iterator );
+
+			return( -1 );
+		}
+		if( value_iterator == ( number_of_values - 1 ) )
+		{
+			fputc(
+			 '\n',
+			 record_file_stream );
+		}
+		else
+		{
+			fputc(
+			 '\t',
+			 record_file_stream );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports a record value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_value(
+     libesedb_record_t *record,
+     int record_value_entry,
+     export_buffer_t *value_buffer,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     liberror_error_t **error )
+{
+	libcstring_system_character_t *value_string = NULL;
+        libesedb_long_value_t *long_value           = NULL;
+        libesedb_multi_value_t *multi_value         = NULL;
+	uint8_t *value_data                         = NULL;
+	static char *function                       = "export_handle_export_record_value";
+	size_t binary_data_size                     = 0;
+	size_t value_data_size                      = 0;
+	size_t value_string_size                    = 0;
+	double value_double                         = 0.0;
+	float value_float                           = 0.0;
+	uint64_t value_64bit                        = 0;
+	uint32_t column_identifier                  = 0;
+	uint32_t column_type                        = 0;
+	uint32_t value_32bit                        = 0;
+	uint16_t value_16bit                        = 0;
+	uint8_t value_8bit                          = 0;
+	uint8_t value_flags                         = 0;
+	int long_value_segment_iterator             = 0;
+	int multi_value_iterator                    = 0;
+	int number_of_long_value_segments           = 0;
+	int number_of_multi_values                  = 0;
+	int result                                  = 0;
+
+	if( record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_file_stream == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_column_identifier(
+	     record,
+	     record_value_entry,
+	     &column_identifier,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column identifier of value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_column_type(
+	     record,
+	     record_value_entry,
+	     &column_type,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column type of value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_value(
+	     record,
+	     record_value_entry,
+	     &value_data,
+	     &value_data_size,
+	     &value_flags,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( ( value_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE ) ) == 0 )
+	{
+		switch( column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				result = libesedb_record_get_value_boolean(
+					  record,
+					  record_value_entry,
+					  &value_8bit,
+					  error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve boolean value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					if( value_8bit == 0 )
+					{
+						file_stream_write(
+						 record_file_stream,
+						 "false",
+						 5 );
+					}
+					else
+					{
+						file_stream_write(
+						 record_file_stream,
+						 "true",
+						 4 );
+					}
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				result = libesedb_record_get_value_8bit(
+					  record,
+					  record_value_entry,
+					  &value_8bit,
+					  error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve 8-bit value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					export_unsigned_integer(
+					 (uint64_t) value_8bit,
+					 record_file_stream );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				result = libesedb_record_get_value_16bit(
+					  record,
+					  record_value_entry,
+					  &value_16bit,
+					  error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve 16-bit value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+					{
+						export_signed_integer(
+						 (int64_t) ( (int16_t) value_16bit ),
+						 record_file_stream );
+					}
+					else
+					{
+						export_unsigned_integer(
+						 (uint64_t) value_16bit,
+						 record_file_stream );
+					}
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				result = libesedb_record_get_value_32bit(
+					  record,
+					  record_value_entry,
+					  &value_32bit,
+					  error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve 32-bit value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+					{
+						export_signed_integer(
+						 (int64_t) ( (int32_t) value_32bit ),
+						 record_file_stream );
+					}
+					else
+					{
+						export_unsigned_integer(
+						 (uint64_t) value_32bit,
+						 record_file_stream );
+					}
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				result = libesedb_record_get_value_64bit(
+					  record,
+					  record_value_entry,
+					  &value_64bit,
+					  error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve 64-bit value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED )
+					{ 
+						export_signed_integer(
+						 (int64_t) value_64bit,
+						 record_file_stream );
+					}
+					else
+					{
+						export_unsigned_integer(
+						 value_64bit,
+						 record_file_stream );
+					}
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				result = libesedb_record_get_value_filetime(
+					  record,
+					  record_value_entry,
+					  &value_64bit,
+					  error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve filetime value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					export_filetime(
+					 value_64bit,
+					 record_file_stream );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				result = libesedb_record_get_value_floating_point_32bit(
+				          record,
+				          record_value_entry,
+				          &value_float,
+				          error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve single precision floating point value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					fprintf(
+					 record_file_stream,
+					 "%f",
+					 value_float );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				result = libesedb_record_get_value_floating_point_64bit(
+				          record,
+				          record_value_entry,
+				          &value_double,
+				          error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve double precision floating point value: %d.",
+					 function,
+					 record_value_entry );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					fprintf(
+					 record_file_stream,
+					 "%f",
+					 value_double );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_TEXT:
+			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libesedb_record_get_value_utf16_string_size(
+					  record,
+					  record_value_entry,
+					  &value_string_size,
+					  error );
+#else
+				result = libesedb_record_get_value_utf8_string_size(
+					  record,
+					  record_value_entry,
+					  &value_string_size,
+					  error );
+#endif
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve size of value string: %d (%" PRIu32 ").",
+					 function,
+					 record_value_entry,
+					 column_identifier );
+
+					return( -1 );
+				}
+				if( result != 0 )
+				{
+					if( value_string_size == 0 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing value string.",
+						 function );
+
+						return( -1 );
+					}
+					if( export_buffer_resize(
+					     value_buffer,
+					     sizeof( libcstring_system_character_t ) * value_string_size,
+					     error ) != 1 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize value buffer.",
+						 function );
+
+						return( -1 );
+					}
+					value_string = (libcstring_system_character_t *) value_buffer->data;
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+					result = libesedb_record_get_value_utf16_string(
+					          record,
+					          record_value_entry,
+					          (uint16_t *) value_string,
+					          value_string_size,
+					          error );
+#else
+					result = libesedb_record_get_value_utf8_string(
+					          record,
+					          record_value_entry,
+					          (uint8_t *) value_string,
+					          value_string_size,
+					          error );
+#endif
+					if( result != 1 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve value string: %d.",
+						 function,
+						 record_value_entry );
+
+						return( -1 );
+					}
+					export_text(
+					 value_string,
+					 value_string_size,
+					 record_file_stream );
+				}
+				break;
+
+			default:
+				export_binary_data(
+				 value_data,
+				 value_data_size,
+				 record_file_stream );
+
+				break;
+		}
+	}
+	else if( ( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	      && ( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+	{
+		switch( column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libesedb_record_get_value_utf16_string_size(
+					  record,
+					  record_value_entry,
+					  &value_string_size,
+					  error );
+#else
+				result = libesedb_record_get_value_utf8_string_size(
+					  record,
+					  record_value_entry,
+					  &value_string_size,
+					  error );
+#endif
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve size of value string: %d (%" PRIu32 ").",
+					 function,
+					 record_value_entry,
+					 column_identifier );
+
+					return( -1 );
+				}
+				if( result != 0 )
+				{
+					if( value_string_size == 0 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing value string.",
+						 function );
+
+						return( -1 );
+					}
+					if( export_buffer_resize(
+					     value_buffer,
+					     sizeof( libcstring_system_character_t ) * value_string_size,
+					     error ) != 1 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize value buffer.",
+						 function );
+
+						return( -1 );
+					}
+					value_string = (libcstring_system_character_t *) value_buffer->data;
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+					result = libesedb_record_get_value_utf16_string(
+					          record,
+					          record_value_entry,
+					          (uint16_t *) value_string,
+					          value_string_size,
+					          error );
+#else
+					result = libesedb_record_get_value_utf8_string(
+					          record,
+					          record_value_entry,
+					          (uint8_t *) value_string,
+					          value_string_size,
+					          error );
+#endif
+					if( result != 1 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve value string: %d.",
+						 function,
+						 record_value_entry );
+
+						return( -1 );
+					}
+					export_text(
+					 value_string,
+					 value_string_size,
+					 record_file_stream );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+				result = libesedb_record_get_value_binary_data_size(
+					  record,
+					  record_value_entry,
+					  &binary_data_size,
+					  error );
+
+				if( result == -1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve size of binary data: %d (%" PRIu32 ").",
+					 function,
+					 record_value_entry,
+					 column_identifier );
+
+					return( -1 );
+				}
+				if( result != 0 )
+				{
+					if( binary_data_size == 0 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing binary data.",
+						 function );
+
+						return( -1 );
+					}
+					if( export_buffer_resize(
+					     value_buffer,
+					     binary_data_size,
+					     error ) != 1 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize value buffer.",
+						 function );
+
+						return( -1 );
+					}
+					result = libesedb_record_get_value_binary_data(
+					          record,
+					          record_value_entry,
+					          value_buffer->data,
+					          binary_data_size,
+					          error );
+
+					if( result != 1 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve binary data: %d.",
+						 function,
+						 record_value_entry );
+
+						return( -1 );
+					}
+					export_binary_data(
+					 value_buffer->data,
+					 binary_data_size,
+					 record_file_stream );
+				}
+				break;
+
+			default:
+				export_binary_data(
+				 value_data,
+				 value_data_size,
+				 record_file_stream );
+
+				break;
+		}
+	}
+	else if( ( ( value_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	      && ( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+	{
+		result = libesedb_record_get_long_value(
+		          record,
+		          record_value_entry,
+		          &long_value,
+		          error );
+
+		if( result != 1 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Unable to retrieve long value of record entry: %d.\n",
+			 record_value_entry );
+
+			if( libsystem_notify_verbose != 0 )
+			{
+				libsystem_notify_printf(
+				 "%s: unable to retrieve long value of record entry: %d.",
+				 function,
+				 record_value_entry );
+			}
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value of record entry: %d.",
+			 function,
+			 record_value_entry );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libsystem_notify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			liberror_error_free(
+			 error );
+		}
+		else
+		{
+			if( libesedb_long_value_get_number_of_segments(
+			     long_value,
+			     &number_of_long_value_segments,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of long value segments.",
+				 function );
+
+				libesedb_long_value_free(
+				 &long_value,
+				 NULL );
+
+				return( -1 );
+			}
+			for( long_value_segment_iterator = 0;
+			     long_value_segment_iterator < number_of_long_value_segments;
+			     long_value_segment_iterator++ )
+			{
+				if( libesedb_long_value_get_segment_data(
+				     long_value,
+				     long_value_segment_iterator,
+				     &value_data,
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve boolean value: %d.",
+					 "%s: unable to retrieve long value segment: %d of record entry: %d.",
 					 function,
+					 long_value_segment_iterator,
 					 record_value_entry );
 
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					if( value_8bit == 0 )
-					{
-						fprintf(
-						 record_file_stream,
-						 "false" );
+					libesedb_long_value_free(
+					 &long_value,
+					 NULL );
+
+					return( -1 );
+				}
+				if( value_data != NULL )
+				{
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( LONG_VALUE_TEST )
+libsystem_notify_printf(
+ "LONG VALUE DATA: %d out of %d\n",
+ long_value_segment_iterator + 1,
+ number_of_long_value_segments );
+libsystem_notify_print_data(
+ value_data,
+ value_data_size );
+#endif
+				}
+			}
+			if( libesedb_long_value_free(
+			     &long_value,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long value.",
+				 function );
+
+				return( -1 );
+			}
+
+			if( libesedb_long_value_free(
+			     &long_value,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	/* TODO handle 0x10 flags */
+	else if( ( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	      && ( ( value_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) == 0 )
+	      && ( ( value_flags & 0x10 ) == 0 ) )
+	{
+		/* TODO what about non string multi values ?
+		 */
+		if( libesedb_record_get_multi_value(
+		     record,
+		     record_value_entry,
+		     &multi_value,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve multi value of record entry: %d.",
+			 function,
+			 record_value_entry );
+
+			return( -1 );
+		}
+		if( libesedb_multi_value_get_number_of_values(
+		     multi_value,
+		     &number_of_multi_values,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of multi values.",
+			 function );
+
+			libesedb_multi_value_free(
+			 &multi_value,
+			 NULL );
+
+			return( -1 );
+		}
+		for( multi_value_iterator = 0;
+	 	     multi_value_iterator < number_of_multi_values;
+		     multi_value_iterator++ )
+		{
+			if( libesedb_multi_value_get_value(
+			     multi_value,
+			     multi_value_iterator,
+			     &column_type,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve multi value: %d of record entry: %d.",
+				 function,
+				 multi_value_iterator,
+				 record_value_entry );
+
+				return( -1 );
+			}
+			if( value_data != NULL )
+			{
+				if( ( column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+				 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+				{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+					result = libesedb_multi_value_get_value_utf16_string_size(
+						  multi_value,
+						  multi_value_iterator,
+						  &value_string_size,
+						  error );
+#else
+					result = libesedb_multi_value_get_value_utf8_string_size(
+						  multi_value,
+						  multi_value_iterator,
+						  &value_string_size,
+						  error );
+#endif
+
+					if( result == -1 )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve size of string of multi value: %d of record entry: %d (%" PRIu32 ").",
+						 function,
+						 multi_value_iterator,
+						 record_value_entry,
+						 column_identifier );
+
+						libesedb_multi_value_free(
+						 &multi_value,
+						 NULL );
+
+						return( -1 );
 					}
-					else
+					else if( result != 0 )
 					{
-						fprintf(
-						 record_file_stream,
-						 "true" );
-					}
-				}
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-				result = libesedb_record_get_value_8bit(
-					  record,
-					  record_value_entry,
-					  &value_8bit,
-					  error );
+						if( export_buffer_resize(
+						     value_buffer,
+						     sizeof( libcstring_system_character_t ) * value_string_size,
+						     error ) != 1 )
+						{
+							liberror_error_set(
+							 error,
+							 LIBERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+							 "%s: unable to resize value buffer.",
+							 function );
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve 8-bit value: %d.",
-					 function,
-					 record_value_entry );
+							libesedb_multi_value_free(
+							 &multi_value,
+							 NULL );
 
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu8 "",
-					 value_8bit );
-				}
-				break;
+							return( -1 );
+						}
+						value_string = (libcstring_system_character_t *) value_buffer->data;
 
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-				result = libesedb_record_get_value_16bit(
-					  record,
-					  record_value_entry,
-					  &value_16bit,
-					  error );
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+						result = libesedb_multi_value_get_value_utf16_string(
+						          multi_value,
+						          multi_value_iterator,
+						          (uint16_t *) value_string,
+						          value_string_size,
+						          error );
+#else
+						result = libesedb_multi_value_get_value_utf8_string(
+						          multi_value,
+						          multi_value_iterator,
+						          (uint8_t *) value_string,
+						          value_string_size,
+						          error );
+#endif
+						if( result != 1 )
+						{
+							liberror_error_set(
+							 error,
+							 LIBERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve string of multi value: %d of record entry: %d.",
+							 function,
+							 multi_value_iterator,
+							 record_value_entry );
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve 16-bit value: %d.",
-					 function,
-					 record_value_entry );
+							libesedb_multi_value_free(
+							 &multi_value,
+							 NULL );
 
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
-					{
-						fprintf(
-						 record_file_stream,
-						 "%" PRIi16 "",
-						 (int16_t) value_16bit );
+							return( -1 );
+						}
+						export_text(
+						 value_string,
+						 value_string_size,
+						 record_file_stream );
 					}
-					else
+					if( multi_value_iterator < ( number_of_multi_values - 1 ) )
 					{
-						fprintf(
+						file_stream_write(
 						 record_file_stream,
-						 "%" PRIu16 "",
-						 value_16bit );
+						 "; ",
+						 2 );
 					}
 				}
-				break;
+				else
+				{
+					export_binary_data(
+					 value_data,
+					 value_data_size,
+					 record_file_stream );
+				}
+			}
+		}
+		if( libesedb_multi_value_free(
+		     &multi_value,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free multi value: %d.",
+			 function,
+			 multi_value_iterator );
 
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-				result = libesedb_record_get_value_32bit(
-					  record,
-					  record_value_entry,
-					  &value_32bit,
-					  error );
+			return( -1 );
+		}
+	}
+	else
+	{
+		export_binary_data(
+		 value_data,
+		 value_data_size,
+		 record_file_stream );
+	}
+	return( 1 );
+}
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve 32-bit value: %d.",
-					 function,
-					 record_value_entry );
+/* Determines the columnar type of a column type
+ * Returns the arrow writer column type
+ */
+int export_handle_get_columnar_type(
+     uint32_t column_type )
+{
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			return( ARROW_WRITER_COLUMN_TYPE_BOOLEAN );
 
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
-					{
-						fprintf(
-						 record_file_stream,
-						 "%" PRIi32 "",
-						 (int32_t) value_32bit );
-					}
-					else
-					{
-						fprintf(
-						 record_file_stream,
-						 "%" PRIu32 "",
-						 value_32bit );
-					}
-				}
-				break;
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			return( ARROW_WRITER_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED );
 
-			case LIBESEDB_COLUMN_TYPE_CURRENCY:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-				result = libesedb_record_get_value_64bit(
-					  record,
-					  record_value_entry,
-					  &value_64bit,
-					  error );
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			return( ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_SIGNED );
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve 64-bit value: %d.",
-					 function,
-					 record_value_entry );
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			return( ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED );
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			return( ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_SIGNED );
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			return( ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED );
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			return( ARROW_WRITER_COLUMN_TYPE_INTEGER_64BIT_SIGNED );
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			return( ARROW_WRITER_COLUMN_TYPE_FLOAT_32BIT );
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			return( ARROW_WRITER_COLUMN_TYPE_FLOAT_64BIT );
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			return( ARROW_WRITER_COLUMN_TYPE_TIMESTAMP );
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			return( ARROW_WRITER_COLUMN_TYPE_STRING );
+
+		default:
+			break;
+	}
+	return( ARROW_WRITER_COLUMN_TYPE_BINARY );
+}
+
+/* Exports a record in the columnar format
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_columnar(
+     libesedb_record_t *record,
+     export_buffer_t *value_buffer,
+     arrow_writer_t *arrow_writer,
+     liberror_error_t **error )
+{
+	static char *function = "export_handle_export_record_columnar";
+	int number_of_values  = 0;
+	int value_iterator    = 0;
+	int result            = 0;
+
+	if( record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every column of the row requires a value
+	 */
+	for( value_iterator = 0;
+	     value_iterator < arrow_writer->number_of_columns;
+	     value_iterator++ )
+	{
+		if( value_iterator < number_of_values )
+		{
+			result = export_handle_export_record_value_columnar(
+			          record,
+			          value_iterator,
+			          value_buffer,
+			          arrow_writer,
+			          error );
+		}
+		else
+		{
+			result = arrow_writer_append_null(
+			          arrow_writer,
+			          value_iterator,
+			          error );
+		}
+		if( result != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record value: %d.",
+			 function,
+			 value_iterator );
 
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED )
-					{ 
-						fprintf(
-						 record_file_stream,
-						 "%" PRIi64 "",
-						 (int64_t) value_64bit );
-					}
-					else
-					{
-						fprintf(
-						 record_file_stream,
-						 "%" PRIu64 "",
-						 value_64bit );
-					}
-				}
-				break;
+			return( -1 );
+		}
+	}
+	if( arrow_writer_end_row(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to end row.",
+		 function );
 
-			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-				result = libesedb_record_get_value_filetime(
-					  record,
-					  record_value_entry,
-					  &value_64bit,
-					  error );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve filetime value: %d.",
-					 function,
-					 record_value_entry );
+/* Exports a record value in the columnar format
+ * Long values, multi values and values that do not match the column type
+ * of the schema are exported as null
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_value_columnar(
+     libesedb_record_t *record,
+     int record_value_entry,
+     export_buffer_t *value_buffer,
+     arrow_writer_t *arrow_writer,
+     liberror_error_t **error )
+{
+	uint8_t *value_data      = NULL;
+	static char *function    = "export_handle_export_record_value_columnar";
+	size_t binary_data_size  = 0;
+	size_t value_data_size   = 0;
+	size_t value_string_size = 0;
+	double value_double      = 0.0;
+	float value_float        = 0.0;
+	uint64_t value_64bit     = 0;
+	uint32_t column_type     = 0;
+	uint32_t value_32bit     = 0;
+	uint16_t value_16bit     = 0;
+	uint8_t value_8bit       = 0;
+	uint8_t value_flags      = 0;
+	int columnar_type        = 0;
+	int result               = 0;
 
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					if( libfdatetime_filetime_initialize(
-					     &filetime,
-					     error ) != 1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-						 "%s: unable to create filetime.",
-						 function );
+	if( record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
 
-						return( -1 );
-					}
-					if( libfdatetime_filetime_copy_from_64bit(
-					     filetime,
-					     value_64bit,
-					     error ) != 1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_COPY_FAILED,
-						 "%s: unable to copy filetime from 64-bit value.",
-						 function );
+		return( -1 );
+	}
+	if( value_buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value buffer.",
+		 function );
 
-						libfdatetime_filetime_free(
-						 &filetime,
-						 NULL );
+		return( -1 );
+	}
+	if( arrow_writer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arrow writer.",
+		 function );
 
-						return( -1 );
-					}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libfdatetime_filetime_copy_to_utf16_string(
-					          filetime,
-					          (uint16_t *) filetime_string,
-					          32,
-					          LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS,
-					          LIBFDATETIME_DATE_TIME_FORMAT_CTIME,
-					          error );
-#else
-					result = libfdatetime_filetime_copy_to_utf8_string(
-					          filetime,
-					          (uint8_t *) filetime_string,
-					          32,
-					          LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS,
-					          LIBFDATETIME_DATE_TIME_FORMAT_CTIME,
-					          error );
-#endif
-					if( result != 1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_COPY_FAILED,
-						 "%s: unable to copy filetime to string.",
-						 function );
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= arrow_writer->number_of_columns ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
 
-						libfdatetime_filetime_free(
-						 &filetime,
-						 NULL );
+		return( -1 );
+	}
+	if( libesedb_record_get_column_type(
+	     record,
+	     record_value_entry,
+	     &column_type,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column type of value: %d.",
+		 function,
+		 record_value_entry );
 
-						return( -1 );
-					}
-					if( libfdatetime_filetime_free(
-					     &filetime,
-					     error ) != 1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free filetime.",
-						 function );
+		return( -1 );
+	}
+	if( libesedb_record_get_value(
+	     record,
+	     record_value_entry,
+	     &value_data,
+	     &value_data_size,
+	     &value_flags,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 record_value_entry );
 
-						return( -1 );
-					}
-					fprintf(
-					 record_file_stream,
-					 "%" PRIs_LIBCSTRING_SYSTEM "",
-					 filetime_string );
-				}
-				break;
+		return( -1 );
+	}
+	columnar_type = export_handle_get_columnar_type(
+	                 column_type );
 
-			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-				result = libesedb_record_get_value_floating_point_32bit(
-				          record,
+	if( columnar_type != arrow_writer->columns[ record_value_entry ].type )
+	{
+		columnar_type = -1;
+	}
+	else if( ( value_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE | LIBESEDB_VALUE_FLAG_COMPRESSED ) ) != 0 )
+	{
+		columnar_type = -1;
+	}
+	/* Compressed text values are decompressed by the UTF-8 string functions
+	 * compressed large binary data is decompressed and other compressed binary
+	 * values are exported as their stored data, like the text export does
+	 * compressed values of fixed size column types are exported as null
+	 */
+	else if( ( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	      && ( columnar_type != ARROW_WRITER_COLUMN_TYPE_STRING )
+	      && ( columnar_type != ARROW_WRITER_COLUMN_TYPE_BINARY ) )
+	{
+		columnar_type = -1;
+	}
+	switch( columnar_type )
+	{
+		case ARROW_WRITER_COLUMN_TYPE_BOOLEAN:
+			result = libesedb_record_get_value_boolean(
+				  record,
+				  record_value_entry,
+				  &value_8bit,
+				  error );
+
+			if( result == 1 )
+			{
+				result = arrow_writer_append_boolean(
+				          arrow_writer,
 				          record_value_entry,
-				          &value_float,
+				          value_8bit,
 				          error );
+			}
+			break;
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve single precision floating point value: %d.",
-					 function,
-					 record_value_entry );
-
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					fprintf(
-					 record_file_stream,
-					 "%f",
-					 value_float );
-				}
-				break;
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libesedb_record_get_value_8bit(
+				  record,
+				  record_value_entry,
+				  &value_8bit,
+				  error );
 
-			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-				result = libesedb_record_get_value_floating_point_64bit(
-				          record,
+			if( result == 1 )
+			{
+				result = arrow_writer_append_integer(
+				          arrow_writer,
 				          record_value_entry,
-				          &value_double,
+				          (uint64_t) value_8bit,
 				          error );
+			}
+			break;
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve double precision floating point value: %d.",
-					 function,
-					 record_value_entry );
-
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					fprintf(
-					 record_file_stream,
-					 "%f",
-					 value_double );
-				}
-				break;
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libesedb_record_get_value_16bit(
+				  record,
+				  record_value_entry,
+				  &value_16bit,
+				  error );
 
-			case LIBESEDB_COLUMN_TYPE_TEXT:
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libesedb_record_get_value_utf16_string_size(
-					  record,
-					  record_value_entry,
-					  &value_string_size,
-					  error );
-#else
-				result = libesedb_record_get_value_utf8_string_size(
-					  record,
-					  record_value_entry,
-					  &value_string_size,
-					  error );
-#endif
+			if( result == 1 )
+			{
+				result = arrow_writer_append_integer(
+				          arrow_writer,
+				          record_value_entry,
+				          (uint64_t) value_16bit,
+				          error );
+			}
+			break;
 
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve size of value string: %d (%" PRIu32 ").",
-					 function,
-					 record_value_entry,
-					 column_identifier );
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = libesedb_record_get_value_32bit(
+				  record,
+				  record_value_entry,
+				  &value_32bit,
+				  error );
 
-					return( -1 );
-				}
-				if( result != 0 )
-				{
-					if( value_string_size == 0 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing value string.",
-						 function );
+			if( result == 1 )
+			{
+				result = arrow_writer_append_integer(
+				          arrow_writer,
+				          record_value_entry,
+				          (uint64_t) value_32bit,
+				          error );
+			}
+			break;
 
-						return( -1 );
-					}
-					value_string = libcstring_system_string_allocate(
-					                value_string_size );
+		case ARROW_WRITER_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			result = libesedb_record_get_value_64bit(
+				  record,
+				  record_value_entry,
+				  &value_64bit,
+				  error );
 
-					if( value_string == NULL )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_MEMORY,
-						 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create value string.",
-						 function );
+			if( result == 1 )
+			{
+				result = arrow_writer_append_integer(
+				          arrow_writer,
+				          record_value_entry,
+				          value_64bit,
+				          error );
+			}
+			break;
 
-						return( -1 );
-					}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libesedb_record_get_value_utf16_string(
-					          record,
-					          record_value_entry,
-					          (uint16_t *) value_string,
-					          value_string_size,
-					          error );
-#else
-					result = libesedb_record_get_value_utf8_string(
-					          record,
-					          record_value_entry,
-					          (uint8_t *) value_string,
-					          value_string_size,
-					          error );
-#endif
-					if( result != 1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve value string: %d.",
-						 function,
-						 record_value_entry );
+		case ARROW_WRITER_COLUMN_TYPE_TIMESTAMP:
+			result = libesedb_record_get_value_filetime(
+				  record,
+				  record_value_entry,
+				  &value_64bit,
+				  error );
 
-						memory_free(
-						 value_string );
+			if( result == 1 )
+			{
+				/* Convert the FILETIME, the number of 100 nano seconds since January 1, 1601
+				 * into the number of micro seconds since January 1, 1970
+				 */
+				result = arrow_writer_append_integer(
+				          arrow_writer,
+				          record_value_entry,
+				          (uint64_t) ( (int64_t) ( value_64bit / 10 ) - (int64_t) 11644473600000000ULL ),
+				          error );
+			}
+			break;
 
-						return( -1 );
-					}
-					export_text(
-					 value_string,
-					 value_string_size,
-					 record_file_stream );
+		case ARROW_WRITER_COLUMN_TYPE_FLOAT_32BIT:
+			result = libesedb_record_get_value_floating_point_32bit(
+			          record,
+			          record_value_entry,
+			          &value_float,
+			          error );
 
-					memory_free(
-					 value_string );
-				}
-				break;
+			if( result == 1 )
+			{
+				result = arrow_writer_append_float_32bit(
+				          arrow_writer,
+				          record_value_entry,
+				          value_float,
+				          error );
+			}
+			break;
 
-			default:
-				export_binary_data(
-				 value_data,
-				 value_data_size,
-				 record_file_stream );
+		case ARROW_WRITER_COLUMN_TYPE_FLOAT_64BIT:
+			result = libesedb_record_get_value_floating_point_64bit(
+			          record,
+			          record_value_entry,
+			          &value_double,
+			          error );
 
-				break;
-		}
-	}
-	else if( ( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
-	      && ( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
-	{
-		switch( column_type )
-		{
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libesedb_record_get_value_utf16_string_size(
-					  record,
-					  record_value_entry,
-					  &value_string_size,
-					  error );
-#else
-				result = libesedb_record_get_value_utf8_string_size(
-					  record,
-					  record_value_entry,
-					  &value_string_size,
-					  error );
-#endif
+			if( result == 1 )
+			{
+				result = arrow_writer_append_float_64bit(
+				          arrow_writer,
+				          record_value_entry,
+				          value_double,
+				          error );
+			}
+			break;
 
-				if( result == -1 )
+		case ARROW_WRITER_COLUMN_TYPE_STRING:
+			result = libesedb_record_get_value_utf8_string_size(
+				  record,
+				  record_value_entry,
+				  &value_string_size,
+				  error );
+
+			if( result == 1 )
+			{
+				if( value_string_size == 0 )
 				{
 					liberror_error_set(
 					 error,
 					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve size of value string: %d (%" PRIu32 ").",
-					 function,
-					 record_value_entry,
-					 column_identifier );
+					 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing value string.",
+					 function );
 
 					return( -1 );
 				}
-				if( result != 0 )
-				{
-					if( value_string_size == 0 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing value string.",
-						 function );
-
-						return( -1 );
-					}
-					value_string = libcstring_system_string_allocate(
-					                value_string_size );
-
-					if( value_string == NULL )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_MEMORY,
-						 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create value string.",
-						 function );
-
-						return( -1 );
-					}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libesedb_record_get_value_utf16_string(
-					          record,
-					          record_value_entry,
-					          (uint16_t *) value_string,
-					          value_string_size,
-					          error );
-#else
-					result = libesedb_record_get_value_utf8_string(
-					          record,
-					          record_value_entry,
-					          (uint8_t *) value_string,
-					          value_string_size,
-					          error );
-#endif
-					if( result != 1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve value string: %d.",
-						 function,
-						 record_value_entry );
-
-						memory_free(
-						 value_string );
-
-						return( -1 );
-					}
-					export_text(
-					 value_string,
-					 value_string_size,
-					 record_file_stream );
+				result = export_buffer_resize(
+				          value_buffer,
+				          value_string_size,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libesedb_record_get_value_utf8_string(
+				          record,
+				          record_value_entry,
+				          value_buffer->data,
+				          value_string_size,
+				          error );
 
-					memory_free(
-					 value_string );
+				if( result == 0 )
+				{
+					result = -1;
 				}
-				break;
+			}
+			/* The string is stored without the end of string character
+			 */
+			if( result == 1 )
+			{
+				result = arrow_writer_append_data(
+				          arrow_writer,
+				          record_value_entry,
+				          value_buffer->data,
+				          value_string_size - 1,
+				          error );
+			}
+			break;
 
-			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+		case ARROW_WRITER_COLUMN_TYPE_BINARY:
+			if( ( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+			 && ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+			{
 				result = libesedb_record_get_value_binary_data_size(
 					  record,
 					  record_value_entry,
 					  &binary_data_size,
 					  error );
 
-				if( result == -1 )
+				if( result == 1 )
 				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve size of binary data: %d (%" PRIu32 ").",
-					 function,
-					 record_value_entry,
-					 column_identifier );
-
-					return( -1 );
+					result = export_buffer_resize(
+					          value_buffer,
+					          binary_data_size,
+					          error );
 				}
-				if( result != 0 )
+				if( result == 1 )
 				{
-					if( binary_data_size == 0 )
+					result = libesedb_record_get_value_binary_data(
+					          record,
+					          record_value_entry,
+					          value_buffer->data,
+					          binary_data_size,
+					          error );
+
+					if( result == 0 )
 					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing binary data.",
-						 function );
+						result = -1;
+					}
+				}
+				if( result == 1 )
+				{
+					result = arrow_writer_append_data(
+					          arrow_writer,
+					          record_value_entry,
+					          value_buffer->data,
+					          binary_data_size,
+					          error );
+				}
+			}
+			else if( value_data != NULL )
+			{
+				result = arrow_writer_append_data(
+				          arrow_writer,
+				          record_value_entry,
+				          value_data,
+				          value_data_size,
+				          error );
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to export value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( arrow_writer_append_null(
+		     arrow_writer,
+		     record_value_entry,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append null value: %d.",
+			 function,
+			 record_value_entry );
 
-						return( -1 );
-					}
-					binary_data = (uint8_t *) memory_allocate(
-					                           sizeof( uint8_t ) * binary_data_size  );
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
 
-					if( binary_data == NULL )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_MEMORY,
-						 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create binary data.",
-						 function );
+/* Exports a specific table in the input file
+ * The table is only exported if the export table name is NULL or matches the name of the table
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_table_by_index(
+     export_handle_t *export_handle,
+     libesedb_file_t *input_file,
+     int table_index,
+     int number_of_tables,
+     const libcstring_system_character_t *export_table_name,
+     size_t export_table_name_length,
+     log_handle_t *log_handle,
+     liberror_error_t **error )
+{
+	libcstring_system_character_t *table_name = NULL;
+	libesedb_table_t *table                   = NULL;
+	static char *function                     = "export_handle_export_table_by_index";
+	size_t table_name_size                    = 0;
+	int result                                = 0;
 
-						return( -1 );
-					}
-					result = libesedb_record_get_value_binary_data(
-					          record,
-					          record_value_entry,
-					          binary_data,
-					          binary_data_size,
-					          error );
+	if( export_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-					if( result != 1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve binary data: %d.",
-						 function,
-						 record_value_entry );
+		return( -1 );
+	}
+	if( libesedb_file_get_table(
+	     input_file,
+	     table_index,
+	     &table,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table: %d.",
+		 function,
+		 table_index );
 
-						memory_free(
-						 binary_data );
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_table_get_utf16_name_size(
+	          table,
+	          &table_name_size,
+	          error );
+#else
+	result = libesedb_table_get_utf8_name_size(
+	          table,
+	          &table_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the size of the table name.",
+		 function );
 
-						return( -1 );
-					}
-					export_binary_data(
-					 binary_data,
-					 binary_data_size,
-					 record_file_stream );
+		goto on_error;
+	}
+	if( table_name_size == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing table name.",
+		 function );
 
-					memory_free(
-					 binary_data );
-				}
-				break;
+		goto on_error;
+	}
+	table_name = libcstring_system_string_allocate(
+	              table_name_size );
 
-			default:
-				export_binary_data(
-				 value_data,
-				 value_data_size,
-				 record_file_stream );
+	if( table_name == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table name string.",
+		 function );
 
-				break;
-		}
+		goto on_error;
 	}
-	else if( ( ( value_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
-	      && ( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_table_get_utf16_name(
+	          table,
+	          (uint16_t *) table_name,
+	          table_name_size,
+	          error );
+#else
+	result = libesedb_table_get_utf8_name(
+	          table,
+	          (uint8_t *) table_name,
+	          table_name_size,
+	          error );
+#endif
+	if( result != 1 )
 	{
-		result = libesedb_record_get_long_value(
-		          record,
-		          record_value_entry,
-		          &long_value,
-		          error );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the table name.",
+		 function );
 
-		if( result != 1 )
+		goto on_error;
+	}
+	if( ( export_table_name == NULL )
+	 || ( ( table_name_size == ( export_table_name_length + 1 ) )
+	   && ( libcstring_system_string_compare(
+	         table_name,
+	         export_table_name,
+	         export_table_name_length ) == 0 ) ) )
+	{
+		/* The notification is printed in a single call so that
+		 * the output of multiple threads is not interleaved
+		 */
+		if( export_table_name == NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Exporting table %d (%" PRIs_LIBCSTRING_SYSTEM ") out of %d.\n",
+			 table_index + 1,
+			 table_name,
+			 number_of_tables );
+		}
+		else
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Exporting table %d (%" PRIs_LIBCSTRING_SYSTEM ").\n",
+			 table_index + 1,
+			 table_name );
+		}
+		if( libsystem_path_sanitize_filename(
+		     table_name,
+		     &table_name_size,
+		     error ) != 1 )
 		{
-			log_handle_printf(
-			 log_handle,
-			 "Unable to retrieve long value of record entry: %d.\n",
-			 record_value_entry );
-
-			if( libsystem_notify_verbose != 0 )
-			{
-				libsystem_notify_printf(
-				 "%s: unable to retrieve long value of record entry: %d.",
-				 function,
-				 record_value_entry );
-			}
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve long value of record entry: %d.",
-			 function,
-			 record_value_entry );
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable sanitize table name.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libsystem_notify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			liberror_error_free(
-			 error );
+			goto on_error;
 		}
-		else
+		if( export_handle_export_table(
+		     export_handle,
+		     table,
+		     table_index,
+		     table_name,
+		     table_name_size - 1,
+		     export_handle->items_export_path,
+		     export_handle->items_export_path_size - 1,
+		     log_handle,
+		     error ) != 1 )
 		{
-			if( libesedb_long_value_get_number_of_segments(
-			     long_value,
-			     &number_of_long_value_segments,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of long value segments.",
-				 function );
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
+			 function,
+			 table_index );
 
-				libesedb_long_value_free(
-				 &long_value,
-				 NULL );
+			goto on_error;
+		}
+	}
+	memory_free(
+	 table_name );
 
-				return( -1 );
-			}
-			for( long_value_segment_iterator = 0;
-			     long_value_segment_iterator < number_of_long_value_segments;
-			     long_value_segment_iterator++ )
-			{
-				if( libesedb_long_value_get_segment_data(
-				     long_value,
-				     long_value_segment_iterator,
-				     &value_data,
-				     &value_data_size,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve long value segment: %d of record entry: %d.",
-					 function,
-					 long_value_segment_iterator,
-					 record_value_entry );
+	table_name = NULL;
 
-					libesedb_long_value_free(
-					 &long_value,
-					 NULL );
+	if( libesedb_table_free(
+	     &table,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table: %d.",
+		 function,
+		 table_index );
 
-					return( -1 );
-				}
-				if( value_data != NULL )
-				{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( LONG_VALUE_TEST )
-libsystem_notify_printf(
- "LONG VALUE DATA: %d out of %d\n",
- long_value_segment_iterator + 1,
- number_of_long_value_segments );
-libsystem_notify_print_data(
- value_data,
- value_data_size );
-#endif
-				}
-			}
-			if( libesedb_long_value_free(
-			     &long_value,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long value.",
-				 function );
+		goto on_error;
+	}
+	return( 1 );
 
-				return( -1 );
-			}
+on_error:
+	if( table_name != NULL )
+	{
+		memory_free(
+		 table_name );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			if( libesedb_long_value_free(
-			     &long_value,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long value.",
-				 function );
+#if defined( HAVE_PTHREAD )
 
-				return( -1 );
-			}
-		}
+/* Exports tables until no more tables are available
+ * The tables are read from the input file of the thread
+ * The result of the thread is stored in the thread parameters
+ * Returns NULL
+ */
+void *export_handle_export_tables_thread(
+       void *parameters )
+{
+	export_handle_thread_t *export_handle_thread = NULL;
+	export_handle_t *export_handle               = NULL;
+	static char *function                        = "export_handle_export_tables_thread";
+	int table_index                              = 0;
+
+	if( parameters == NULL )
+	{
+		return( NULL );
 	}
-	/* TODO handle 0x10 flags */
-	else if( ( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
-	      && ( ( value_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) == 0 )
-	      && ( ( value_flags & 0x10 ) == 0 ) )
+	export_handle_thread = (export_handle_thread_t *) parameters;
+	export_handle        = export_handle_thread->export_handle;
+
+	export_handle_thread->result = 1;
+
+	while( export_handle->abort == 0 )
 	{
-		/* TODO what about non string multi values ?
-		 */
-		if( libesedb_record_get_multi_value(
-		     record,
-		     record_value_entry,
-		     &multi_value,
-		     error ) != 1 )
+		if( pthread_mutex_lock(
+		     &( export_handle->table_index_mutex ) ) != 0 )
 		{
 			liberror_error_set(
-			 error,
+			 &( export_handle_thread->error ),
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve multi value of record entry: %d.",
-			 function,
-			 record_value_entry );
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to lock table index mutex.",
+			 function );
 
-			return( -1 );
+			export_handle_thread->result = -1;
+
+			break;
 		}
-		if( libesedb_multi_value_get_number_of_values(
-		     multi_value,
-		     &number_of_multi_values,
-		     error ) != 1 )
+		table_index = export_handle->next_table_index;
+
+		if( table_index < export_handle_thread->number_of_tables )
+		{
+			export_handle->next_table_index += 1;
+		}
+		if( pthread_mutex_unlock(
+		     &( export_handle->table_index_mutex ) ) != 0 )
 		{
 			liberror_error_set(
-			 error,
+			 &( export_handle_thread->error ),
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of multi values.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to unlock table index mutex.",
 			 function );
 
-			libesedb_multi_value_free(
-			 &multi_value,
-			 NULL );
+			export_handle_thread->result = -1;
 
-			return( -1 );
+			break;
 		}
-		for( multi_value_iterator = 0;
-	 	     multi_value_iterator < number_of_multi_values;
-		     multi_value_iterator++ )
+		if( table_index >= export_handle_thread->number_of_tables )
 		{
-			if( libesedb_multi_value_get_value(
-			     multi_value,
-			     multi_value_iterator,
-			     &column_type,
-			     &value_data,
-			     &value_data_size,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve multi value: %d of record entry: %d.",
-				 function,
-				 multi_value_iterator,
-				 record_value_entry );
+			break;
+		}
+		if( export_handle_export_table_by_index(
+		     export_handle,
+		     export_handle_thread->input_file,
+		     table_index,
+		     export_handle_thread->number_of_tables,
+		     NULL,
+		     0,
+		     export_handle_thread->log_handle,
+		     &( export_handle_thread->error ) ) != 1 )
+		{
+			liberror_error_set(
+			 &( export_handle_thread->error ),
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
+			 function,
+			 table_index );
 
-				return( -1 );
-			}
-			if( value_data != NULL )
-			{
-				if( ( column_type == LIBESEDB_COLUMN_TYPE_TEXT )
-				 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
-				{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libesedb_multi_value_get_value_utf16_string_size(
-						  multi_value,
-						  multi_value_iterator,
-						  &value_string_size,
-						  error );
-#else
-					result = libesedb_multi_value_get_value_utf8_string_size(
-						  multi_value,
-						  multi_value_iterator,
-						  &value_string_size,
-						  error );
-#endif
+			export_handle_thread->result = -1;
 
-					if( result == -1 )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve size of string of multi value: %d of record entry: %d (%" PRIu32 ").",
-						 function,
-						 multi_value_iterator,
-						 record_value_entry,
-						 column_identifier );
+			break;
+		}
+	}
+	if( export_handle_thread->result != 1 )
+	{
+		/* Make the other threads stop at the next table
+		 */
+		export_handle->abort = 1;
+	}
+	return( NULL );
+}
 
-						libesedb_multi_value_free(
-						 &multi_value,
-						 NULL );
+/* Exports the tables in the file using multiple threads
+ * Every thread opens its own input file so that the tables are read independently
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_tables_concurrently(
+     export_handle_t *export_handle,
+     int number_of_tables,
+     log_handle_t *log_handle,
+     liberror_error_t **error )
+{
+	export_handle_thread_t *export_handle_threads = NULL;
+	static char *function                         = "export_handle_export_tables_concurrently";
+	int is_mutex_initialized                      = 0;
+	int number_of_threads                         = 0;
+	int result                                    = 1;
+	int thread_index                              = 0;
 
-						return( -1 );
-					}
-					else if( result != 0 )
-					{
-						value_string = libcstring_system_string_allocate(
-						                value_string_size );
+	if( export_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-						if( value_string == NULL )
-						{
-							liberror_error_set(
-							 error,
-							 LIBERROR_ERROR_DOMAIN_MEMORY,
-							 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-							 "%s: unable to create value string.",
-							 function );
+		return( -1 );
+	}
+	if( export_handle->input_filename == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing input filename.",
+		 function );
 
-							libesedb_multi_value_free(
-							 &multi_value,
-							 NULL );
+		return( -1 );
+	}
+	number_of_threads = export_handle->number_of_threads;
 
-							return( -1 );
-						}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-						result = libesedb_multi_value_get_value_utf16_string(
-						          multi_value,
-						          multi_value_iterator,
-						          (uint16_t *) value_string,
-						          value_string_size,
-						          error );
-#else
-						result = libesedb_multi_value_get_value_utf8_string(
-						          multi_value,
-						          multi_value_iterator,
-						          (uint8_t *) value_string,
-						          value_string_size,
-						          error );
-#endif
-						if( result != 1 )
-						{
-							liberror_error_set(
-							 error,
-							 LIBERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve string of multi value: %d of record entry: %d.",
-							 function,
-							 multi_value_iterator,
-							 record_value_entry );
+	if( number_of_threads > number_of_tables )
+	{
+		number_of_threads = number_of_tables;
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
 
-							memory_free(
-							 value_string );
-							libesedb_multi_value_free(
-							 &multi_value,
-							 NULL );
+		return( -1 );
+	}
+	export_handle_threads = (export_handle_thread_t *) memory_allocate(
+	                                                    sizeof( export_handle_thread_t ) * number_of_threads );
 
-							return( -1 );
-						}
-						export_text(
-						 value_string,
-						 value_string_size,
-						 record_file_stream );
+	if( export_handle_threads == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle_threads,
+	     0,
+	     sizeof( export_handle_thread_t ) * number_of_threads ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( pthread_mutex_init(
+	     &( export_handle->table_index_mutex ),
+	     NULL ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize table index mutex.",
+		 function );
+
+		goto on_error;
+	}
+	is_mutex_initialized = 1;
+
+	export_handle->next_table_index = 0;
+
+	/* The input files are opened before any thread is started
+	 */
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		export_handle_threads[ thread_index ].export_handle    = export_handle;
+		export_handle_threads[ thread_index ].number_of_tables = number_of_tables;
+		export_handle_threads[ thread_index ].log_handle       = log_handle;
 
-						memory_free(
-						 value_string );
-					}
-					if( multi_value_iterator < ( number_of_multi_values - 1 ) )
-					{
-						fprintf(
-						 record_file_stream,
-						 "; " );
-					}
-				}
-				else
-				{
-					export_binary_data(
-					 value_data,
-					 value_data_size,
-					 record_file_stream );
-				}
-			}
+		if( libesedb_file_initialize(
+		     &( export_handle_threads[ thread_index ].input_file ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize input file of thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
 		}
-		if( libesedb_multi_value_free(
-		     &multi_value,
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libesedb_file_open_wide(
+		     export_handle_threads[ thread_index ].input_file,
+		     export_handle->input_filename,
+		     export_handle->access_flags,
+		     error ) != 1 )
+#else
+		if( libesedb_file_open(
+		     export_handle_threads[ thread_index ].input_file,
+		     export_handle->input_filename,
+		     export_handle->access_flags,
 		     error ) != 1 )
+#endif
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input file of thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( pthread_create(
+		     &( export_handle_threads[ thread_index ].thread ),
+		     NULL,
+		     &export_handle_export_tables_thread,
+		     (void *) &( export_handle_threads[ thread_index ] ) ) != 0 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free multi value: %d.",
+			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
 			 function,
-			 multi_value_iterator );
+			 thread_index );
 
-			return( -1 );
+			/* Stop the threads that were already started
+			 */
+			export_handle->abort = 1;
+
+			result = -1;
+
+			break;
 		}
+		export_handle_threads[ thread_index ].is_started = 1;
 	}
-	else
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
 	{
-		export_binary_data(
-		 value_data,
-		 value_data_size,
-		 record_file_stream );
+		if( export_handle_threads[ thread_index ].is_started == 0 )
+		{
+			continue;
+		}
+		if( pthread_join(
+		     export_handle_threads[ thread_index ].thread,
+		     NULL ) != 0 )
+		{
+			if( result == 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+			}
+			result = -1;
+		}
+		else if( export_handle_threads[ thread_index ].result != 1 )
+		{
+			/* Only the error of the first failed thread is reported
+			 */
+			if( ( result == 1 )
+			 && ( error != NULL ) )
+			{
+				*error = export_handle_threads[ thread_index ].error;
+
+				export_handle_threads[ thread_index ].error = NULL;
+
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export tables in thread: %d.",
+				 function,
+				 thread_index );
+			}
+			result = -1;
+		}
 	}
-	return( 1 );
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( export_handle_threads[ thread_index ].error != NULL )
+		{
+			liberror_error_free(
+			 &( export_handle_threads[ thread_index ].error ) );
+		}
+		if( libesedb_file_close(
+		     export_handle_threads[ thread_index ].input_file,
+		     NULL ) != 0 )
+		{
+			if( result == 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_IO,
+				 LIBERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input file of thread: %d.",
+				 function,
+				 thread_index );
+			}
+			result = -1;
+		}
+		if( libesedb_file_free(
+		     &( export_handle_threads[ thread_index ].input_file ),
+		     NULL ) != 1 )
+		{
+			if( result == 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file of thread: %d.",
+				 function,
+				 thread_index );
+			}
+			result = -1;
+		}
+	}
+	memory_free(
+	 export_handle_threads );
+
+	pthread_mutex_destroy(
+	 &( export_handle->table_index_mutex ) );
+
+	return( result );
+
+on_error:
+	if( export_handle_threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( export_handle_threads[ thread_index ].input_file != NULL )
+			{
+				libesedb_file_close(
+				 export_handle_threads[ thread_index ].input_file,
+				 NULL );
+				libesedb_file_free(
+				 &( export_handle_threads[ thread_index ].input_file ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 export_handle_threads );
+	}
+	if( is_mutex_initialized != 0 )
+	{
+		pthread_mutex_destroy(
+		 &( export_handle->table_index_mutex ) );
+	}
+	return( -1 );
 }
 
+#endif /* defined( HAVE_PTHREAD ) */
+
 /* Exports the items in the file
  * Returns the 1 if succesful, 0 if no items are available or -1 on error
  */
@@ -3395,13 +5458,9 @@ int export_handle_export_file(
      log_handle_t *log_handle,
      liberror_error_t **error )
 {
-	libcstring_system_character_t *table_name = NULL;
-	libesedb_table_t *table                   = NULL;
-	static char *function                     = "export_handle_export_file";
-	size_t table_name_size                    = 0;
-	int number_of_tables                      = 0;
-	int result                                = 0;
-	int table_index                           = 0;
+	static char *function = "export_handle_export_file";
+	int number_of_tables  = 0;
+	int table_index       = 0;
 
 	if( export_handle == NULL )
 	{
@@ -3426,7 +5485,7 @@ int export_handle_export_file(
 		 "%s: unable to retrieve number of tables.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( number_of_tables == 0 )
 	{
@@ -3444,198 +5503,63 @@ int export_handle_export_file(
 		 function,
 		 export_handle->items_export_path );
 
-		goto on_error;
+		return( -1 );
 	}
 	log_handle_printf(
 	 log_handle,
 	 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
 	 export_handle->items_export_path );
 
-	for( table_index = 0;
-	     table_index < number_of_tables;
-	     table_index++ )
+#if defined( HAVE_PTHREAD )
+	/* A single table is always exported by the calling thread
+	 */
+	if( ( export_handle->number_of_threads > 1 )
+	 && ( export_table_name == NULL )
+	 && ( number_of_tables > 1 ) )
 	{
-		if( libesedb_file_get_table(
-		     export_handle->input_file,
-		     table_index,
-		     &table,
+		if( export_handle_export_tables_concurrently(
+		     export_handle,
+		     number_of_tables,
+		     log_handle,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve table: %d.",
-			 function,
-			 table_index );
-
-			goto on_error;
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_table_get_utf16_name_size(
-		          table,
-		          &table_name_size,
-		          error );
-#else
-		result = libesedb_table_get_utf8_name_size(
-		          table,
-		          &table_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the size of the table name.",
-			 function );
-
-			goto on_error;
-		}
-		if( table_name_size == 0 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table name.",
-			 function );
-
-			goto on_error;
-		}
-		table_name = libcstring_system_string_allocate(
-		              table_name_size );
-
-		if( table_name == NULL )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_MEMORY,
-			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create table name string.",
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export tables concurrently.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_table_get_utf16_name(
-		          table,
-		          (uint16_t *) table_name,
-		          table_name_size,
-		          error );
-#else
-		result = libesedb_table_get_utf8_name(
-		          table,
-		          (uint8_t *) table_name,
-		          table_name_size,
-		          error );
+		return( 1 );
+	}
 #endif
-		if( result != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the table name.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( export_table_name == NULL )
-		 || ( ( table_name_size == ( export_table_name_length + 1 ) )
-		   && ( libcstring_system_string_compare(
-		         table_name,
-		         export_table_name,
-		         export_table_name_length ) == 0 ) ) )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Exporting table %d (%" PRIs_LIBCSTRING_SYSTEM ")",
-			 table_index + 1,
-			 table_name );
-
-			if( export_table_name == NULL )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 " out of %d",
-				 number_of_tables );
-			}
-			fprintf(
-			 export_handle->notify_stream,
-			 ".\n" );
-
-			if( libsystem_path_sanitize_filename(
-			     table_name,
-			     &table_name_size,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable sanitize table name.",
-				 function );
-
-				goto on_error;
-			}
-			if( export_handle_export_table(
-			     export_handle,
-			     table,
-			     table_index,
-			     table_name,
-			     table_name_size - 1,
-			     export_handle->items_export_path,
-			     export_handle->items_export_path_size - 1,
-			     log_handle,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to export table: %d.",
-				 function,
-				 table_index );
-
-				goto on_error;
-			}
-		}
-		memory_free(
-		 table_name );
-
-		table_name = NULL;
-
-		if( libesedb_table_free(
-		     &table,
+	for( table_index = 0;
+	     table_index < number_of_tables;
+	     table_index++ )
+	{
+		if( export_handle_export_table_by_index(
+		     export_handle,
+		     export_handle->input_file,
+		     table_index,
+		     number_of_tables,
+		     export_table_name,
+		     export_table_name_length,
+		     log_handle,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table: %d.",
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
 			 function,
 			 table_index );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	return( 1 );
-
-on_error:
-	if( table_name != NULL )
-	{
-		memory_free(
-		 table_name );
-	}
-	if( table != NULL )
-	{
-		libesedb_table_free(
-		 &table,
-		 NULL );
-	}
-	return( -1 );
 }
 
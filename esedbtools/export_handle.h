@@ -29,7 +29,17 @@
 #include <libcstring.h>
 #include <liberror.h>
 
+#if defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+#endif
+
+#if defined( HAVE_SIGNAL_H ) || defined( WINAPI )
+#include <signal.h>
+#endif
+
+#include "arrow_writer.h"
 #include "esedbtools_libesedb.h"
+#include "export_buffer.h"
 #include "log_handle.h"
 
 #if defined( __cplusplus )
@@ -42,6 +52,20 @@ enum EXPORT_MODES
 	EXPORT_MODE_TABLES		= (int) 't'
 };
 
+enum EXPORT_FORMATS
+{
+	EXPORT_FORMAT_COLUMNAR		= (int) 'c',
+	EXPORT_FORMAT_TEXT		= (int) 't'
+};
+
+/* The maximum number of threads used to export tables
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The size of the write buffer of the item file streams
+ */
+#define EXPORT_HANDLE_ITEM_FILE_STREAM_BUFFER_SIZE	1048576
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -50,10 +74,31 @@ struct export_handle
 	 */
 	uint8_t export_mode;
 
+	/* The export format
+	 */
+	uint8_t export_format;
+
 	/* The libesedb input file
 	 */
 	libesedb_file_t *input_file;
 
+	/* The libesedb access flags used to open the input file
+	 */
+	int access_flags;
+
+	/* The input filename
+	 * Used to open an input file per thread
+	 */
+	libcstring_system_character_t *input_filename;
+
+	/* The input filename size
+	 */
+	size_t input_filename_size;
+
+	/* The number of threads used to export tables
+	 */
+	int number_of_threads;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
@@ -79,9 +124,59 @@ struct export_handle
 	FILE *notify_stream;
 
 	/* Value to indicate if abort was signalled
+	 * it is set from the signal handler and read by the export threads
+	 */
+	volatile sig_atomic_t abort;
+
+#if defined( HAVE_PTHREAD )
+	/* The mutex that protects the next table index
+	 */
+	pthread_mutex_t table_index_mutex;
+
+	/* The index of the next table to be exported by a thread
+	 */
+	int next_table_index;
+#endif
+};
+
+#if defined( HAVE_PTHREAD )
+typedef struct export_handle_thread export_handle_thread_t;
+
+struct export_handle_thread
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The libesedb input file of the thread
+	 */
+	libesedb_file_t *input_file;
+
+	/* The number of tables
+	 */
+	int number_of_tables;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+
+	/* The thread
+	 */
+	pthread_t thread;
+
+	/* Value to indicate the thread was started
+	 */
+	int is_started;
+
+	/* The result of the thread
+	 */
+	int result;
+
+	/* The error of the thread
 	 */
-	int abort;
+	liberror_error_t *error;
 };
+#endif
 
 int export_handle_initialize(
      export_handle_t **export_handle,
@@ -100,11 +195,21 @@ int export_handle_set_export_mode(
      const libcstring_system_character_t *string,
      liberror_error_t **error );
 
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     liberror_error_t **error );
+
 int export_handle_set_ascii_codepage(
      export_handle_t *export_handle,
      const libcstring_system_character_t *string,
      liberror_error_t **error );
 
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     liberror_error_t **error );
+
 int export_handle_set_target_path(
      export_handle_t *export_handle,
      const libcstring_system_character_t *target_path,
@@ -144,12 +249,13 @@ int export_handle_create_item_filename(
      size_t *item_filename_size,
      liberror_error_t **error );
 
-int export_handle_create_text_item_file(
+int export_handle_create_item_file(
      export_handle_t *export_handle,
      const libcstring_system_character_t *item_filename,
      size_t item_filename_length,
      const libcstring_system_character_t *export_path,
      size_t export_path_length,
+     const libcstring_system_character_t *mode,
      FILE **item_file_stream,
      liberror_error_t **error );
 
@@ -164,6 +270,17 @@ int export_handle_export_table(
      log_handle_t *log_handle,
      liberror_error_t **error );
 
+int export_handle_export_table_columnar(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     int table_index,
+     const libcstring_system_character_t *table_name,
+     size_t table_name_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     liberror_error_t **error );
+
 int export_handle_export_indexes(
      export_handle_t *export_handle,
      libesedb_table_t *table,
@@ -187,6 +304,7 @@ int export_handle_export_index(
 
 int export_handle_export_record(
      libesedb_record_t *record,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error );
@@ -194,10 +312,48 @@ int export_handle_export_record(
 int export_handle_export_record_value(
      libesedb_record_t *record,
      int record_value_entry,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error );
 
+int export_handle_get_columnar_type(
+     uint32_t column_type );
+
+int export_handle_export_record_columnar(
+     libesedb_record_t *record,
+     export_buffer_t *value_buffer,
+     arrow_writer_t *arrow_writer,
+     liberror_error_t **error );
+
+int export_handle_export_record_value_columnar(
+     libesedb_record_t *record,
+     int record_value_entry,
+     export_buffer_t *value_buffer,
+     arrow_writer_t *arrow_writer,
+     liberror_error_t **error );
+
+int export_handle_export_table_by_index(
+     export_handle_t *export_handle,
+     libesedb_file_t *input_file,
+     int table_index,
+     int number_of_tables,
+     const libcstring_system_character_t *export_table_name,
+     size_t export_table_name_length,
+     log_handle_t *log_handle,
+     liberror_error_t **error );
+
+#if defined( HAVE_PTHREAD )
+void *export_handle_export_tables_thread(
+       void *parameters );
+
+int export_handle_export_tables_concurrently(
+     export_handle_t *export_handle,
+     int number_of_tables,
+     log_handle_t *log_handle,
+     liberror_error_t **error );
+#endif
+
 int export_handle_export_file(
      export_handle_t *export_handle,
      const libcstring_system_character_t *export_table_name,
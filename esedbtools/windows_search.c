@@ -34,9 +34,14 @@
 #include "esedbtools_libfdatetime.h"
 #include "esedbtools_libuna.h"
 #include "export.h"
+#include "export_column_plan.h"
 #include "export_handle.h"
 #include "windows_search.h"
 
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+#include <immintrin.h>
+#endif
+
 /* Define this if the debug output is not verbose enough
 #define HAVE_EXTRA_DEBUG_OUTPUT
 */
@@ -58,6 +63,194 @@ enum WINDOWS_SEARCH_FORMATS
 	WINDOWS_SEARCH_FORMAT_HEXADECIMAL,
 };
 
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+
+/* The decoding kernels
+ */
+enum WINDOWS_SEARCH_KERNELS
+{
+	WINDOWS_SEARCH_KERNEL_UNDETERMINED	= -1,
+	WINDOWS_SEARCH_KERNEL_SCALAR		= 0,
+	WINDOWS_SEARCH_KERNEL_SSE2		= 1,
+	WINDOWS_SEARCH_KERNEL_AVX2		= 2
+};
+
+/* The decoding kernel supported by the CPU
+ * The value is determined on first use, concurrent determination results in the same value
+ */
+static int windows_search_kernel = WINDOWS_SEARCH_KERNEL_UNDETERMINED;
+
+/* Determines the decoding kernel supported by the CPU
+ * Returns the decoding kernel
+ */
+int windows_search_get_kernel(
+     void )
+{
+	int kernel = windows_search_kernel;
+
+	if( kernel == WINDOWS_SEARCH_KERNEL_UNDETERMINED )
+	{
+		kernel = WINDOWS_SEARCH_KERNEL_SCALAR;
+
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "avx2" ) != 0 )
+		{
+			kernel = WINDOWS_SEARCH_KERNEL_AVX2;
+		}
+		else if( __builtin_cpu_supports( "sse2" ) != 0 )
+		{
+			kernel = WINDOWS_SEARCH_KERNEL_SSE2;
+		}
+		windows_search_kernel = kernel;
+	}
+	return( kernel );
+}
+
+/* Decodes a block of at most 256 bytes with the keystream using SSE2
+ * Returns the number of bytes decoded, which is a multiple of 16
+ */
+__attribute__((target("sse2")))
+size_t windows_search_decode_block_sse2(
+        uint8_t *data,
+        const uint8_t *encoded_data,
+        const uint8_t *keystream,
+        size_t block_size )
+{
+	__m128i encoded_value   = _mm_setzero_si128();
+	__m128i keystream_value = _mm_setzero_si128();
+	size_t block_iterator   = 0;
+
+	while( ( block_size - block_iterator ) >= 16 )
+	{
+		encoded_value = _mm_loadu_si128(
+		                 (__m128i *) &( encoded_data[ block_iterator ] ) );
+
+		keystream_value = _mm_loadu_si128(
+		                   (__m128i *) &( keystream[ block_iterator ] ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( data[ block_iterator ] ),
+		 _mm_xor_si128(
+		  encoded_value,
+		  keystream_value ) );
+
+		block_iterator += 16;
+	}
+	return( block_iterator );
+}
+
+/* Decodes a block of at most 256 bytes with the keystream using AVX2
+ * Returns the number of bytes decoded, which is a multiple of 32
+ */
+__attribute__((target("avx2")))
+size_t windows_search_decode_block_avx2(
+        uint8_t *data,
+        const uint8_t *encoded_data,
+        const uint8_t *keystream,
+        size_t block_size )
+{
+	__m256i encoded_value   = _mm256_setzero_si256();
+	__m256i keystream_value = _mm256_setzero_si256();
+	size_t block_iterator   = 0;
+
+	while( ( block_size - block_iterator ) >= 32 )
+	{
+		encoded_value = _mm256_loadu_si256(
+		                 (__m256i *) &( encoded_data[ block_iterator ] ) );
+
+		keystream_value = _mm256_loadu_si256(
+		                   (__m256i *) &( keystream[ block_iterator ] ) );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( data[ block_iterator ] ),
+		 _mm256_xor_si256(
+		  encoded_value,
+		  keystream_value ) );
+
+		block_iterator += 32;
+	}
+	return( block_iterator );
+}
+
+/* Expands a run of UTF-16 low bytes with a shared high byte using SSE2
+ * Every 16 bytes of the run are interleaved into 32 bytes of UTF-16 data
+ * Returns the number of run bytes expanded, which is a multiple of 16
+ */
+__attribute__((target("sse2")))
+size_t windows_search_expand_run_sse2(
+        uint8_t *utf16_data,
+        const uint8_t *run_data,
+        size_t run_size,
+        uint8_t compression_byte )
+{
+	__m128i run_value       = _mm_setzero_si128();
+	__m128i high_byte_value = _mm_setzero_si128();
+	size_t run_iterator     = 0;
+
+	high_byte_value = _mm_set1_epi8(
+	                   (char) compression_byte );
+
+	while( ( run_size - run_iterator ) >= 16 )
+	{
+		run_value = _mm_loadu_si128(
+		             (__m128i *) &( run_data[ run_iterator ] ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf16_data[ 2 * run_iterator ] ),
+		 _mm_unpacklo_epi8(
+		  run_value,
+		  high_byte_value ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf16_data[ 2 * run_iterator + 16 ] ),
+		 _mm_unpackhi_epi8(
+		  run_value,
+		  high_byte_value ) );
+
+		run_iterator += 16;
+	}
+	return( run_iterator );
+}
+
+/* Expands a run of UTF-16 low bytes with a shared high byte using AVX2
+ * Every 16 bytes of the run are zero extended to 16-bit and combined
+ * with the high byte into 32 bytes of UTF-16 data
+ * Returns the number of run bytes expanded, which is a multiple of 16
+ */
+__attribute__((target("avx2")))
+size_t windows_search_expand_run_avx2(
+        uint8_t *utf16_data,
+        const uint8_t *run_data,
+        size_t run_size,
+        uint8_t compression_byte )
+{
+	__m256i high_byte_value = _mm256_setzero_si256();
+	__m256i utf16_value     = _mm256_setzero_si256();
+	size_t run_iterator     = 0;
+
+	high_byte_value = _mm256_set1_epi16(
+	                   (short) ( (uint16_t) compression_byte << 8 ) );
+
+	while( ( run_size - run_iterator ) >= 16 )
+	{
+		utf16_value = _mm256_cvtepu8_epi16(
+		               _mm_loadu_si128(
+		                (__m128i *) &( run_data[ run_iterator ] ) ) );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( utf16_data[ 2 * run_iterator ] ),
+		 _mm256_or_si256(
+		  utf16_value,
+		  high_byte_value ) );
+
+		run_iterator += 16;
+	}
+	return( run_iterator );
+}
+
+#endif /* defined( WINDOWS_SEARCH_HAVE_X86_SIMD ) */
+
 /* Decode data using Windows Search encoding
  * Returns 1 on success or -1 on error
  */
@@ -68,12 +261,29 @@ int windows_search_decode(
      size_t encoded_data_size,
      liberror_error_t **error )
 {
+	uint8_t keystream[ 256 ];
+
 	static char *function        = "windows_search_decode";
-	size_t data_iterator         = 0;
+	size_t block_size            = 0;
 	size_t encoded_data_iterator = 0;
+	size_t keystream_iterator    = 0;
 	uint32_t bitmask32           = 0;
-	uint8_t bitmask              = 0;
 
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+	int kernel                   = 0;
+#endif
+
+	if( data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
 	if( encoded_data == NULL )
 	{
 		liberror_error_set(
@@ -109,29 +319,58 @@ int windows_search_decode(
 	}
 	bitmask32 = 0x05000113 ^ (uint32_t) encoded_data_size;
 
-	for( encoded_data_iterator = 0;
-	     encoded_data_iterator < encoded_data_size;
-	     encoded_data_iterator++ )
+	/* The bitmask of a byte only depends on the lower 8 bits of its offset
+	 * so the keystream repeats every 256 bytes
+	 */
+	for( keystream_iterator = 0;
+	     keystream_iterator < 256;
+	     keystream_iterator++ )
+	{
+		keystream[ keystream_iterator ] = (uint8_t) ( ( bitmask32 >> ( 8 * ( keystream_iterator & 0x03 ) ) ) & 0xff )
+		                                ^ (uint8_t) keystream_iterator;
+	}
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+	kernel = windows_search_get_kernel();
+#endif
+	/* Decode in blocks of the keystream size which keeps the inner loop
+	 * free of dependencies
+	 */
+	while( encoded_data_iterator < encoded_data_size )
 	{
-		switch( encoded_data_iterator & 0x03 )
+		block_size = encoded_data_size - encoded_data_iterator;
+
+		if( block_size > 256 )
 		{
-			case 3:
-				bitmask = (uint8_t) ( ( bitmask32 >> 24 ) & 0xff );
-				break;
-			case 2:
-				bitmask = (uint8_t) ( ( bitmask32 >> 16 ) & 0xff );
-				break;
-			case 1:
-				bitmask = (uint8_t) ( ( bitmask32 >> 8 ) & 0xff );
-				break;
-			default:
-				bitmask = (uint8_t) ( bitmask32 & 0xff );
-				break;
+			block_size = 256;
+		}
+		keystream_iterator = 0;
+
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+		if( kernel == WINDOWS_SEARCH_KERNEL_AVX2 )
+		{
+			keystream_iterator = windows_search_decode_block_avx2(
+			                      &( data[ encoded_data_iterator ] ),
+			                      &( encoded_data[ encoded_data_iterator ] ),
+			                      keystream,
+			                      block_size );
+		}
+		else if( kernel == WINDOWS_SEARCH_KERNEL_SSE2 )
+		{
+			keystream_iterator = windows_search_decode_block_sse2(
+			                      &( data[ encoded_data_iterator ] ),
+			                      &( encoded_data[ encoded_data_iterator ] ),
+			                      keystream,
+			                      block_size );
 		}
-		bitmask ^= encoded_data_iterator;
+#endif
+		while( keystream_iterator < block_size )
+		{
+			data[ encoded_data_iterator + keystream_iterator ] = encoded_data[ encoded_data_iterator + keystream_iterator ]
+			                                                   ^ keystream[ keystream_iterator ];
 
-		data[ data_iterator++ ] = encoded_data[ encoded_data_iterator ]
-		                        ^ bitmask;
+			keystream_iterator++;
+		}
+		encoded_data_iterator += block_size;
 	}
 	return( 1 );
 }
@@ -248,12 +487,19 @@ int windows_search_decompress_run_length_compressed_utf16_string(
      size_t compressed_data_size,
      liberror_error_t **error )
 {
+	uint8_t *run_data                 = NULL;
+	uint8_t *utf16_data               = NULL;
 	static char *function             = "windows_search_decompress_run_length_compressed_utf16_string";
 	size_t compressed_data_iterator   = 0;
+	size_t run_iterator               = 0;
 	size_t uncompressed_data_iterator = 0;
 	uint8_t compression_size          = 0;
 	uint8_t compression_byte          = 0;
 
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+	int kernel                        = 0;
+#endif
+
 	if( uncompressed_data == NULL )
 	{
 		liberror_error_set(
@@ -298,6 +544,9 @@ int windows_search_decompress_run_length_compressed_utf16_string(
 
 		return( -1 );
 	}
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+	kernel = windows_search_get_kernel();
+#endif
 	while( compressed_data_iterator < compressed_data_size )
 	{
 		if( compressed_data_iterator >= compressed_data_size )
@@ -309,800 +558,94 @@ int windows_search_decompress_run_length_compressed_utf16_string(
 			 "%s: compressed data size value too small.",
 			 function );
 
-			return( -1 );
-		}
-		compression_size = compressed_data[ compressed_data_iterator++ ];
-
-		/* Check if the last byte in the compressed string was the compression size
-		 * or the run-length byte value
-		 */
-		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-		{
-			break;
-		}
-		/* Check if the compressed string was cut-short at the end
-		 */
-		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
-		{
-			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
-		}
-		if( compressed_data_iterator >= compressed_data_size )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: compressed data size value too small.",
-			 function );
-
-			return( -1 );
-		}
-		compression_byte = compressed_data[ compressed_data_iterator++ ];
-
-		while( compression_size > 0 )
-		{
-			if( compressed_data_iterator >= compressed_data_size )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: compressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			if( ( uncompressed_data_iterator + 1 ) >= uncompressed_data_size )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ compressed_data_iterator++ ];
-			uncompressed_data[ uncompressed_data_iterator++ ] = compression_byte;
-
-			compression_size--;
-		}
-	}
-	return( 1 );
-}
-
-/* Determines the uncompressed data size of a run-length compressed UTF-16 string
- * Returns 1 on success or -1 on error
- */
-int windows_search_get_byte_index_uncompressed_data_size(
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *uncompressed_data_size,
-     liberror_error_t **error )
-{
-	static char *function                  = "windows_search_get_byte_index_uncompressed_size";
-	uint16_t stored_uncompressed_data_size = 0;
-
-	if( compressed_data == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( uncompressed_data_size == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
-		 function );
-
-		return( -1 );
-	}
-	/* The first 2 bytes contain the uncompressed data size
-	 */
-	byte_stream_copy_to_uint16_little_endian(
-	 compressed_data,
-	 stored_uncompressed_data_size );
-
-	*uncompressed_data_size = (size_t) stored_uncompressed_data_size;
-
-	return( 1 );
-}
-
-/* Decompresses byte-index compressed data
- * Returns 1 on success or -1 on error
- */
-int windows_search_decompress_byte_indexed_compressed_data(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data, 
-     size_t compressed_data_size,
-     liberror_error_t **error )
-{
-	uint16_t compression_value_table[ 2048 ];
-
-	uint32_t nibble_count_table[ 16 ]       = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-	uint32_t total_nibble_count_table[ 16 ] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-
-	static char *function                   = "windows_search_decompress_byte_indexed_compressed_data";
-	size_t compressed_data_iterator         = 0;
-	size_t compression_iterator             = 0;
-	size_t uncompressed_data_iterator       = 0;
-
-	uint32_t compressed_data_bit_stream     = 0;
-	uint32_t compression_offset             = 0;
-	uint32_t nibble_count                   = 0;
-	uint32_t total_nibble_count             = 0;
-	uint32_t value_32bit                    = 0;
-	int32_t compression_value_table_index   = 0;
-	uint16_t compression_size               = 0;
-	uint16_t compression_value              = 0;
-	uint16_t stored_uncompressed_data_size  = 0;
-	uint16_t value_0x0400                   = 0;
-	uint16_t value_0x0800                   = 0;
-	uint16_t value_0x2000                   = 0;
-	uint8_t nibble_count_table_index        = 0;
-	int8_t number_of_bits_available         = 0;
-	int8_t number_of_bits_used              = 0;
-
-	if( uncompressed_data == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size <= 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
-		 function );
-
-		return( -1 );
-	}
-	if( memset(
-	     compression_value_table,
-	     0,
-	     2048 * 2 ) == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_MEMORY,
-		 LIBERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear compression value table.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libsystem_notify_verbose != 0 )
-	{
-		libsystem_notify_printf(
-		 "%s: compressed data header:\n",
-		 function );
-		libsystem_notify_print_data(
-		 compressed_data,
-		 258 );
-	}
-#endif
-	/* Byte 0 - 1 contain the uncompressed data size
-	 */
-	byte_stream_copy_to_uint16_little_endian(
-	 compressed_data,
-	 stored_uncompressed_data_size );
-
-	if( uncompressed_data_size < stored_uncompressed_data_size )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: uncompressed data size value too small.",
-		 function );
-
-		return( -1 );
-	}
-	/* Byte 2 - 257 contain the compression table
-	 *
-	 * The table contains a compression value for every byte
-	 * bits 0 - 3 contain ???
-	 * bits 4 - 7 contain the number of bits used to store the compressed data
-	 */
-	for( compressed_data_iterator = 0;
-	     compressed_data_iterator < 256;
-	     compressed_data_iterator++ )
-	{
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ];
-
-		nibble_count_table[ nibble_count_table_index & 0x0f ] += 1;
-		nibble_count_table[ nibble_count_table_index >> 4 ]   += 1;
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libsystem_notify_verbose != 0 )
-	{
-		libsystem_notify_printf(
-		 "%s: uncompressed data size:\t%" PRIu16 "\n",
-		 function,
-		 stored_uncompressed_data_size );
-
-		for( nibble_count_table_index = 0;
-		     nibble_count_table_index < 16;
-		     nibble_count_table_index++ )
-		{
-			libsystem_notify_printf(
-			 "%s: nibble count table index: %02d value:\t\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-			 function,
-			 nibble_count_table_index,
-			 nibble_count_table[ nibble_count_table_index ],
-			 nibble_count_table[ nibble_count_table_index ] );
-		}
-		libsystem_notify_printf(
-		 "\n" );
-	}
-#endif
-	if( nibble_count_table[ 0 ] >= 0x01ff )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: first nibble count table entry value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	/* Make copy of the nibble count table
-	 */
-	for( nibble_count_table_index = 0;
-	     nibble_count_table_index < 16;
-	     nibble_count_table_index++ )
-	{
-		total_nibble_count_table[ nibble_count_table_index ] = nibble_count_table[ nibble_count_table_index ];
-	}
-	/* TODO why this loop */
-	nibble_count = 0;
-
-	for( nibble_count_table_index = 15;
-	     nibble_count_table_index > 0;
-	     nibble_count_table_index-- )
-	{
-		nibble_count += total_nibble_count_table[ nibble_count_table_index ];
-
-		if( nibble_count == 1 )
-		{
-			break;
-		}
-		nibble_count >>= 1;
-	}
-	if( nibble_count != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: nibble count value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	/* Determine the total nible counts
-	 */
-	nibble_count = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libsystem_notify_verbose != 0 )
-	{
-		libsystem_notify_printf(
-		 "%s: total nibble count table index: %02d value:\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-		 function,
-		 0,
-		 total_nibble_count_table[ 0 ],
-		 total_nibble_count_table[ 0 ] );
-	}
-#endif
-
-	for( nibble_count_table_index = 1;
-	     nibble_count_table_index < 16;
-	     nibble_count_table_index++ )
-	{
-		total_nibble_count_table[ nibble_count_table_index ] += nibble_count;
-		nibble_count                                          = total_nibble_count_table[ nibble_count_table_index ];
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-		if( libsystem_notify_verbose != 0 )
-		{
-			libsystem_notify_printf(
-			 "%s: total nibble count table index: %02d value:\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-			 function,
-			 nibble_count_table_index,
-			 total_nibble_count_table[ nibble_count_table_index ],
-			 total_nibble_count_table[ nibble_count_table_index ] );
-		}
-#endif
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libsystem_notify_verbose != 0 )
-	{
-		libsystem_notify_printf(
-		 "\n" );
-	}
-#endif
-
-	total_nibble_count = nibble_count;
-
-	/* Fill the compression value table
-	 */
-	value_0x2000 = 0x2000;
-
-	while( value_0x2000 > 0 )
-	{
-		value_0x2000 -= 0x10;
-
-		compressed_data_iterator = value_0x2000 >> 5;
-
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ] >> 4;
-
-		if( nibble_count_table_index > 0 )
-		{
-			total_nibble_count_table[ nibble_count_table_index ] -= 1;
-			compression_value_table_index                         = total_nibble_count_table[ nibble_count_table_index ];
-
-			if( compression_value_table_index > 2048 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression value table index value exceeds maximum.",
-				 function );
-
-				return( -1 );
-			}
-			compression_value_table[ compression_value_table_index ] = value_0x2000 | nibble_count_table_index;
-		}
-		value_0x2000 -= 0x10;
-
-		compressed_data_iterator = value_0x2000 >> 5;
-
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ] & 0x0f;
-
-		if( nibble_count_table_index > 0 )
-		{
-			total_nibble_count_table[ nibble_count_table_index ] -= 1;
-			compression_value_table_index                         = total_nibble_count_table[ nibble_count_table_index ];
-
-			if( compression_value_table_index > 2048 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression value table index value exceeds maximum.",
-				 function );
-
-				return( -1 );
-			}
-			compression_value_table[ compression_value_table_index ] = value_0x2000 | nibble_count_table_index;
-		}
-	}
-	compression_value_table_index = 0x0800;
-	value_0x0800                  = 0x0800;
-	value_0x0400                  = 0x0400;
-
-	if( total_nibble_count > 2048 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: total nibble count value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	for( nibble_count_table_index = 15;
-	     nibble_count_table_index > 10;
-	     nibble_count_table_index-- )
-	{
-		if( value_0x0800 > compression_value_table_index )
-		{
-			value_0x0800                  -= 2;
-			compression_value_table_index -= 1;
-
-			compression_value_table[ compression_value_table_index ] = value_0x0800 | 0x8000;
-		}
-		for( nibble_count = nibble_count_table[ nibble_count_table_index ];
-		     nibble_count > 0;
-		     nibble_count-- )
-		{
-			total_nibble_count -= 1;
-
-			compression_value              = compression_value_table[ total_nibble_count ];
-			compression_value_table_index -= 1;
-
-			compression_value_table[ compression_value_table_index ] = compression_value;
-		}
-	}
-	while( value_0x0800 > compression_value_table_index )
-	{
-		value_0x0800 -= 2;
-		value_0x0400 -= 1;
-
-		compression_value_table[ value_0x0400 ] = value_0x0800 | 0x8000;
-	}
-	while( total_nibble_count > 0 )
-	{
-		total_nibble_count -= 1;
-
-		compression_value             = compression_value_table[ total_nibble_count ];
-		compression_value_table_index = value_0x0400 - ( 0x0400 >> ( compression_value & 0x0f ) );
-
-		do
-		{
-			value_0x0400 -= 1;
-
-			compression_value_table[ value_0x0400 ] = compression_value;
-		}
-		while( value_0x0400 > compression_value_table_index );
-	}
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libsystem_notify_verbose != 0 )
-	{
-		libsystem_notify_printf(
-		 "%s: compression value table:\n",
-		 function );
-		libsystem_notify_print_data(
-		 (uint8_t *) compression_value_table,
-		 2 * 2048 );
-	}
-#endif
-	/* Byte 258 - end contain the compression data bit stream
-	 */
-	compressed_data_iterator = 2 + 0x100;
-
-	if( ( compressed_data_iterator + 3 ) >= compressed_data_size )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
-		 function );
-
-		return( -1 );
-	}
-	/* Read the data as 16-bit little endian values
-	 */
-	compressed_data_bit_stream   = compressed_data[ compressed_data_iterator + 1 ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator + 3 ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator + 2 ];
-
-	compressed_data_iterator += 4;
-
-	number_of_bits_available = 0x10;
-
-	/* The compression data is stored a 16-bit little-endian values
-	 * it contains a bit stream which contains the following values
-	 * starting with the first bit in the stream
-	 * 0 - 9 compression value table index (where 0 is the MSB of the value)
-	 */
-	while( compressed_data_iterator < compressed_data_size )
-	{
-		/* Read a 10-bit table index from the decoded data
-		 * maximum index of 1023
-		 */
-		compression_value_table_index = compressed_data_bit_stream >> 0x16;
-
-		/* Check if the table entry contains an ignore index flag (bit 15)
-		 */
-		if( ( compression_value_table[ compression_value_table_index ] & 0x8000 ) != 0 )
-		{
-			/* Ignore the 10-bit index
-			 */
-			compressed_data_bit_stream <<= 10;
-
-			do
-			{
-				compression_value_table_index = compression_value_table[ compression_value_table_index ] & 0x7fff;
-
-				/* Add the MSB of the compressed data bit stream to the
-				 * compression value table index
-				 */
-				compression_value_table_index += compressed_data_bit_stream >> 31;
-
-				/* Ignore 1 bit for empty compression values
-				 */
-				compressed_data_bit_stream <<= 1;
-
-				if( compression_value_table_index > 2048 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: compression value table index value exceeds maximum.",
-					 function );
-
-					return( -1 );
-				}
-			}
-			while( compression_value_table[ compression_value_table_index ] == 0 );
-
-			/* Retrieve the number of bits used (lower 4-bit) of from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( compression_value_table[ compression_value_table_index ] & 0x0f );
-
-			/* Retrieve the compression value from the table entry
-			 */
-			compression_value = compression_value_table[ compression_value_table_index ] >> 4;
-
-			number_of_bits_available -= number_of_bits_used;
-		}
-		else
-		{
-			/* Retrieve the number of bits used (lower 4-bit) of from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( compression_value_table[ compression_value_table_index ] & 0x0f );
-
-			/* Retrieve the compression value from the table entry
-			 */
-			compression_value = compression_value_table[ compression_value_table_index ] >> 4;
-
-			number_of_bits_available    -= number_of_bits_used;
-			compressed_data_bit_stream <<= number_of_bits_used;
-		}
-		if( number_of_bits_available < 0 )
-		{
-			number_of_bits_used = -1 * number_of_bits_available;
-
-			if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: compressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			/* Read the data as 16-bit little endian values
-			 */
-			value_32bit   = compressed_data[ compressed_data_iterator + 1 ];
-			value_32bit <<= 8;
-			value_32bit  += compressed_data[ compressed_data_iterator ];
-
-			compressed_data_iterator += 2;
-
-			value_32bit               <<= number_of_bits_used;
-			compressed_data_bit_stream += value_32bit;
-
-			number_of_bits_available += 0x10;
-		}
-		/* Check if the table entry contains a compression tuple flag (bit 12)
-		 */
-		if( ( compression_value_table[ compression_value_table_index ] & 0x1000 ) != 0 )
-		{
-			/* Retrieve the size of the compression (bit 4-7) from the table entry
-			 */
-			compression_size = (uint16_t) ( ( compression_value_table[ compression_value_table_index ] >> 4 ) & 0x0f );
-
-			/* Retrieve the size of the compression (bit 8-11) from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( ( compression_value_table[ compression_value_table_index ] >> 8 ) & 0x0f );
-
-			/* Break if the end of the compressed data is reached
-			 * and both the compression size and number of bits used for the compression offset are 0
-			 */
-			if( ( compressed_data_iterator == compressed_data_size )
-			 && ( compression_size == 0 )
-			 && ( number_of_bits_used == 0 ) )
-			{
-				break;
-			}
-			/* Retrieve the compression offset from the decoded data
-			 */
-			compression_offset = ( compressed_data_bit_stream >> 1 ) | 0x80000000;
-
-			compression_offset = ( compression_offset >> ( 31 - number_of_bits_used ) );
-
-			compressed_data_bit_stream <<= number_of_bits_used;
-			number_of_bits_available    -= number_of_bits_used;
-
-			if( compression_size == 0x0f )
-			{
-				if( compressed_data_iterator >= compressed_data_size )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				compression_size += compressed_data[ compressed_data_iterator ];
-
-				compressed_data_iterator += 1;
-			}
-			if( compression_size == ( 0xff + 0x0f ) )
-			{
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				byte_stream_copy_to_uint16_little_endian(
-				 &( compressed_data[ compressed_data_iterator ] ),
-				 compression_size );
-
-				compressed_data_iterator += 2;
-
-				if( compression_size < ( 0xff + 0x0f ) )
-				{
-					/* TODO error */
-					return( -1 );
-				}
-			}
-			compression_size += 3;
-
-			if( number_of_bits_available < 0 )
-			{
-				number_of_bits_used = -1 * number_of_bits_available;
-
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				/* Read the data as 16-bit little endian values
-				 */
-				value_32bit   = compressed_data[ compressed_data_iterator + 1 ];
-				value_32bit <<= 8;
-				value_32bit  += compressed_data[ compressed_data_iterator ];
+			return( -1 );
+		}
+		compression_size = compressed_data[ compressed_data_iterator++ ];
 
-				compressed_data_iterator += 2;
+		/* Check if the last byte in the compressed string was the compression size
+		 * or the run-length byte value
+		 */
+		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		/* Check if the compressed string was cut-short at the end
+		 */
+		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
+		}
+		if( compressed_data_iterator >= compressed_data_size )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
 
-				value_32bit               <<= number_of_bits_used;
-				compressed_data_bit_stream += value_32bit;
+			return( -1 );
+		}
+		compression_byte = compressed_data[ compressed_data_iterator++ ];
 
-				number_of_bits_available += 0x10;
-			}
-			if( ( uncompressed_data_iterator + compression_size ) > uncompressed_data_size )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
-				 function );
+		if( ( compressed_data_iterator + compression_size ) > compressed_data_size )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
 
-				return( -1 );
-			}
-			if( compression_offset > uncompressed_data_iterator )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression offset value exceeds uncompressed data iterator.",
-				 function );
+			return( -1 );
+		}
+		if( ( uncompressed_data_iterator + ( 2 * (size_t) compression_size ) ) > uncompressed_data_size )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: uncompressed data size value too small.",
+			 function );
 
-				return( -1 );
-			}
-			compression_iterator = uncompressed_data_iterator - compression_offset;
+			return( -1 );
+		}
+		/* The run is bounds checked as a whole so the byte pairs
+		 * can be written without per character checks
+		 */
+		run_data   = &( compressed_data[ compressed_data_iterator ] );
+		utf16_data = &( uncompressed_data[ uncompressed_data_iterator ] );
 
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ uncompressed_data_iterator++ ] = uncompressed_data[ compression_iterator++ ];
+		run_iterator = 0;
 
-				compression_size--;
-			}
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+		if( kernel == WINDOWS_SEARCH_KERNEL_AVX2 )
+		{
+			run_iterator = windows_search_expand_run_avx2(
+			                utf16_data,
+			                run_data,
+			                (size_t) compression_size,
+			                compression_byte );
 		}
-		else
+		else if( kernel == WINDOWS_SEARCH_KERNEL_SSE2 )
 		{
-			if( uncompressed_data_iterator >= uncompressed_data_size )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
-				 function );
+			run_iterator = windows_search_expand_run_sse2(
+			                utf16_data,
+			                run_data,
+			                (size_t) compression_size,
+			                compression_byte );
+		}
+#endif
+		while( run_iterator < (size_t) compression_size )
+		{
+			utf16_data[ 2 * run_iterator ]     = run_data[ run_iterator ];
+			utf16_data[ 2 * run_iterator + 1 ] = compression_byte;
 
-				return( -1 );
-			}
-			uncompressed_data[ uncompressed_data_iterator++ ] = (uint8_t) ( compression_value & 0xff );
+			run_iterator++;
 		}
+		compressed_data_iterator   += compression_size;
+		uncompressed_data_iterator += 2 * (size_t) compression_size;
 	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libsystem_notify_verbose != 0 )
-	{
-		libsystem_notify_printf(
-		 "%s: uncompressed data:\n",
-		 function );
-		libsystem_notify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_iterator );
-	}
-#endif
 	return( 1 );
 }
 
@@ -1238,7 +781,7 @@ int windows_search_export_compressed_string_value(
 	 */
 	if( ( compression_type & 0x02 ) != 0 )
 	{
-		if( windows_search_get_byte_index_uncompressed_data_size(
+		if( libesedb_compression_byte_index_decompress_get_size(
 		     &( decoded_value_data[ 1 ] ),
 		     decoded_value_data_size - 1,
 		     &decompressed_value_data_size,
@@ -1280,11 +823,11 @@ int windows_search_export_compressed_string_value(
 		 */
 		decompressed_value_data[ 0 ] = decoded_value_data[ 0 ] - 2;
 
-		result = windows_search_decompress_byte_indexed_compressed_data(
-		          &( decompressed_value_data[ 1 ] ),
-		          decompressed_value_data_size - 1,
+		result = libesedb_compression_byte_index_decompress(
 		          &( decoded_value_data[ 1 ] ),
 		          decoded_value_data_size - 1,
+		          &( decompressed_value_data[ 1 ] ),
+		          decompressed_value_data_size - 1,
 		          error );
 
 		if( result != 1 )
@@ -2675,19 +2218,17 @@ int windows_search_export_record_value_utf16_string(
 	return( 1 );
 }
 
-/* Exports the values in a SystemIndex_0A table record
+/* Determines the column plan of a SystemIndex_0A table from the columns of a record
  * Returns 1 if successful or -1 on error
  */
-int windows_search_export_record_systemindex_0a(
+int windows_search_get_systemindex_0a_column_plan(
      libesedb_record_t *record,
-     int ascii_codepage,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "windows_search_export_record_systemindex_0a";
+	static char *function   = "windows_search_get_systemindex_0a_column_plan";
 	size_t column_name_size = 0;
 	uint32_t column_type    = 0;
 	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_BIG;
@@ -2708,13 +2249,13 @@ int windows_search_export_record_systemindex_0a(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( column_plan == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid column plan.",
 		 function );
 
 		return( -1 );
@@ -2733,6 +2274,20 @@ int windows_search_export_record_systemindex_0a(
 
 		return( -1 );
 	}
+	if( export_column_plan_initialize(
+	     column_plan,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column plan.",
+		 function );
+
+		return( -1 );
+	}
 	for( value_iterator = 0;
 	     value_iterator < number_of_values;
 	     value_iterator++ )
@@ -2761,7 +2316,7 @@ int windows_search_export_record_systemindex_0a(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -2775,7 +2330,7 @@ int windows_search_export_record_systemindex_0a(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libesedb_record_get_utf16_column_name(
@@ -2802,7 +2357,7 @@ int windows_search_export_record_systemindex_0a(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_record_get_column_type(
 		     record,
@@ -2818,7 +2373,7 @@ int windows_search_export_record_systemindex_0a(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED;
 
@@ -3501,92 +3056,46 @@ int windows_search_export_record_systemindex_0a(
 				}
 			}
 		}
-		if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = windows_search_export_record_value_32bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = windows_search_export_record_value_64bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  format,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = windows_search_export_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED )
-		{
-			result = windows_search_export_record_value_compressed_string(
-				  record,
-				  value_iterator,
-				  ascii_codepage,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
+		if( export_column_plan_set_entry(
+		     *column_plan,
+		     value_iterator,
+		     known_column_type,
+		     byte_order,
+		     format,
+		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column plan entry: %d.",
 			 function,
 			 value_iterator );
 
-			return( -1 );
-		}
-		if( value_iterator == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			goto on_error;
 		}
 	}
 	return( 1 );
+
+on_error:
+	export_column_plan_free(
+	 column_plan,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Exports the values in a SystemIndex_Gthr table record
+/* Determines the column plan of a SystemIndex_Gthr table from the columns of a record
  * Returns 1 if successful or -1 on error
  */
-int windows_search_export_record_systemindex_gthr(
+int windows_search_get_systemindex_gthr_column_plan(
      libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "windows_search_export_record_systemindex_gthr";
+	static char *function   = "windows_search_get_systemindex_gthr_column_plan";
 	size_t column_name_size = 0;
 	uint32_t column_type    = 0;
 	int known_column_type   = 0;
@@ -3606,13 +3115,13 @@ int windows_search_export_record_systemindex_gthr(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( column_plan == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid column plan.",
 		 function );
 
 		return( -1 );
@@ -3631,6 +3140,20 @@ int windows_search_export_record_systemindex_gthr(
 
 		return( -1 );
 	}
+	if( export_column_plan_initialize(
+	     column_plan,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column plan.",
+		 function );
+
+		return( -1 );
+	}
 	for( value_iterator = 0;
 	     value_iterator < number_of_values;
 	     value_iterator++ )
@@ -3659,7 +3182,7 @@ int windows_search_export_record_systemindex_gthr(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -3673,7 +3196,7 @@ int windows_search_export_record_systemindex_gthr(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libesedb_record_get_utf16_column_name(
@@ -3700,7 +3223,7 @@ int windows_search_export_record_systemindex_gthr(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_record_get_column_type(
 		     record,
@@ -3716,7 +3239,7 @@ int windows_search_export_record_systemindex_gthr(
 			 function,
 			 value_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED;
 
@@ -3756,32 +3279,175 @@ int windows_search_export_record_systemindex_gthr(
 				}
 			}
 		}
-		if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = windows_search_export_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN )
+		if( export_column_plan_set_entry(
+		     *column_plan,
+		     value_iterator,
+		     known_column_type,
+		     byte_order,
+		     0,
+		     error ) != 1 )
 		{
-			result = windows_search_export_record_value_utf16_string(
-				  record,
-				  value_iterator,
-				  LIBUNA_ENDIAN_LITTLE,
-				  record_file_stream,
-				  error );
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column plan entry: %d.",
+			 function,
+			 value_iterator );
+
+			goto on_error;
 		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED )
+	}
+	return( 1 );
+
+on_error:
+	export_column_plan_free(
+	 column_plan,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Exports the values in a Windows Search table record using the column plan
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_export_record(
+     libesedb_record_t *record,
+     export_column_plan_t *column_plan,
+     int ascii_codepage,
+     export_buffer_t *value_buffer,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     liberror_error_t **error )
+{
+	export_column_plan_entry_t *column_plan_entry = NULL;
+	static char *function                         = "windows_search_export_record";
+	int number_of_values                          = 0;
+	int result                                    = 0;
+	int value_iterator                            = 0;
+
+	if( record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_plan == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_file_stream == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values != column_plan->number_of_entries )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of values does not match column plan.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_values;
+	     value_iterator++ )
+	{
+		column_plan_entry = &( column_plan->entries[ value_iterator ] );
+
+		switch( column_plan_entry->known_column_type )
 		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_32BIT:
+				result = windows_search_export_record_value_32bit(
+					  record,
+					  value_iterator,
+					  column_plan_entry->byte_order,
+					  record_file_stream,
+					  error );
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT:
+				result = windows_search_export_record_value_64bit(
+					  record,
+					  value_iterator,
+					  column_plan_entry->byte_order,
+					  column_plan_entry->format,
+					  record_file_stream,
+					  error );
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME:
+				result = windows_search_export_record_value_filetime(
+					  record,
+					  value_iterator,
+					  column_plan_entry->byte_order,
+					  record_file_stream,
+					  error );
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED:
+				result = windows_search_export_record_value_compressed_string(
+					  record,
+					  value_iterator,
+					  ascii_codepage,
+					  record_file_stream,
+					  error );
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN:
+				result = windows_search_export_record_value_utf16_string(
+					  record,
+					  value_iterator,
+					  LIBUNA_ENDIAN_LITTLE,
+					  record_file_stream,
+					  error );
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED:
+			default:
+				result = export_handle_export_record_value(
+					  record,
+					  value_iterator,
+					  value_buffer,
+					  record_file_stream,
+					  log_handle,
+					  error );
+				break;
 		}
 		if( result != 1 )
 		{
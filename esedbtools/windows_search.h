@@ -29,12 +29,54 @@
 #include <liberror.h>
 
 #include "esedbtools_libesedb.h"
+#include "export_buffer.h"
+#include "export_column_plan.h"
 #include "log_handle.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The SIMD decoding kernels are available on x86 and x86-64 when the compiler
+ * supports function specific target options and runtime CPU detection
+ */
+#if ( defined( __i386__ ) || defined( __x86_64__ ) ) \
+ && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) ) ) \
+ && !defined( LIBESEDB_DISABLE_SIMD )
+#define WINDOWS_SEARCH_HAVE_X86_SIMD
+#endif
+
+#if defined( WINDOWS_SEARCH_HAVE_X86_SIMD )
+
+int windows_search_get_kernel(
+     void );
+
+size_t windows_search_decode_block_sse2(
+        uint8_t *data,
+        const uint8_t *encoded_data,
+        const uint8_t *keystream,
+        size_t block_size );
+
+size_t windows_search_decode_block_avx2(
+        uint8_t *data,
+        const uint8_t *encoded_data,
+        const uint8_t *keystream,
+        size_t block_size );
+
+size_t windows_search_expand_run_sse2(
+        uint8_t *utf16_data,
+        const uint8_t *run_data,
+        size_t run_size,
+        uint8_t compression_byte );
+
+size_t windows_search_expand_run_avx2(
+        uint8_t *utf16_data,
+        const uint8_t *run_data,
+        size_t run_size,
+        uint8_t compression_byte );
+
+#endif /* defined( WINDOWS_SEARCH_HAVE_X86_SIMD ) */
+
 int windows_search_decode(
      uint8_t *data,
      size_t data_size,
@@ -55,19 +97,6 @@ int windows_search_decompress_run_length_compressed_utf16_string(
      size_t compressed_data_size,
      liberror_error_t **error );
 
-int windows_search_get_byte_index_uncompressed_data_size(
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *uncompressed_data_size,
-     liberror_error_t **error );
-
-int windows_search_decompress_byte_indexed_compressed_data(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     liberror_error_t **error );
-
 int windows_search_export_compressed_string_value(
      uint8_t *value_data,
      size_t value_data_size,
@@ -111,15 +140,21 @@ int windows_search_export_record_value_utf16_string(
      FILE *record_file_stream,
      liberror_error_t **error );
 
-int windows_search_export_record_systemindex_0a(
+int windows_search_get_systemindex_0a_column_plan(
      libesedb_record_t *record,
-     int ascii_codepage,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+     export_column_plan_t **column_plan,
      liberror_error_t **error );
 
-int windows_search_export_record_systemindex_gthr(
+int windows_search_get_systemindex_gthr_column_plan(
      libesedb_record_t *record,
+     export_column_plan_t **column_plan,
+     liberror_error_t **error );
+
+int windows_search_export_record(
+     libesedb_record_t *record,
+     export_column_plan_t *column_plan,
+     int ascii_codepage,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error );
@@ -0,0 +1,609 @@
+/*
+ * Replays Windows Search SystemIndex_0A value blobs through the decoding functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "esedbtools_libesedb.h"
+#include "windows_search.h"
+
+/* The maximum size of a blob
+ */
+#define WINDOWS_SEARCH_REPLAY_MAXIMUM_BLOB_SIZE		( 16 * 1024 * 1024 )
+
+/* The number of synthetic blobs replayed when no blob files are provided
+ */
+#define WINDOWS_SEARCH_REPLAY_NUMBER_OF_SYNTHETIC_BLOBS	4096
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use windows_search_replay to replay Windows Search SystemIndex_0A compressed\n"
+	                 "string value blobs through the decoding functions and compare the results\n"
+	                 "with a byte by byte reference implementation.\n\n" );
+
+	fprintf( stream, "Usage: windows_search_replay [ -h ] [ -i iterations ] [ blob ... ]\n\n" );
+
+	fprintf( stream, "\tblob: a file that contains a single undecoded column value,\n"
+	                 "\t      synthetic blobs are replayed if no blob is provided\n\n" );
+
+	fprintf( stream, "\t-h:   shows this help\n" );
+	fprintf( stream, "\t-i:   number of timed iterations per blob, default is 1\n" );
+}
+
+/* Decodes data byte by byte using Windows Search encoding
+ */
+void windows_search_replay_reference_decode(
+      uint8_t *data,
+      const uint8_t *encoded_data,
+      size_t encoded_data_size )
+{
+	size_t encoded_data_iterator = 0;
+	uint32_t bitmask32           = 0;
+	uint8_t bitmask              = 0;
+
+	bitmask32 = 0x05000113 ^ (uint32_t) encoded_data_size;
+
+	for( encoded_data_iterator = 0;
+	     encoded_data_iterator < encoded_data_size;
+	     encoded_data_iterator++ )
+	{
+		bitmask = (uint8_t) ( ( bitmask32 >> ( 8 * ( encoded_data_iterator & 0x03 ) ) ) & 0xff );
+
+		bitmask ^= (uint8_t) encoded_data_iterator;
+
+		data[ encoded_data_iterator ] = encoded_data[ encoded_data_iterator ]
+		                              ^ bitmask;
+	}
+}
+
+/* Decompresses a run-length compressed UTF-16 string byte by byte
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t windows_search_replay_reference_decompress(
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         const uint8_t *compressed_data,
+         size_t compressed_data_size )
+{
+	size_t compressed_data_iterator   = 0;
+	size_t uncompressed_data_iterator = 0;
+	uint8_t compression_size          = 0;
+	uint8_t compression_byte          = 0;
+
+	while( compressed_data_iterator < compressed_data_size )
+	{
+		compression_size = compressed_data[ compressed_data_iterator++ ];
+
+		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
+		}
+		compression_byte = compressed_data[ compressed_data_iterator++ ];
+
+		while( compression_size > 0 )
+		{
+			if( ( uncompressed_data_iterator + 2 ) > uncompressed_data_size )
+			{
+				return( -1 );
+			}
+			uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ compressed_data_iterator++ ];
+			uncompressed_data[ uncompressed_data_iterator++ ] = compression_byte;
+
+			compression_size--;
+		}
+	}
+	return( (ssize_t) uncompressed_data_iterator );
+}
+
+/* Creates a synthetic blob
+ * The blob contains a run-length compressed UTF-16 string that is encoded
+ * Returns the size of the blob
+ */
+size_t windows_search_replay_create_synthetic_blob(
+        uint8_t *blob,
+        size_t maximum_blob_size,
+        uint8_t *scratch )
+{
+	size_t blob_size     = 0;
+	size_t maximum_size  = 0;
+	size_t run_iterator  = 0;
+	uint8_t run_size     = 0;
+
+	maximum_size = 1 + (size_t) ( rand() % 4096 );
+
+	if( maximum_size > maximum_blob_size )
+	{
+		maximum_size = maximum_blob_size;
+	}
+	scratch[ blob_size++ ] = 0;
+
+	while( ( blob_size + 2 ) < maximum_size )
+	{
+		run_size = (uint8_t) ( rand() % 256 );
+
+		scratch[ blob_size++ ] = run_size;
+		scratch[ blob_size++ ] = (uint8_t) ( rand() % 256 );
+
+		/* Runs are cut short at the end of the blob as in the stored values
+		 */
+		for( run_iterator = 0;
+		     ( run_iterator < (size_t) run_size ) && ( blob_size < maximum_size );
+		     run_iterator++ )
+		{
+			scratch[ blob_size++ ] = (uint8_t) ( rand() % 256 );
+		}
+	}
+	/* The encoding is its own inverse
+	 */
+	windows_search_replay_reference_decode(
+	 blob,
+	 scratch,
+	 blob_size );
+
+	return( blob_size );
+}
+
+/* Replays a single blob
+ * Returns 1 if the results match, 0 if not or -1 on error
+ */
+int windows_search_replay_blob(
+     const uint8_t *blob,
+     size_t blob_size,
+     int number_of_iterations,
+     double *reference_time,
+     double *replay_time,
+     liberror_error_t **error )
+{
+	uint8_t *decoded_data             = NULL;
+	uint8_t *reference_decoded_data   = NULL;
+	uint8_t *reference_utf16_data     = NULL;
+	uint8_t *utf16_data               = NULL;
+	static char *function             = "windows_search_replay_blob";
+	clock_t start_time                = 0;
+	size_t utf16_data_size            = 0;
+	ssize_t reference_utf16_data_size = 0;
+	int iteration                     = 0;
+	int result                        = 1;
+
+	decoded_data = (uint8_t *) memory_allocate(
+	                            blob_size );
+
+	reference_decoded_data = (uint8_t *) memory_allocate(
+	                                      blob_size );
+
+	if( ( decoded_data == NULL )
+	 || ( reference_decoded_data == NULL ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoded data.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		windows_search_replay_reference_decode(
+		 reference_decoded_data,
+		 blob,
+		 blob_size );
+	}
+	*reference_time += (double) ( clock() - start_time ) / CLOCKS_PER_SEC;
+
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( windows_search_decode(
+		     decoded_data,
+		     blob_size,
+		     (uint8_t *) blob,
+		     blob_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode blob.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*replay_time += (double) ( clock() - start_time ) / CLOCKS_PER_SEC;
+
+	if( memory_compare(
+	     decoded_data,
+	     reference_decoded_data,
+	     blob_size ) != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "decoded data mismatch\n" );
+
+		result = 0;
+	}
+	/* Only the run-length compressed UTF-16 strings are replayed further
+	 */
+	if( ( result == 1 )
+	 && ( blob_size > 1 )
+	 && ( decoded_data[ 0 ] == 0 ) )
+	{
+		if( windows_search_get_run_length_uncompressed_utf16_string_size(
+		     &( decoded_data[ 1 ] ),
+		     blob_size - 1,
+		     &utf16_data_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run-length uncompressed UTF-16 string size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( result == 1 )
+	 && ( utf16_data_size > 0 ) )
+	{
+		utf16_data = (uint8_t *) memory_allocate(
+		                          utf16_data_size );
+
+		reference_utf16_data = (uint8_t *) memory_allocate(
+		                                    utf16_data_size );
+
+		if( ( utf16_data == NULL )
+		 || ( reference_utf16_data == NULL ) )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 data.",
+			 function );
+
+			goto on_error;
+		}
+		start_time = clock();
+
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			reference_utf16_data_size = windows_search_replay_reference_decompress(
+			                             reference_utf16_data,
+			                             utf16_data_size,
+			                             &( decoded_data[ 1 ] ),
+			                             blob_size - 1 );
+		}
+		*reference_time += (double) ( clock() - start_time ) / CLOCKS_PER_SEC;
+
+		start_time = clock();
+
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			if( windows_search_decompress_run_length_compressed_utf16_string(
+			     utf16_data,
+			     utf16_data_size,
+			     &( decoded_data[ 1 ] ),
+			     blob_size - 1,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decompress run-length compressed UTF-16 string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		*replay_time += (double) ( clock() - start_time ) / CLOCKS_PER_SEC;
+
+		if( ( reference_utf16_data_size != (ssize_t) utf16_data_size )
+		 || ( memory_compare(
+		       utf16_data,
+		       reference_utf16_data,
+		       utf16_data_size ) != 0 ) )
+		{
+			fprintf(
+			 stdout,
+			 "UTF-16 data mismatch\n" );
+
+			result = 0;
+		}
+	}
+	if( reference_utf16_data != NULL )
+	{
+		memory_free(
+		 reference_utf16_data );
+	}
+	if( utf16_data != NULL )
+	{
+		memory_free(
+		 utf16_data );
+	}
+	memory_free(
+	 reference_decoded_data );
+	memory_free(
+	 decoded_data );
+
+	return( result );
+
+on_error:
+	if( reference_utf16_data != NULL )
+	{
+		memory_free(
+		 reference_utf16_data );
+	}
+	if( utf16_data != NULL )
+	{
+		memory_free(
+		 utf16_data );
+	}
+	if( reference_decoded_data != NULL )
+	{
+		memory_free(
+		 reference_decoded_data );
+	}
+	if( decoded_data != NULL )
+	{
+		memory_free(
+		 decoded_data );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+int main( int argc, char * const argv[] )
+{
+	liberror_error_t *error      = NULL;
+	FILE *blob_stream            = NULL;
+	uint8_t *blob                = NULL;
+	uint8_t *scratch             = NULL;
+	double reference_time        = 0.0;
+	double replay_time           = 0.0;
+	size_t blob_size             = 0;
+	size_t total_blob_size       = 0;
+	int argument_index           = 1;
+	int blob_index               = 0;
+	int number_of_blobs          = 0;
+	int number_of_iterations     = 1;
+	int number_of_mismatches     = 0;
+	int result                   = 0;
+
+	while( ( argument_index < argc )
+	    && ( argv[ argument_index ][ 0 ] == '-' ) )
+	{
+		if( ( argv[ argument_index ][ 1 ] == 'h' )
+		 && ( argv[ argument_index ][ 2 ] == 0 ) )
+		{
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		else if( ( argv[ argument_index ][ 1 ] == 'i' )
+		      && ( argv[ argument_index ][ 2 ] == 0 )
+		      && ( ( argument_index + 1 ) < argc ) )
+		{
+			number_of_iterations = atoi(
+			                        argv[ argument_index + 1 ] );
+
+			argument_index += 2;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Invalid argument: %s\n",
+			 argv[ argument_index ] );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( number_of_iterations <= 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of iterations.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	blob = (uint8_t *) memory_allocate(
+	                    WINDOWS_SEARCH_REPLAY_MAXIMUM_BLOB_SIZE );
+
+	scratch = (uint8_t *) memory_allocate(
+	                       WINDOWS_SEARCH_REPLAY_MAXIMUM_BLOB_SIZE );
+
+	if( ( blob == NULL )
+	 || ( scratch == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create blob.\n" );
+
+		goto on_error;
+	}
+	if( argument_index < argc )
+	{
+		number_of_blobs = argc - argument_index;
+	}
+	else
+	{
+		number_of_blobs = WINDOWS_SEARCH_REPLAY_NUMBER_OF_SYNTHETIC_BLOBS;
+
+		srand(
+		 1 );
+	}
+	for( blob_index = 0;
+	     blob_index < number_of_blobs;
+	     blob_index++ )
+	{
+		if( argument_index < argc )
+		{
+			blob_stream = file_stream_open(
+			               argv[ argument_index + blob_index ],
+			               FILE_STREAM_OPEN_READ );
+
+			if( blob_stream == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open blob: %s.\n",
+				 argv[ argument_index + blob_index ] );
+
+				goto on_error;
+			}
+			blob_size = file_stream_read(
+			             blob_stream,
+			             blob,
+			             WINDOWS_SEARCH_REPLAY_MAXIMUM_BLOB_SIZE );
+
+			file_stream_close(
+			 blob_stream );
+
+			if( blob_size == 0 )
+			{
+				continue;
+			}
+		}
+		else
+		{
+			blob_size = windows_search_replay_create_synthetic_blob(
+			             blob,
+			             WINDOWS_SEARCH_REPLAY_MAXIMUM_BLOB_SIZE,
+			             scratch );
+		}
+		result = windows_search_replay_blob(
+		          blob,
+		          blob_size,
+		          number_of_iterations,
+		          &reference_time,
+		          &replay_time,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to replay blob: %d.\n",
+			 blob_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Blob: %d of size: %" PRIzd " does not match the reference.\n",
+			 blob_index,
+			 blob_size );
+
+			number_of_mismatches++;
+		}
+		total_blob_size += blob_size;
+	}
+	fprintf(
+	 stdout,
+	 "Replayed: %d blobs of %" PRIzd " bytes in total, %d mismatches.\n",
+	 number_of_blobs,
+	 total_blob_size,
+	 number_of_mismatches );
+
+	fprintf(
+	 stdout,
+	 "Reference: %.3f seconds, replay: %.3f seconds.\n",
+	 reference_time,
+	 replay_time );
+
+	memory_free(
+	 scratch );
+	memory_free(
+	 blob );
+
+	if( number_of_mismatches != 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		liberror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		liberror_error_free(
+		 &error );
+	}
+	if( scratch != NULL )
+	{
+		memory_free(
+		 scratch );
+	}
+	if( blob != NULL )
+	{
+		memory_free(
+		 blob );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -431,6 +431,7 @@ int windows_security_export_record_value_utf16_string(
  */
 int windows_security_export_record_smtblversion(
      libesedb_record_t *record,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error )
@@ -631,6 +632,7 @@ int windows_security_export_record_smtblversion(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
+				  value_buffer,
 				  record_file_stream,
 				  log_handle,
 				  error );
@@ -668,6 +670,7 @@ int windows_security_export_record_smtblversion(
  */
 int windows_security_export_record_smtblsection(
      libesedb_record_t *record,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error )
@@ -848,6 +851,7 @@ int windows_security_export_record_smtblsection(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
+				  value_buffer,
 				  record_file_stream,
 				  log_handle,
 				  error );
@@ -29,6 +29,7 @@
 #include <liberror.h>
 
 #include "esedbtools_libesedb.h"
+#include "export_buffer.h"
 #include "log_handle.h"
 
 #if defined( __cplusplus )
@@ -51,12 +52,14 @@ int windows_security_export_record_value_utf16_string(
 
 int windows_security_export_record_smtblversion(
      libesedb_record_t *record,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error );
 
 int windows_security_export_record_smtblsection(
      libesedb_record_t *record,
+     export_buffer_t *value_buffer,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      liberror_error_t **error );
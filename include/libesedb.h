@@ -101,6 +101,31 @@ int libesedb_check_file_signature_file_io_handle(
      libesedb_error_t **error );
 #endif
 
+/* -------------------------------------------------------------------------
+ * Compression functions
+ * ------------------------------------------------------------------------- */
+
+/* Determines the uncompressed data size of (Windows Search) byte-index compressed-data
+ * Returns 1 on success or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_compression_byte_index_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libesedb_error_t **error );
+
+/* Decompresses (Windows Search) byte-index compressed-data
+ * Returns 1 on success or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_compression_byte_index_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libesedb_error_t **error );
+
 /* -------------------------------------------------------------------------
  * Notify functions
  * ------------------------------------------------------------------------- */
@@ -290,6 +315,124 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libesedb_error_t **error );
 
+/* Retrieves the checksum policy
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_get_checksum_policy(
+     libesedb_file_t *file,
+     uint8_t *checksum_policy,
+     libesedb_error_t **error );
+
+/* Sets the checksum policy
+ * The policy determines if the page checksums are verified always, once or never
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_set_checksum_policy(
+     libesedb_file_t *file,
+     uint8_t checksum_policy,
+     libesedb_error_t **error );
+
+/* Retrieves the size of the pages cache in bytes
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_get_cache_size(
+     libesedb_file_t *file,
+     size64_t *cache_size,
+     libesedb_error_t **error );
+
+/* Sets the size of the pages cache in bytes
+ * The pages cache is shared by all the tables and indexes of the file
+ * The size must be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_set_cache_size(
+     libesedb_file_t *file,
+     size64_t cache_size,
+     libesedb_error_t **error );
+
+/* Retrieves the number of leaf pages that are read ahead
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_get_readahead_window(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libesedb_error_t **error );
+
+/* Sets the number of leaf pages that are read ahead
+ * The leaf pages are read ahead when they are read sequentially
+ * The child pages of a branch page are read ahead when the branch page is read
+ * 0 disables the read ahead
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_set_readahead_window(
+     libesedb_file_t *file,
+     uint32_t number_of_pages,
+     libesedb_error_t **error );
+
+/* Retrieves the value to indicate the catalog is read on demand
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_get_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t *read_on_demand,
+     libesedb_error_t **error );
+
+/* Sets the value to indicate the catalog is read on demand
+ * If set only the table definitions are read when the tables are first accessed
+ * and the column and index definitions of a table when the table is first retrieved
+ * otherwise the entire catalog is read when the file is opened
+ * This value needs to be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t read_on_demand,
+     libesedb_error_t **error );
+
+/* Sets the filename of the catalog cache file
+ * The catalog cache file contains a copy of the catalog that is used instead of
+ * the catalog in the database file when it was written for the same state of the database file
+ * If the catalog cache file is missing or does not match it is (re)written when the file is opened
+ * This value needs to be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_cache_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     libesedb_error_t **error );
+
+#if defined( LIBESEDB_HAVE_WIDE_CHARACTER_TYPE )
+/* Sets the filename of the catalog cache file
+ * This value needs to be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_cache_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libesedb_error_t **error );
+#endif
+
+/* Retrieves the checksum status of a specific page
+ * The status is only known for pages that were read while the checksums were verified
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_file_get_page_checksum_status(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     uint8_t *checksum_status,
+     libesedb_error_t **error );
+
 /* Retrieves the number of tables
  * Returns 1 if successful or -1 on error
  */
@@ -481,6 +624,38 @@ int libesedb_table_get_column(
      uint8_t flags,
      libesedb_error_t **error );
 
+/* Retrieves the column for the specific UTF-8 encoded name
+ *
+ * Use the flag LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE to retrieve the column
+ * ignoring the template table
+ *
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libesedb_error_t **error );
+
+/* Retrieves the column for the specific UTF-16 encoded name
+ *
+ * Use the flag LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE to retrieve the column
+ * ignoring the template table
+ *
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libesedb_error_t **error );
+
 /* Retrieves the number of indexes
  * Returns 1 if successful or -1 on error
  */
@@ -519,6 +694,28 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libesedb_error_t **error );
 
+/* Retrieves the record for the specific entry only reading the values of the specified columns
+ * The values of the other columns in the record are empty
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_with_columns(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libesedb_record_t **record,
+     libesedb_error_t **error );
+
+/* Opens a cursor to sequentially read the records in the table
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_table_open_cursor(
+     libesedb_table_t *table,
+     libesedb_cursor_t **cursor,
+     libesedb_error_t **error );
+
 /* -------------------------------------------------------------------------
  * Table functions - deprecated
  * ------------------------------------------------------------------------- */
@@ -713,6 +910,57 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libesedb_error_t **error );
 
+/* Opens a cursor to sequentially read the records in the index
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_index_open_cursor(
+     libesedb_index_t *index,
+     libesedb_cursor_t **cursor,
+     libesedb_error_t **error );
+
+/* -------------------------------------------------------------------------
+ * Cursor functions
+ * ------------------------------------------------------------------------- */
+
+/* Frees a cursor
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_cursor_free(
+     libesedb_cursor_t **cursor,
+     libesedb_error_t **error );
+
+/* Sets the column identifiers of the columns to read
+ * The records retrieved by the cursor will only contain the values of these columns
+ * If column identifiers is NULL all the columns are read
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_cursor_set_column_identifiers(
+     libesedb_cursor_t *cursor,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libesedb_error_t **error );
+
+/* Moves the cursor to the next record
+ * The leaf pages are read once in the order of their next page links
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_cursor_next(
+     libesedb_cursor_t *cursor,
+     libesedb_error_t **error );
+
+/* Retrieves the record at the current position of the cursor
+ * Returns 1 if successful or -1 on error
+ */
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libesedb_error_t **error );
+
 /* -------------------------------------------------------------------------
  * Record (row) functions
  * ------------------------------------------------------------------------- */
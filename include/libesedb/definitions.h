@@ -33,13 +33,15 @@
 /* The access flags definitions
  * bit 1        set to 1 for read access
  * bit 2        set to 1 for write access
- * bit 3-8      not used
+ * bit 3        set to 1 to memory map the file (read access only)
+ * bit 4-8      not used
  */
 enum LIBESEDB_ACCESS_FLAGS
 {
 	LIBESEDB_ACCESS_FLAG_READ					= 0x01,
 /* Reserved: not supported yet */
-	LIBESEDB_ACCESS_FLAG_WRITE					= 0x02
+	LIBESEDB_ACCESS_FLAG_WRITE					= 0x02,
+	LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED				= 0x04
 };
 
 /* The file access macros
@@ -103,5 +105,23 @@ enum LIBESEDB_VALUE_FLAGS
 	LIBESEDB_VALUE_FLAG_MULTI_VALUE					= 0x08,
 };
 
+/* The checksum policies
+ */
+enum LIBESEDB_CHECKSUM_POLICIES
+{
+	LIBESEDB_CHECKSUM_POLICY_ALWAYS					= 0,
+	LIBESEDB_CHECKSUM_POLICY_ONCE					= 1,
+	LIBESEDB_CHECKSUM_POLICY_NEVER					= 2
+};
+
+/* The page checksum status
+ */
+enum LIBESEDB_PAGE_CHECKSUM_STATUS
+{
+	LIBESEDB_PAGE_CHECKSUM_STATUS_UNVERIFIED			= 0,
+	LIBESEDB_PAGE_CHECKSUM_STATUS_VALID				= 1,
+	LIBESEDB_PAGE_CHECKSUM_STATUS_MISMATCH				= 2
+};
+
 #endif
 
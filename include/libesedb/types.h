@@ -207,6 +207,7 @@ typedef int64_t off64_t;
 typedef intptr_t libesedb_file_t;
 typedef intptr_t libesedb_table_t;
 typedef intptr_t libesedb_column_t;
+typedef intptr_t libesedb_cursor_t;
 typedef intptr_t libesedb_index_t;
 typedef intptr_t libesedb_record_t;
 typedef intptr_t libesedb_long_value_t;
@@ -42,6 +42,10 @@
 #include <unistd.h>
 #endif
 
+#if defined( HAVE_SYS_MMAN_H ) && !defined( WINAPI )
+#include <sys/mman.h>
+#endif
+
 #if defined( HAVE_GLIB_H )
 #include <glib.h>
 #include <glib/gstdio.h>
@@ -208,6 +212,64 @@ int libbfio_file_initialize(
 
 		goto on_error;
 	}
+	if( libbfio_handle_set_get_data_reference_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size_t, uint8_t **, liberror_error_t **)) libbfio_file_get_data_reference,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set get data reference function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	if( libbfio_handle_set_read_at_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, liberror_error_t **)) libbfio_file_read_at,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+	if( libbfio_handle_set_prefetch_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size64_t, liberror_error_t **)) libbfio_file_prefetch,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefetch function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -354,6 +416,8 @@ int libbfio_file_io_handle_clone(
 
 		( *destination_file_io_handle )->name_size = source_file_io_handle->name_size;
 	}
+	( *destination_file_io_handle )->use_memory_map = source_file_io_handle->use_memory_map;
+
 	return( 1 );
 
 on_error:
@@ -1776,6 +1840,62 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Sets the value to indicate the file should be memory mapped
+ * The file is only memory mapped when opened for reading only
+ * 0 disables memory mapping any other value enables it
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_file_set_use_memory_map(
+     libbfio_handle_t *handle,
+     uint8_t use_memory_map,
+     liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_file_io_handle_t *file_io_handle   = NULL;
+	static char *function                      = "libbfio_file_set_use_memory_map";
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle = (libbfio_file_io_handle_t *) internal_handle->io_handle;
+
+	if( file_io_handle->mapped_data != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - mapped data already set.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle->use_memory_map = use_memory_map;
+
+	return( 1 );
+}
+
 /* Opens the file handle
  * Returns 1 if successful or -1 on error
  */
@@ -2321,6 +2441,28 @@ int libbfio_file_open(
 #endif
 	file_io_handle->access_flags = access_flags;
 
+	if( ( file_io_handle->use_memory_map != 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		if( libbfio_file_map_data(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			libbfio_file_close(
+			 file_io_handle,
+			 NULL );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -2386,6 +2528,23 @@ int libbfio_file_close(
 		return( -1 );
 	}
 #endif
+	if( file_io_handle->mapped_data != NULL )
+	{
+		if( libbfio_file_unmap_data(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+	}
 #if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
 	if( CloseHandle(
 	     file_io_handle->file_handle ) == 0 )
@@ -2463,6 +2622,197 @@ int libbfio_file_close(
 	return( 0 );
 }
 
+/* Maps the file data into memory
+ * If the file cannot be mapped, e.g. because the system does not support it,
+ * the file data is read using the read function
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_map_data(
+     libbfio_file_io_handle_t *file_io_handle,
+     liberror_error_t **error )
+{
+	static char *function = "libbfio_file_map_data";
+
+#if defined( HAVE_MMAP ) && !defined( WINAPI )
+	void *mapped_data     = NULL;
+	size64_t file_size    = 0;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->mapped_data != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - mapped data already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MMAP ) && !defined( WINAPI )
+	if( libbfio_file_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Empty files and files that do not fit in the address space are not mapped
+	 */
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		return( 1 );
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_io_handle->file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		return( 1 );
+	}
+	file_io_handle->mapped_data      = (uint8_t *) mapped_data;
+	file_io_handle->mapped_data_size = file_size;
+#endif
+	return( 1 );
+}
+
+/* Unmaps the file data from memory
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_unmap_data(
+     libbfio_file_io_handle_t *file_io_handle,
+     liberror_error_t **error )
+{
+#if defined( HAVE_MUNMAP ) && !defined( WINAPI )
+	libcstring_system_character_t error_string[ LIBBFIO_ERROR_STRING_SIZE ];
+#endif
+
+	static char *function = "libbfio_file_unmap_data";
+
+	if( file_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->mapped_data == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MUNMAP ) && !defined( WINAPI )
+	if( munmap(
+	     (void *) file_io_handle->mapped_data,
+	     (size_t) file_io_handle->mapped_data_size ) != 0 )
+	{
+		if( libbfio_error_string_copy_from_error_number(
+		     error_string,
+		     LIBBFIO_ERROR_STRING_SIZE,
+		     errno,
+		     error ) == 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file: %" PRIs_LIBCSTRING_SYSTEM " with error: %" PRIs_LIBCSTRING_SYSTEM "",
+			 function,
+			 file_io_handle->name,
+			 error_string );
+		}
+		else
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+		}
+		return( -1 );
+	}
+#endif
+	file_io_handle->mapped_data      = NULL;
+	file_io_handle->mapped_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a reference to the memory mapped data at a specific offset
+ * Returns 1 if successful, 0 if the data is not memory mapped or -1 on error
+ */
+int libbfio_file_get_data_reference(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size_t size,
+     uint8_t **data,
+     liberror_error_t **error )
+{
+	static char *function = "libbfio_file_get_data_reference";
+
+	if( file_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_handle->mapped_data == NULL )
+	 || ( offset < 0 )
+	 || ( (size64_t) offset > file_io_handle->mapped_data_size )
+	 || ( (size64_t) size > ( file_io_handle->mapped_data_size - (size64_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( file_io_handle->mapped_data[ offset ] );
+
+	return( 1 );
+}
+
 /* Reads a buffer from the file handle
  * Returns the number of bytes read if successful, or -1 on error
  */
@@ -2654,6 +3004,221 @@ ssize_t libbfio_file_read(
 	return( read_count );
 }
 
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+
+/* Reads a buffer at a specific offset from the file handle
+ * The current offset of the file handle is not changed
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_file_read_at(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error )
+{
+	libcstring_system_character_t error_string[ LIBBFIO_ERROR_STRING_SIZE ];
+
+	static char *function = "libbfio_file_read_at";
+	ssize_t read_count    = 0;
+
+	if( file_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* If the file is memory mapped copy the data from the mapped data
+	 */
+	if( file_io_handle->mapped_data != NULL )
+	{
+		if( (size64_t) offset >= file_io_handle->mapped_data_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) size > ( file_io_handle->mapped_data_size - (size64_t) offset ) )
+		{
+			size = (size_t) ( file_io_handle->mapped_data_size - (size64_t) offset );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( file_io_handle->mapped_data[ offset ] ),
+		     size ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) size );
+	}
+	read_count = pread(
+	              file_io_handle->file_descriptor,
+	              (void *) buffer,
+	              size,
+	              (off_t) offset );
+
+	if( read_count < 0 )
+	{
+		if( libbfio_error_string_copy_from_error_number(
+		     error_string,
+		     LIBBFIO_ERROR_STRING_SIZE,
+		     errno,
+		     error ) == 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file: %" PRIs_LIBCSTRING_SYSTEM " at offset: %" PRIi64 " with error: %" PRIs_LIBCSTRING_SYSTEM "",
+			 function,
+			 file_io_handle->name,
+			 offset,
+			 error_string );
+		}
+		else
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file: %" PRIs_LIBCSTRING_SYSTEM " at offset: %" PRIi64 ".",
+			 function,
+			 file_io_handle->name,
+			 offset );
+		}
+		return( -1 );
+	}
+	return( read_count );
+}
+
+#endif /* defined( HAVE_PREAD ) && !defined( WINAPI ) */
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+
+/* Hints the system that a specific range of the file will be read
+ * Returns 1 if successful, 0 if the hint was not accepted or -1 on error
+ */
+int libbfio_file_prefetch(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     liberror_error_t **error )
+{
+	static char *function = "libbfio_file_prefetch";
+
+	if( file_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hint is advisory, if it fails the data is read when needed
+	 */
+	if( posix_fadvise(
+	     file_io_handle->file_descriptor,
+	     (off_t) offset,
+	     (off_t) size,
+	     POSIX_FADV_WILLNEED ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
 /* Writes a buffer to the file handle
  * Returns the number of bytes written if successful, or -1 on error
  */
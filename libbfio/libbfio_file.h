@@ -60,6 +60,18 @@ struct libbfio_file_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* Value to indicate the file should be memory mapped when opened for reading
+	 */
+	uint8_t use_memory_map;
+
+	/* The memory mapped data
+	 */
+	uint8_t *mapped_data;
+
+	/* The memory mapped data size
+	 */
+	size64_t mapped_data_size;
 };
 
 int libbfio_file_io_handle_initialize(
@@ -157,6 +169,12 @@ int libbfio_file_io_handle_set_name_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBBFIO_EXTERN \
+int libbfio_file_set_use_memory_map(
+     libbfio_handle_t *handle,
+     uint8_t use_memory_map,
+     liberror_error_t **error );
+
 int libbfio_file_open(
      libbfio_file_io_handle_t *file_io_handle,
      int access_flags,
@@ -166,12 +184,48 @@ int libbfio_file_close(
      libbfio_file_io_handle_t *file_io_handle,
      liberror_error_t **error );
 
+int libbfio_file_map_data(
+     libbfio_file_io_handle_t *file_io_handle,
+     liberror_error_t **error );
+
+int libbfio_file_unmap_data(
+     libbfio_file_io_handle_t *file_io_handle,
+     liberror_error_t **error );
+
+int libbfio_file_get_data_reference(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size_t size,
+     uint8_t **data,
+     liberror_error_t **error );
+
 ssize_t libbfio_file_read(
          libbfio_file_io_handle_t *file_io_handle,
          uint8_t *buffer,
          size_t size,
          liberror_error_t **error );
 
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+
+ssize_t libbfio_file_read_at(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error );
+
+#endif /* defined( HAVE_PREAD ) && !defined( WINAPI ) */
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+
+int libbfio_file_prefetch(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     liberror_error_t **error );
+
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
 ssize_t libbfio_file_write(
          libbfio_file_io_handle_t *file_io_handle,
          const uint8_t *buffer,
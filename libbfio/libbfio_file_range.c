@@ -186,6 +186,46 @@ int libbfio_file_range_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	if( libbfio_handle_set_read_at_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, liberror_error_t **)) libbfio_file_range_read_at,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+	if( libbfio_handle_set_prefetch_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size64_t, liberror_error_t **)) libbfio_file_range_prefetch,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefetch function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -1034,6 +1074,149 @@ ssize_t libbfio_file_range_read(
 	return( read_count );
 }
 
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+
+/* Reads a buffer at a specific offset from the file range handle
+ * The offset is relative to the start of the range
+ * The current offset of the file range handle is not changed
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_file_range_read_at(
+         libbfio_file_range_io_handle_t *file_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error )
+{
+	static char *function = "libbfio_file_range_read_at";
+	ssize_t read_count    = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->range_size != 0 )
+	{
+		if( (size64_t) offset >= file_range_io_handle->range_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) size > ( file_range_io_handle->range_size - (size64_t) offset ) )
+		{
+			size = (size_t) ( file_range_io_handle->range_size - (size64_t) offset );
+		}
+	}
+	read_count = libbfio_file_read_at(
+	              file_range_io_handle->file_io_handle,
+	              buffer,
+	              size,
+	              file_range_io_handle->range_offset + offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+#endif /* defined( HAVE_PREAD ) && !defined( WINAPI ) */
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+
+/* Hints the system that a specific range of the file range will be read
+ * The offset is relative to the start of the range
+ * Returns 1 if successful, 0 if the hint was not accepted or -1 on error
+ */
+int libbfio_file_range_prefetch(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     size64_t size,
+     liberror_error_t **error )
+{
+	static char *function = "libbfio_file_range_prefetch";
+	int result            = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->range_size != 0 )
+	{
+		if( (size64_t) offset >= file_range_io_handle->range_size )
+		{
+			return( 0 );
+		}
+		if( size > ( file_range_io_handle->range_size - (size64_t) offset ) )
+		{
+			size = file_range_io_handle->range_size - (size64_t) offset;
+		}
+	}
+	result = libbfio_file_prefetch(
+	          file_range_io_handle->file_io_handle,
+	          file_range_io_handle->range_offset + offset,
+	          size,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to prefetch from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
 /* Writes a buffer to the file range handle
  * Returns the number of bytes written if successful, or -1 on error
  */
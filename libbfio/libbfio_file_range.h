@@ -143,6 +143,27 @@ ssize_t libbfio_file_range_read(
          size_t size,
          liberror_error_t **error );
 
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+
+ssize_t libbfio_file_range_read_at(
+         libbfio_file_range_io_handle_t *file_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error );
+
+#endif /* defined( HAVE_PREAD ) && !defined( WINAPI ) */
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+
+int libbfio_file_range_prefetch(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     size64_t size,
+     liberror_error_t **error );
+
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
 ssize_t libbfio_file_range_write(
          libbfio_file_range_io_handle_t *file_range_io_handle,
          const uint8_t *buffer,
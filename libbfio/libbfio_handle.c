@@ -170,6 +170,112 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the get data reference function
+ * The function is used to retrieve data from IO handles that are backed by memory
+ * without copying it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_get_data_reference_function(
+     libbfio_handle_t *handle,
+     int (*get_data_reference)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size_t size,
+            uint8_t **data,
+            liberror_error_t **error ),
+     liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_get_data_reference_function";
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	internal_handle->get_data_reference = get_data_reference;
+
+	return( 1 );
+}
+
+/* Sets the read at offset function
+ * The function is used to read data at a specific offset
+ * without changing the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_read_at_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_at)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                liberror_error_t **error ),
+     liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_read_at_function";
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	internal_handle->read_at = read_at;
+
+	return( 1 );
+}
+
+/* Sets the prefetch function
+ * The function is used to hint the system to read data ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_prefetch_function(
+     libbfio_handle_t *handle,
+     int (*prefetch)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size64_t size,
+            liberror_error_t **error ),
+     liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_prefetch_function";
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	internal_handle->prefetch = prefetch;
+
+	return( 1 );
+}
+
 /* Frees the handle
  * Returns 1 if successful or -1 on error
  */
@@ -384,6 +490,49 @@ int libbfio_handle_clone(
 	}
 	destination_io_handle = NULL;
 
+	if( libbfio_handle_set_get_data_reference_function(
+	     *destination_handle,
+	     internal_source_handle->get_data_reference,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set get data reference function in destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_set_read_at_function(
+	     *destination_handle,
+	     internal_source_handle->read_at,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function in destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_set_prefetch_function(
+	     *destination_handle,
+	     internal_source_handle->prefetch,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefetch function in destination handle.",
+		 function );
+
+		goto on_error;
+	}
+
 	if( libbfio_handle_open(
 	     *destination_handle,
 	     internal_source_handle->access_flags,
@@ -981,6 +1130,346 @@ ssize_t libbfio_handle_read(
 	return( read_count );
 }
 
+/* Reads a buffer at a specific offset from the handle
+ * The current offset of the handle is not changed if the IO handle
+ * provides a read at offset function, otherwise the read is emulated
+ * by a seek and a read and the current offset is set to the end of the read
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_at(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_read_at";
+	ssize_t read_count                         = 0;
+	int is_open                                = 0;
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_at == NULL )
+	{
+		if( libbfio_handle_seek_offset(
+		     handle,
+		     offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in handle.",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		read_count = libbfio_handle_read(
+		              handle,
+		              buffer,
+		              size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from handle at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( internal_handle->is_open == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing is open function.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->open == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing open function.",
+			 function );
+
+			return( -1 );
+		}
+		is_open = internal_handle->is_open(
+			   internal_handle->io_handle,
+		           error );
+
+		if( is_open == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if handle is open.",
+			 function );
+
+			return( -1 );
+		}
+		else if( is_open == 0 )
+		{
+			if( internal_handle->open(
+			     internal_handle->io_handle,
+			     internal_handle->access_flags,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_IO,
+				 LIBERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open handle on demand.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	read_count = internal_handle->read_at(
+	              internal_handle->io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from handle at offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	if( internal_handle->track_offsets_read != 0 )
+	{
+		if( libbfio_offset_list_append_offset(
+		     internal_handle->offsets_read,
+		     offset,
+		     read_count,
+		     1,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append offset range to offsets read table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( internal_handle->close == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing close function.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->close(
+		     internal_handle->io_handle,
+		     error ) != 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to close handle on demand.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
+/* Determines if the handle supports concurrent reads at a specific offset
+ * Concurrent reads require a read at offset function that does not change
+ * the state of the handle, i.e. the handle is not opened on demand
+ * and the offsets read are not tracked
+ * Returns 1 if supported, 0 if not or -1 on error
+ */
+int libbfio_handle_supports_concurrent_reads(
+     libbfio_handle_t *handle,
+     liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_supports_concurrent_reads";
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( internal_handle->read_at == NULL )
+	 || ( internal_handle->open_on_demand != 0 )
+	 || ( internal_handle->track_offsets_read != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Hints the system that a specific range of data will be read
+ * The data is read ahead asynchronously, the current offset of the handle is not changed
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libbfio_handle_prefetch(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_prefetch";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Open on demand handles are closed after every read
+	 * which discards the hint
+	 */
+	if( ( internal_handle->prefetch == NULL )
+	 || ( internal_handle->open_on_demand != 0 ) )
+	{
+		return( 0 );
+	}
+	result = internal_handle->prefetch(
+	          internal_handle->io_handle,
+	          offset,
+	          size,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to prefetch data at offset: %" PRIi64 " from handle.",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Writes a buffer to the handle
  * Returns the number of bytes written if successful, or -1 on error
  */
@@ -1223,6 +1712,130 @@ off64_t libbfio_handle_seek_offset(
 	return( offset );
 }
 
+/* Retrieves a reference to the data at a specific offset within the handle
+ * The data is not copied and remains owned by the handle, it is valid until the handle is closed
+ * The current offset of the handle is not changed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libbfio_handle_get_data_reference(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     uint8_t **data,
+     liberror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_data_reference";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Open on demand handles do not keep the data available
+	 */
+	if( ( internal_handle->get_data_reference == NULL )
+	 || ( internal_handle->open_on_demand != 0 ) )
+	{
+		return( 0 );
+	}
+	result = internal_handle->get_data_reference(
+	          internal_handle->io_handle,
+	          offset,
+	          size,
+	          data,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve data reference at offset: %" PRIi64 " from handle.",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( internal_handle->track_offsets_read != 0 )
+		{
+			if( libbfio_offset_list_append_offset(
+			     internal_handle->offsets_read,
+			     offset,
+			     (size64_t) size,
+			     1,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append offset range to offsets read table.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( result );
+}
+
 /* Function to determine if a file object exists
  * Returns 1 if file object exists, 0 if not or -1 on error
  */
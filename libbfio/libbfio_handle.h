@@ -154,6 +154,37 @@ struct libbfio_internal_handle
 	       size64_t *size,
 	       liberror_error_t **error );
 
+	/* The get data reference function
+	 * This function is optional and only set for IO handles
+	 * that are backed by memory
+	 */
+	int (*get_data_reference)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       size_t size,
+	       uint8_t **data,
+	       liberror_error_t **error );
+
+	/* The read at offset function
+	 * This function is optional and only set for IO handles
+	 * that can read without changing their current offset
+	 */
+	ssize_t (*read_at)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           off64_t offset,
+	           liberror_error_t **error );
+
+	/* The prefetch function
+	 * This function is optional and only set for IO handles
+	 * that can hint the system to read data ahead
+	 */
+	int (*prefetch)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       size64_t size,
+	       liberror_error_t **error );
 };
 
 LIBBFIO_EXTERN \
@@ -202,6 +233,35 @@ int libbfio_handle_initialize(
      uint8_t flags,
      liberror_error_t **error );
 
+int libbfio_handle_set_get_data_reference_function(
+     libbfio_handle_t *handle,
+     int (*get_data_reference)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size_t size,
+            uint8_t **data,
+            liberror_error_t **error ),
+     liberror_error_t **error );
+
+int libbfio_handle_set_read_at_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_at)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                liberror_error_t **error ),
+     liberror_error_t **error );
+
+int libbfio_handle_set_prefetch_function(
+     libbfio_handle_t *handle,
+     int (*prefetch)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size64_t size,
+            liberror_error_t **error ),
+     liberror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_free(
      libbfio_handle_t **handle,
@@ -237,6 +297,26 @@ ssize_t libbfio_handle_read(
          size_t size,
          liberror_error_t **error );
 
+LIBBFIO_EXTERN \
+ssize_t libbfio_handle_read_at(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_supports_concurrent_reads(
+     libbfio_handle_t *handle,
+     liberror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_prefetch(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     liberror_error_t **error );
+
 LIBBFIO_EXTERN \
 ssize_t libbfio_handle_write(
          libbfio_handle_t *handle,
@@ -251,6 +331,14 @@ off64_t libbfio_handle_seek_offset(
          int whence,
          liberror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_handle_get_data_reference(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     uint8_t **data,
+     liberror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_exists(
      libbfio_handle_t *handle,
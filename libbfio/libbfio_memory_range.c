@@ -172,6 +172,42 @@ int libbfio_memory_range_initialize(
 
 		goto on_error;
 	}
+	if( libbfio_handle_set_get_data_reference_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size_t, uint8_t **, liberror_error_t **)) libbfio_memory_range_get_data_reference,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set get data reference function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_read_at_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, liberror_error_t **)) libbfio_memory_range_read_at,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
@@ -653,6 +689,130 @@ ssize_t libbfio_memory_range_read(
 	return( (ssize_t) read_size );
 }
 
+/* Reads a buffer at a specific offset from the memory range handle
+ * The current offset of the memory range handle is not changed
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_memory_range_read_at(
+         libbfio_memory_range_io_handle_t *memory_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error )
+{
+	static char *function = "libbfio_memory_range_read_at";
+	size_t read_size      = 0;
+
+	if( memory_range_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->range_start == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - invalid range start.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->is_open == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the end of the data was reached
+	 */
+	if( (size64_t) offset >= (size64_t) memory_range_io_handle->range_size )
+	{
+		return( 0 );
+	}
+	/* Check the amount of data available
+	 */
+	read_size = memory_range_io_handle->range_size - (size_t) offset;
+
+	/* Cannot read more data than available
+	 */
+	if( read_size > size )
+	{
+		read_size = size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( memory_range_io_handle->range_start[ offset ] ),
+	     read_size ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to read buffer from memory range.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
+}
+
 /* Writes a buffer to the memory range handle
  * Returns the number of bytes written if successful, or -1 on error
  */
@@ -771,6 +931,57 @@ ssize_t libbfio_memory_range_write(
 	return( (ssize_t) write_size );
 }
 
+/* Retrieves a reference to the data at a specific offset within the memory range handle
+ * Returns 1 if successful, 0 if the data is not available or -1 on error
+ */
+int libbfio_memory_range_get_data_reference(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     size_t size,
+     uint8_t **data,
+     liberror_error_t **error )
+{
+	static char *function = "libbfio_memory_range_get_data_reference";
+
+	if( memory_range_io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_range_io_handle->range_start == NULL )
+	 || ( memory_range_io_handle->is_open == 0 )
+	 || ( ( memory_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > (size64_t) memory_range_io_handle->range_size )
+	 || ( size > ( memory_range_io_handle->range_size - (size_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( memory_range_io_handle->range_start[ offset ] );
+
+	return( 1 );
+}
+
 /* Seeks a certain offset within the memory range handle
  * Returns the offset if the seek is successful or -1 on error
  */
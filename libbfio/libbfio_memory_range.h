@@ -106,12 +106,26 @@ ssize_t libbfio_memory_range_read(
          size_t size,
          liberror_error_t **error );
 
+ssize_t libbfio_memory_range_read_at(
+         libbfio_memory_range_io_handle_t *memory_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         liberror_error_t **error );
+
 ssize_t libbfio_memory_range_write(
          libbfio_memory_range_io_handle_t *memory_range_io_handle,
          const uint8_t *buffer,
          size_t size,
          liberror_error_t **error );
 
+int libbfio_memory_range_get_data_reference(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     size_t size,
+     uint8_t **data,
+     liberror_error_t **error );
+
 off64_t libbfio_memory_range_seek_offset(
          libbfio_memory_range_io_handle_t *memory_range_io_handle,
          off64_t offset,
@@ -0,0 +1,119 @@
+/*
+ * The catalog cache file definition
+ * The catalog cache file is not part of the ESE format it is written by libesedb
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_CATALOG_CACHE_H )
+#define _ESEDB_CATALOG_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct esedb_catalog_cache_header esedb_catalog_cache_header_t;
+
+struct esedb_catalog_cache_header
+{
+	/* The checksum
+	 * A XOR-32 checksum calculated over the bytes
+	 * from offset 4 to the end of the header
+	 * with an initial value of 0x89abcdef
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "ESEDBCAT"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The database time of the database file header
+	 * Consists of 8 bytes
+	 */
+	uint8_t database_time[ 8 ];
+
+	/* The database signature of the database file header
+	 * Consists of 28 bytes
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* The database state of the database file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t database_state[ 4 ];
+
+	/* The page size of the database file
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The last page number of the database file
+	 * Consists of 4 bytes
+	 */
+	uint8_t last_page_number[ 4 ];
+
+	/* The number of catalog definitions
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_definitions[ 4 ];
+
+	/* The size of the catalog definitions data
+	 * The catalog definitions data directly follows the header
+	 * Consists of 4 bytes
+	 */
+	uint8_t definitions_data_size[ 4 ];
+
+	/* The catalog definitions data checksum
+	 * A XOR-32 checksum calculated over the catalog definitions data
+	 * with an initial value of 0x89abcdef
+	 * Consists of 4 bytes
+	 */
+	uint8_t definitions_data_checksum[ 4 ];
+};
+
+/* The catalog definitions data consists of a catalog definition entry per catalog definition
+ * in the order of the catalog values tree
+ */
+typedef struct esedb_catalog_cache_definition esedb_catalog_cache_definition_t;
+
+struct esedb_catalog_cache_definition
+{
+	/* The size of the catalog definition data
+	 * The catalog definition data directly follows the size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -28,12 +28,17 @@
 
 #include "libesedb_definitions.h"
 #include "libesedb_catalog.h"
+#include "libesedb_catalog_cache.h"
 #include "libesedb_catalog_definition.h"
+#include "libesedb_hash_table.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libuna.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
+#include "libesedb_values_tree_value.h"
 
 /* Initialize a catalog
  * Make sure the value catalog is pointing to is set to NULL
@@ -108,11 +113,52 @@ int libesedb_catalog_initialize(
 
 		goto on_error;
 	}
+	if( libesedb_hash_table_initialize(
+	     &( ( *catalog )->table_definition_hash_table ),
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition hash table.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_init(
+	     &( ( *catalog )->read_on_demand_lock ),
+	     NULL ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read on demand lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *catalog != NULL )
 	{
+		if( ( *catalog )->table_definition_hash_table != NULL )
+		{
+			libesedb_hash_table_free(
+			 &( ( *catalog )->table_definition_hash_table ),
+			 NULL );
+		}
+		if( ( *catalog )->table_definition_list != NULL )
+		{
+			libesedb_list_free(
+			 &( ( *catalog )->table_definition_list ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *catalog );
 
@@ -158,6 +204,65 @@ int libesedb_catalog_free(
 
 			result = -1;
 		}
+		if( libesedb_hash_table_free(
+		     &( ( *catalog )->table_definition_hash_table ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table definition hash table.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *catalog )->values_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( ( *catalog )->values_cache ),
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog values cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *catalog )->values_tree != NULL )
+		{
+			if( libfdata_tree_free(
+			     &( ( *catalog )->values_tree ),
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog values tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_PTHREAD )
+		if( pthread_mutex_destroy(
+		     &( ( *catalog )->read_on_demand_lock ) ) != 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy read on demand lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *catalog );
 
@@ -166,6 +271,74 @@ int libesedb_catalog_free(
 	return( result );
 }
 
+/* Empties the table definitions of the catalog
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_empty_table_definitions(
+     libesedb_catalog_t *catalog,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_catalog_empty_table_definitions";
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_list_empty(
+	     catalog->table_definition_list,
+	     (int (*)(intptr_t **, liberror_error_t **)) &libesedb_table_definition_free,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty table definition list.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table does not manage the table definitions
+	 * it is replaced by a new empty hash table
+	 */
+	if( libesedb_hash_table_free(
+	     &( catalog->table_definition_hash_table ),
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table definition hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_hash_table_initialize(
+	     &( catalog->table_definition_hash_table ),
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition hash table.",
+		 function );
+
+		return( -1 );
+	}
+	catalog->table_definitions_read = 0;
+
+	return( 1 );
+}
+
 /* Retrieves the number of table definitions
  * Returns 1 if successful or -1 on error
  */
@@ -187,6 +360,20 @@ int libesedb_catalog_get_number_of_table_definitions(
 
 		return( -1 );
 	}
+	if( libesedb_catalog_read_on_demand(
+	     catalog,
+	     NULL,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definitions.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_list_get_number_of_elements(
 	     catalog->table_definition_list,
 	     number_of_table_definitions,
@@ -226,6 +413,20 @@ int libesedb_catalog_get_table_definition_by_index(
 
 		return( -1 );
 	}
+	if( libesedb_catalog_read_on_demand(
+	     catalog,
+	     NULL,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definitions.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_list_get_value_by_index(
 	     catalog->table_definition_list,
 	     table_definition_index,
@@ -242,6 +443,20 @@ int libesedb_catalog_get_table_definition_by_index(
 
 		return( -1 );
 	}
+	if( libesedb_catalog_read_on_demand(
+	     catalog,
+	     *table_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definition values.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -255,9 +470,10 @@ int libesedb_catalog_get_table_definition_by_name(
      libesedb_table_definition_t **table_definition,
      liberror_error_t **error )
 {
-	libesedb_list_element_t *list_element = NULL;
-	static char *function                 = "libesedb_catalog_get_table_definition_by_name";
-	int list_element_iterator             = 0;
+	static char *function = "libesedb_catalog_get_table_definition_by_name";
+	uint32_t hash         = 0;
+	int probe_index       = 0;
+	int result            = 0;
 
 	if( catalog == NULL )
 	{
@@ -270,13 +486,13 @@ int libesedb_catalog_get_table_definition_by_name(
 
 		return( -1 );
 	}
-	if( catalog->table_definition_list == NULL )
+	if( catalog->table_definition_hash_table == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid catalog - missing table definition list.",
+		 "%s: invalid catalog - missing table definition hash table.",
 		 function );
 
 		return( -1 );
@@ -314,47 +530,68 @@ int libesedb_catalog_get_table_definition_by_name(
 
 		return( -1 );
 	}
-	list_element = catalog->table_definition_list->first_element;
+	if( libesedb_catalog_read_on_demand(
+	     catalog,
+	     NULL,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_hash_table_calculate_hash_from_byte_stream(
+	     &hash,
+	     table_name,
+	     table_name_size,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of table name.",
+		 function );
 
-	for( list_element_iterator = 0;
-	     list_element_iterator < catalog->table_definition_list->number_of_elements;
-	     list_element_iterator++ )
+		return( -1 );
+	}
+	do
 	{
-		if( list_element == NULL )
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          catalog->table_definition_hash_table,
+		          hash,
+		          &probe_index,
+		          (intptr_t **) table_definition,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected for element: %d.",
-			 function,
-			 list_element_iterator );
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition from hash table.",
+			 function );
 
 			return( -1 );
 		}
-		if( list_element->value == NULL )
+		else if( result == 0 )
 		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid list element: %d - missing value.",
-			 function,
-			 list_element_iterator );
-
-			return( -1 );
+			break;
 		}
-		*table_definition = (libesedb_table_definition_t *) list_element->value;
-
 		if( ( *table_definition )->table_catalog_definition == NULL )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition: %d - missing table catalog definition.",
-			 function,
-			 list_element_iterator );
+			 "%s: invalid table definition - missing table catalog definition.",
+			 function );
 
 			return( -1 );
 		}
@@ -364,9 +601,8 @@ int libesedb_catalog_get_table_definition_by_name(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table catalog definition: %d - missing name.",
-			 function,
-			 list_element_iterator );
+			 "%s: invalid table catalog definition - missing name.",
+			 function );
 
 			return( -1 );
 		}
@@ -377,11 +613,26 @@ int libesedb_catalog_get_table_definition_by_name(
 			     table_name,
 			     table_name_size ) == 0 )
 			{
+				if( libesedb_catalog_read_on_demand(
+				     catalog,
+				     *table_definition,
+				     error ) != 1 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_IO,
+					 LIBERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read table definition values.",
+					 function );
+
+					return( -1 );
+				}
 				return( 1 );
 			}
 		}
-		list_element = list_element->next_element;
 	}
+	while( result != 0 );
+
 	*table_definition = NULL;
 
 	return( 0 );
@@ -397,10 +648,10 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
      libesedb_table_definition_t **table_definition,
      liberror_error_t **error )
 {
-	libesedb_list_element_t *list_element = NULL;
-	static char *function                 = "libesedb_catalog_get_table_definition_by_utf8_name";
-	int list_element_iterator             = 0;
-	int result                            = 0;
+	static char *function = "libesedb_catalog_get_table_definition_by_utf8_name";
+	uint32_t hash         = 0;
+	int probe_index       = 0;
+	int result            = 0;
 
 	if( catalog == NULL )
 	{
@@ -413,13 +664,13 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 
 		return( -1 );
 	}
-	if( catalog->table_definition_list == NULL )
+	if( catalog->table_definition_hash_table == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid catalog - missing table definition list.",
+		 "%s: invalid catalog - missing table definition hash table.",
 		 function );
 
 		return( -1 );
@@ -457,47 +708,67 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 
 		return( -1 );
 	}
-	list_element = catalog->table_definition_list->first_element;
+	if( libesedb_catalog_read_on_demand(
+	     catalog,
+	     NULL,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_hash_table_calculate_hash_from_utf8_string(
+	     &hash,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of UTF-8 string.",
+		 function );
 
-	for( list_element_iterator = 0;
-	     list_element_iterator < catalog->table_definition_list->number_of_elements;
-	     list_element_iterator++ )
+		return( -1 );
+	}
+	do
 	{
-		if( list_element == NULL )
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          catalog->table_definition_hash_table,
+		          hash,
+		          &probe_index,
+		          (intptr_t **) table_definition,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected for element: %d.",
-			 function,
-			 list_element_iterator );
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition from hash table.",
+			 function );
 
 			return( -1 );
 		}
-		if( list_element->value == NULL )
+		else if( result == 0 )
 		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid list element: %d - missing value.",
-			 function,
-			 list_element_iterator );
-
-			return( -1 );
+			break;
 		}
-		*table_definition = (libesedb_table_definition_t *) list_element->value;
-
 		if( ( *table_definition )->table_catalog_definition == NULL )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition: %d - missing table catalog definition.",
-			 function,
-			 list_element_iterator );
+			 "%s: invalid table definition - missing table catalog definition.",
+			 function );
 
 			return( -1 );
 		}
@@ -507,9 +778,8 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table catalog definition: %d - missing name.",
-			 function,
-			 list_element_iterator );
+			 "%s: invalid table catalog definition - missing name.",
+			 function );
 
 			return( -1 );
 		}
@@ -527,18 +797,35 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare UTF-8 string with table catalog definition: %d name.",
-			 function,
-			 list_element_iterator );
+			 "%s: unable to compare UTF-8 string with table catalog definition name.",
+			 function );
 
 			return( -1 );
 		}
 		else if( result != 0 )
 		{
+			if( libesedb_catalog_read_on_demand(
+			     catalog,
+			     *table_definition,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_IO,
+				 LIBERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read table definition values.",
+				 function );
+
+				return( -1 );
+			}
 			return( 1 );
 		}
-		list_element = list_element->next_element;
+		/* Continue with the next value with the same hash
+		 */
+		result = 1;
 	}
+	while( result != 0 );
+
 	*table_definition = NULL;
 
 	return( 0 );
@@ -554,10 +841,10 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
      libesedb_table_definition_t **table_definition,
      liberror_error_t **error )
 {
-	libesedb_list_element_t *list_element = NULL;
-	static char *function                 = "libesedb_catalog_get_table_definition_by_utf16_name";
-	int list_element_iterator             = 0;
-	int result                            = 0;
+	static char *function = "libesedb_catalog_get_table_definition_by_utf16_name";
+	uint32_t hash         = 0;
+	int probe_index       = 0;
+	int result            = 0;
 
 	if( catalog == NULL )
 	{
@@ -570,13 +857,13 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 
 		return( -1 );
 	}
-	if( catalog->table_definition_list == NULL )
+	if( catalog->table_definition_hash_table == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid catalog - missing table definition list.",
+		 "%s: invalid catalog - missing table definition hash table.",
 		 function );
 
 		return( -1 );
@@ -614,47 +901,67 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 
 		return( -1 );
 	}
-	list_element = catalog->table_definition_list->first_element;
+	if( libesedb_catalog_read_on_demand(
+	     catalog,
+	     NULL,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_hash_table_calculate_hash_from_utf16_string(
+	     &hash,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of UTF-16 string.",
+		 function );
 
-	for( list_element_iterator = 0;
-	     list_element_iterator < catalog->table_definition_list->number_of_elements;
-	     list_element_iterator++ )
+		return( -1 );
+	}
+	do
 	{
-		if( list_element == NULL )
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          catalog->table_definition_hash_table,
+		          hash,
+		          &probe_index,
+		          (intptr_t **) table_definition,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected for element: %d.",
-			 function,
-			 list_element_iterator );
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition from hash table.",
+			 function );
 
 			return( -1 );
 		}
-		if( list_element->value == NULL )
+		else if( result == 0 )
 		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid list element: %d - missing value.",
-			 function,
-			 list_element_iterator );
-
-			return( -1 );
+			break;
 		}
-		*table_definition = (libesedb_table_definition_t *) list_element->value;
-
 		if( ( *table_definition )->table_catalog_definition == NULL )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition: %d - missing table catalog definition.",
-			 function,
-			 list_element_iterator );
+			 "%s: invalid table definition - missing table catalog definition.",
+			 function );
 
 			return( -1 );
 		}
@@ -664,9 +971,8 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table catalog definition: %d - missing name.",
-			 function,
-			 list_element_iterator );
+			 "%s: invalid table catalog definition - missing name.",
+			 function );
 
 			return( -1 );
 		}
@@ -684,47 +990,61 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare UTF-16 string with table catalog definition: %d name.",
-			 function,
-			 list_element_iterator );
+			 "%s: unable to compare UTF-16 string with table catalog definition name.",
+			 function );
 
 			return( -1 );
 		}
 		else if( result != 0 )
 		{
+			if( libesedb_catalog_read_on_demand(
+			     catalog,
+			     *table_definition,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_IO,
+				 LIBERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read table definition values.",
+				 function );
+
+				return( -1 );
+			}
 			return( 1 );
 		}
-		list_element = list_element->next_element;
+		/* Continue with the next value with the same hash
+		 */
+		result = 1;
 	}
+	while( result != 0 );
+
 	*table_definition = NULL;
 
 	return( 0 );
 }
 
 /* Reads the catalog
+ * If read on demand is set only the catalog values tree is set up
+ * and the definitions are read when they are first accessed
+ * If a cache file IO handle is set the catalog is read from the catalog cache file
+ * when it matches the database file, otherwise the catalog is read from the database file
+ * and the catalog cache file is (re)written
  * Returns 1 if successful or -1 on error
  */
 int libesedb_catalog_read(
      libesedb_catalog_t *catalog,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
+     libbfio_handle_t *cache_file_io_handle,
+     uint8_t read_on_demand,
      liberror_error_t **error )
 {
-	libesedb_catalog_definition_t *catalog_definition = NULL;
-	libesedb_page_tree_t *catalog_page_tree           = NULL;
-	libesedb_table_definition_t *table_definition     = NULL;
-	libesedb_values_tree_value_t *values_tree_value   = NULL;
-	libfcache_cache_t *catalog_values_cache           = NULL;
-	libfdata_tree_t *catalog_values_tree              = NULL;
-	libfdata_tree_node_t *catalog_values_tree_node    = NULL;
-	uint8_t *catalog_definition_data                  = NULL;
-	static char *function                             = "libesedb_catalog_read";
-	off64_t node_data_offset                          = 0;
-	size_t catalog_definition_data_size               = 0;
-	int leaf_node_index                               = 0;
-	int number_of_leaf_nodes                          = 0;
+	libesedb_page_tree_t *catalog_page_tree = NULL;
+	static char *function                   = "libesedb_catalog_read";
+	off64_t node_data_offset                = 0;
+	int result                              = 0;
 
 	if( catalog == NULL )
 	{
@@ -737,6 +1057,17 @@ int libesedb_catalog_read(
 
 		return( -1 );
 	}
+	if( catalog->values_tree != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog - values tree already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( io_handle == NULL )
 	{
 		liberror_error_set(
@@ -748,10 +1079,36 @@ int libesedb_catalog_read(
 
 		return( -1 );
 	}
+	if( cache_file_io_handle != NULL )
+	{
+		result = libesedb_catalog_cache_read(
+		          catalog,
+		          cache_file_io_handle,
+		          io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog cache file.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+		/* The catalog cache file is written from all the definitions
+		 */
+		read_on_demand = 0;
+	}
 	if( libesedb_page_tree_initialize(
 	     &catalog_page_tree,
 	     io_handle,
-	     pages_vector,
 	     pages_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_CATALOG,
 	     NULL,
@@ -770,7 +1127,7 @@ int libesedb_catalog_read(
 	/* TODO add clone function
 	 */
 	if( libfdata_tree_initialize(
-	     &catalog_values_tree,
+	     &( catalog->values_tree ),
 	     (intptr_t *) catalog_page_tree,
 	     (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_tree_free,
 	     NULL,
@@ -791,7 +1148,7 @@ int libesedb_catalog_read(
 	catalog_page_tree = NULL;
 
 	if( libfcache_cache_initialize(
-	     &catalog_values_cache,
+	     &( catalog->values_cache ),
 	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES,
 	     error ) != 1 )
 	{
@@ -808,7 +1165,7 @@ int libesedb_catalog_read(
 	node_data_offset *= io_handle->page_size;
 
 	if( libfdata_tree_set_root_node(
-	     catalog_values_tree,
+	     catalog->values_tree,
 	     node_data_offset,
 	     0,
 	     error ) != 1 )
@@ -822,291 +1179,60 @@ int libesedb_catalog_read(
 
 		goto on_error;
 	}
-	if( libfdata_tree_get_number_of_leaf_nodes(
-	     catalog_values_tree,
-	     file_io_handle,
-	     catalog_values_cache,
-	     &number_of_leaf_nodes,
-	     0,
+	catalog->file_io_handle = file_io_handle;
+	catalog->io_handle      = io_handle;
+	catalog->pages_cache    = pages_cache;
+	catalog->read_on_demand = read_on_demand;
+
+	if( read_on_demand != 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_catalog_read_definitions(
+	     catalog,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of leaf nodes from catalog values tree.",
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog definitions.",
 		 function );
 
 		goto on_error;
 	}
-	for( leaf_node_index = 0;
-	     leaf_node_index < number_of_leaf_nodes;
-	     leaf_node_index++ )
+	if( cache_file_io_handle != NULL )
 	{
-		if( libfdata_tree_get_leaf_node_by_index(
-		     catalog_values_tree,
-		     file_io_handle,
-		     catalog_values_cache,
-		     leaf_node_index,
-		     &catalog_values_tree_node,
-		     0,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve leaf node: %d from catalog values tree.",
-			 function,
-			 leaf_node_index );
-
-			goto on_error;
-		}
-		if( libfdata_tree_node_get_node_value(
-		     catalog_values_tree_node,
-		     file_io_handle,
-		     catalog_values_cache,
-		     (intptr_t **) &values_tree_value,
-		     0,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve node value from values tree node.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_values_tree_value_read_data(
-		     values_tree_value,
-		     file_io_handle,
+		/* Failing to write the catalog cache file is not considered an error
+		 */
+		if( libesedb_catalog_cache_write(
+		     catalog,
+		     cache_file_io_handle,
 		     io_handle,
-		     pages_vector,
-		     pages_cache,
-		     &catalog_definition_data,
-		     &catalog_definition_data_size,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_IO,
-			 LIBERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read values tree value data.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_catalog_definition_initialize(
-		     &catalog_definition,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create catalog definition.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_catalog_definition_read(
-		     catalog_definition,
-		     catalog_definition_data,
-		     catalog_definition_data_size,
-		     io_handle->ascii_codepage,
 		     error ) != 1 )
 		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_IO,
-			 LIBERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog definition.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
-		 && ( table_definition == NULL ) )
-		{
-			/* TODO add build-in table 1 support
-			 */
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libnotify_verbose != 0 )
 			{
 				libnotify_printf(
-				 "%s: missing table definition for catalog definition type: %" PRIu16 ".\n",
-				 function,
-				 catalog_definition->type );
+				 "%s: unable to write catalog cache file.\n",
+				 function );
 			}
-#endif
-			if( libesedb_catalog_definition_free(
-			     &catalog_definition,
-			     error ) != 1 )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
 			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free catalog definition.",
-				 function );
-
-				goto on_error;
+				libnotify_print_error_backtrace(
+				 *error );
 			}
-			catalog_definition = NULL;
-		}
-		else switch( catalog_definition->type )
-		{
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE:
-				table_definition = NULL;
-
-				if( libesedb_table_definition_initialize(
-				     &table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create table definition.",
-					 function );
-
-					libesedb_table_definition_free(
-					 &table_definition,
-					 NULL );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				if( libesedb_list_append_value(
-				     catalog->table_definition_list,
-				     (intptr_t *) table_definition,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append table definition to table definition list.",
-					 function );
-
-					libesedb_table_definition_free(
-					 &table_definition,
-					 NULL );
-
-					goto on_error;
-				}
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
-				if( libesedb_table_definition_append_column_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append column catalog definition to table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX:
-				if( libesedb_table_definition_append_index_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append index catalog definition to table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE:
-				if( libesedb_table_definition_set_long_value_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set long value catalog definition in table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_CALLBACK:
-				if( libesedb_table_definition_set_callback_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set callback catalog definition in table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			default:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libnotify_verbose != 0 )
-				{
-					libnotify_printf(
-					 "%s: unsupported catalog definition type: %" PRIu16 ".\n",
-					 function,
-					 catalog_definition->type );
-				}
 #endif
-				if( libesedb_catalog_definition_free(
-				     &catalog_definition,
-				     error ) != 1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free catalog definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
+			liberror_error_free(
+			 error );
 		}
 	}
+	/* All the definitions have been read so the catalog values tree is no longer needed
+	 */
 	if( libfcache_cache_free(
-	     &catalog_values_cache,
+	     &( catalog->values_cache ),
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1119,7 +1245,7 @@ int libesedb_catalog_read(
 		goto on_error;
 	}
 	if( libfdata_tree_free(
-	     &catalog_values_tree,
+	     &( catalog->values_tree ),
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1134,22 +1260,16 @@ int libesedb_catalog_read(
 	return( 1 );
 
 on_error:
-	if( catalog_definition != NULL )
-	{
-		libesedb_catalog_definition_free(
-		 &catalog_definition,
-		 NULL );
-	}
-	if( catalog_values_cache != NULL )
+	if( catalog->values_cache != NULL )
 	{
 		libfcache_cache_free(
-		 &catalog_values_cache,
+		 &( catalog->values_cache ),
 		 NULL );
 	}
-	if( catalog_values_tree != NULL )
+	if( catalog->values_tree != NULL )
 	{
 		libfdata_tree_free(
-		 &catalog_values_tree,
+		 &( catalog->values_tree ),
 		 NULL );
 	}
 	if( catalog_page_tree != NULL )
@@ -1161,3 +1281,1049 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the data of a specific catalog values tree leaf node
+ * The data is stored in the page, which is referenced and must be released
+ * with libesedb_page_cache_release_page when the data is no longer used
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_definition_data(
+     libesedb_catalog_t *catalog,
+     int leaf_node_index,
+     libesedb_page_t **page,
+     uint8_t **definition_data,
+     size_t *definition_data_size,
+     liberror_error_t **error )
+{
+	libesedb_values_tree_value_t *values_tree_value = NULL;
+	libfdata_tree_node_t *values_tree_node          = NULL;
+	static char *function                           = "libesedb_catalog_read_definition_data";
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_tree_get_leaf_node_by_index(
+	     catalog->values_tree,
+	     catalog->file_io_handle,
+	     catalog->values_cache,
+	     leaf_node_index,
+	     &values_tree_node,
+	     0,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf node: %d from catalog values tree.",
+		 function,
+		 leaf_node_index );
+
+		return( -1 );
+	}
+	if( libfdata_tree_node_get_node_value(
+	     values_tree_node,
+	     catalog->file_io_handle,
+	     catalog->values_cache,
+	     (intptr_t **) &values_tree_value,
+	     0,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node value from values tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_values_tree_value_read_data(
+	     values_tree_value,
+	     catalog->file_io_handle,
+	     catalog->io_handle,
+	     catalog->pages_cache,
+	     page,
+	     definition_data,
+	     definition_data_size,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values tree value data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the catalog definition of a specific catalog values tree leaf node
+ * Make sure the value catalog_definition is pointing to is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_catalog_definition(
+     libesedb_catalog_t *catalog,
+     int leaf_node_index,
+     libesedb_catalog_definition_t **catalog_definition,
+     liberror_error_t **error )
+{
+	libesedb_page_t *page       = NULL;
+	uint8_t *definition_data    = NULL;
+	static char *function       = "libesedb_catalog_read_catalog_definition";
+	size_t definition_data_size = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_read_definition_data(
+	     catalog,
+	     leaf_node_index,
+	     &page,
+	     &definition_data,
+	     &definition_data_size,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog definition: %d data.",
+		 function,
+		 leaf_node_index );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_initialize(
+	     catalog_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog definition.",
+		 function );
+
+		libesedb_page_cache_release_page(
+		 catalog->pages_cache,
+		 &page,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_read(
+	     *catalog_definition,
+	     definition_data,
+	     definition_data_size,
+	     catalog->io_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog definition.",
+		 function );
+
+		libesedb_catalog_definition_free(
+		 catalog_definition,
+		 NULL );
+		libesedb_page_cache_release_page(
+		 catalog->pages_cache,
+		 &page,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_release_page(
+	     catalog->pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		libesedb_catalog_definition_free(
+		 catalog_definition,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a table definition from the table catalog definition and appends it to the catalog
+ * The table definition takes over the management of the table catalog definition
+ * On error the table catalog definition is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_append_table_definition(
+     libesedb_catalog_t *catalog,
+     libesedb_catalog_definition_t *table_catalog_definition,
+     libesedb_table_definition_t **table_definition,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_catalog_append_table_definition";
+	uint32_t hash         = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	*table_definition = NULL;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     table_catalog_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition.",
+		 function );
+
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libesedb_list_append_value(
+	     catalog->table_definition_list,
+	     (intptr_t *) *table_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table definition to table definition list.",
+		 function );
+
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+
+		return( -1 );
+	}
+	/* The table definition is indexed by the hash of its name
+	 */
+	if( ( *table_definition )->table_catalog_definition->name != NULL )
+	{
+		if( libesedb_hash_table_calculate_hash_from_byte_stream(
+		     &hash,
+		     ( *table_definition )->table_catalog_definition->name,
+		     ( *table_definition )->table_catalog_definition->name_size,
+		     LIBUNA_CODEPAGE_WINDOWS_1252,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of table name.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_hash_table_insert_value(
+		     catalog->table_definition_hash_table,
+		     hash,
+		     (intptr_t *) *table_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert table definition into table definition hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets a column, index, long value or callback catalog definition in the table definition
+ * The table definition takes over the management of the catalog definition
+ * Unsupported catalog definitions and on error the catalog definition are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_set_table_definition_value(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
+     libesedb_catalog_definition_t *catalog_definition,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_catalog_set_table_definition_value";
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	switch( catalog_definition->type )
+	{
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
+			if( libesedb_table_definition_append_column_catalog_definition(
+			     table_definition,
+			     catalog_definition,
+			     catalog->io_handle->ascii_codepage,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append column catalog definition to table definition.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX:
+			if( libesedb_table_definition_append_index_catalog_definition(
+			     table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index catalog definition to table definition.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE:
+			if( libesedb_table_definition_set_long_value_catalog_definition(
+			     table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set long value catalog definition in table definition.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_CALLBACK:
+			if( libesedb_table_definition_set_callback_catalog_definition(
+			     table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set callback catalog definition in table definition.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		default:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libnotify_verbose != 0 )
+			{
+				libnotify_printf(
+				 "%s: unsupported catalog definition type: %" PRIu16 ".\n",
+				 function,
+				 catalog_definition->type );
+			}
+#endif
+			if( libesedb_catalog_definition_free(
+			     &catalog_definition,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog definition.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_catalog_definition_free(
+	 &catalog_definition,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Appends a catalog definition
+ * A table catalog definition is appended as a new table definition, which is returned in table definition
+ * Other catalog definitions are set in the table definition of the preceding table catalog definition
+ * The catalog takes over the management of the catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_append_definition(
+     libesedb_catalog_t *catalog,
+     libesedb_catalog_definition_t *catalog_definition,
+     libesedb_table_definition_t **table_definition,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_catalog_append_definition";
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_definition->type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+	{
+		if( libesedb_catalog_append_table_definition(
+		     catalog,
+		     catalog_definition,
+		     table_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append table definition.",
+			 function );
+
+			return( -1 );
+		}
+		( *table_definition )->values_read = 1;
+	}
+	else if( *table_definition == NULL )
+	{
+		/* TODO add build-in table 1 support
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libnotify_verbose != 0 )
+		{
+			libnotify_printf(
+			 "%s: missing table definition for catalog definition type: %" PRIu16 ".\n",
+			 function,
+			 catalog_definition->type );
+		}
+#endif
+		if( libesedb_catalog_definition_free(
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libesedb_catalog_set_table_definition_value(
+	          catalog,
+	          *table_definition,
+	          catalog_definition,
+	          error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set catalog definition in table definition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads all the catalog definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_definitions(
+     libesedb_catalog_t *catalog,
+     liberror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition     = NULL;
+	static char *function                             = "libesedb_catalog_read_definitions";
+	int leaf_node_index                               = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_tree_get_number_of_leaf_nodes(
+	     catalog->values_tree,
+	     catalog->file_io_handle,
+	     catalog->values_cache,
+	     &( catalog->number_of_leaf_nodes ),
+	     0,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf nodes from catalog values tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_node_index = 0;
+	     leaf_node_index < catalog->number_of_leaf_nodes;
+	     leaf_node_index++ )
+	{
+		catalog_definition = NULL;
+
+		if( libesedb_catalog_read_catalog_definition(
+		     catalog,
+		     leaf_node_index,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d.",
+			 function,
+			 leaf_node_index );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_append_definition(
+		     catalog,
+		     catalog_definition,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append catalog definition: %d.",
+			 function,
+			 leaf_node_index );
+
+			return( -1 );
+		}
+	}
+	catalog->table_definitions_read = 1;
+
+	return( 1 );
+}
+
+/* Reads the table catalog definitions
+ * The other catalog definitions are skipped and read on demand
+ * by libesedb_catalog_read_table_definition_values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_table_definitions(
+     libesedb_catalog_t *catalog,
+     liberror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition     = NULL;
+	libesedb_page_t *page                             = NULL;
+	uint8_t *definition_data                          = NULL;
+	static char *function                             = "libesedb_catalog_read_table_definitions";
+	size_t definition_data_size                       = 0;
+	uint16_t definition_type                          = 0;
+	int leaf_node_index                               = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_tree_get_number_of_leaf_nodes(
+	     catalog->values_tree,
+	     catalog->file_io_handle,
+	     catalog->values_cache,
+	     &( catalog->number_of_leaf_nodes ),
+	     0,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf nodes from catalog values tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_node_index = 0;
+	     leaf_node_index < catalog->number_of_leaf_nodes;
+	     leaf_node_index++ )
+	{
+		if( libesedb_catalog_read_definition_data(
+		     catalog,
+		     leaf_node_index,
+		     &page,
+		     &definition_data,
+		     &definition_data_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d data.",
+			 function,
+			 leaf_node_index );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_definition_read_type(
+		     definition_data,
+		     definition_data_size,
+		     &definition_type,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d type.",
+			 function,
+			 leaf_node_index );
+
+			libesedb_page_cache_release_page(
+			 catalog->pages_cache,
+			 &page,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libesedb_page_cache_release_page(
+		     catalog->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
+		if( definition_type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+		{
+			continue;
+		}
+		catalog_definition = NULL;
+
+		if( libesedb_catalog_read_catalog_definition(
+		     catalog,
+		     leaf_node_index,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d.",
+			 function,
+			 leaf_node_index );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_append_table_definition(
+		     catalog,
+		     catalog_definition,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append table definition.",
+			 function );
+
+			return( -1 );
+		}
+		table_definition->leaf_node_index = leaf_node_index;
+	}
+	catalog->table_definitions_read = 1;
+
+	return( 1 );
+}
+
+/* Reads the column, index, long value and callback catalog definitions of a table definition
+ * These catalog definitions directly follow the table catalog definition in the catalog values tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_table_definition_values(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
+     liberror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_page_t *page                             = NULL;
+	uint8_t *definition_data                          = NULL;
+	static char *function                             = "libesedb_catalog_read_table_definition_values";
+	size_t definition_data_size                       = 0;
+	uint16_t definition_type                          = 0;
+	int leaf_node_index                               = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_node_index = table_definition->leaf_node_index + 1;
+	     leaf_node_index < catalog->number_of_leaf_nodes;
+	     leaf_node_index++ )
+	{
+		if( libesedb_catalog_read_definition_data(
+		     catalog,
+		     leaf_node_index,
+		     &page,
+		     &definition_data,
+		     &definition_data_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d data.",
+			 function,
+			 leaf_node_index );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_definition_read_type(
+		     definition_data,
+		     definition_data_size,
+		     &definition_type,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d type.",
+			 function,
+			 leaf_node_index );
+
+			libesedb_page_cache_release_page(
+			 catalog->pages_cache,
+			 &page,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libesedb_page_cache_release_page(
+		     catalog->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
+		if( definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+		{
+			break;
+		}
+		catalog_definition = NULL;
+
+		if( libesedb_catalog_read_catalog_definition(
+		     catalog,
+		     leaf_node_index,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d.",
+			 function,
+			 leaf_node_index );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_set_table_definition_value(
+		     catalog,
+		     table_definition,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set catalog definition: %d in table definition.",
+			 function,
+			 leaf_node_index );
+
+			return( -1 );
+		}
+	}
+	table_definition->values_read = 1;
+
+	return( 1 );
+}
+
+/* Reads the catalog definitions that have not been read yet
+ * The table definitions are read on first access of the catalog and
+ * the other catalog definitions of a table when its table definition is first retrieved
+ * The table definition is optional
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_on_demand(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_catalog_read_on_demand";
+	int result            = 1;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->read_on_demand == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_lock(
+	     &( catalog->read_on_demand_lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to lock read on demand lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( catalog->table_definitions_read == 0 )
+	{
+		if( libesedb_catalog_read_table_definitions(
+		     catalog,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table definitions.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( table_definition != NULL )
+	 && ( table_definition->values_read == 0 ) )
+	{
+		if( libesedb_catalog_read_table_definition_values(
+		     catalog,
+		     table_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table definition values.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_unlock(
+	     &( catalog->read_on_demand_lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock read on demand lock.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
@@ -27,11 +27,18 @@
 
 #include <liberror.h>
 
+#if defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+#endif
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_hash_table.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_list_type.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -45,6 +52,50 @@ struct libesedb_catalog
 	/* The table definition list
 	 */
 	libesedb_list_t *table_definition_list;
+
+	/* The table definition hash table
+	 * Contains the table definitions by the hash of their name
+	 */
+	libesedb_hash_table_t *table_definition_hash_table;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The pages cache
+	 */
+	libesedb_page_cache_t *pages_cache;
+
+	/* The catalog values tree
+	 */
+	libfdata_tree_t *values_tree;
+
+	/* The catalog values cache
+	 */
+	libfcache_cache_t *values_cache;
+
+	/* The number of leaf nodes in the catalog values tree
+	 */
+	int number_of_leaf_nodes;
+
+	/* Value to indicate the catalog definitions are read on demand
+	 */
+	uint8_t read_on_demand;
+
+	/* Value to indicate the table definitions have been read
+	 */
+	uint8_t table_definitions_read;
+
+#if defined( HAVE_PTHREAD )
+	/* The read on demand lock
+	 * Serializes the reading of the catalog definitions on demand
+	 */
+	pthread_mutex_t read_on_demand_lock;
+#endif
 };
 
 int libesedb_catalog_initialize(
@@ -55,6 +106,10 @@ int libesedb_catalog_free(
      libesedb_catalog_t **catalog,
      liberror_error_t **error );
 
+int libesedb_catalog_empty_table_definitions(
+     libesedb_catalog_t *catalog,
+     liberror_error_t **error );
+
 int libesedb_catalog_get_number_of_table_definitions(
      libesedb_catalog_t *catalog,
      int *number_of_table_definitions,
@@ -91,8 +146,59 @@ int libesedb_catalog_read(
      libesedb_catalog_t *catalog,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
+     libbfio_handle_t *cache_file_io_handle,
+     uint8_t read_on_demand,
+     liberror_error_t **error );
+
+int libesedb_catalog_read_definition_data(
+     libesedb_catalog_t *catalog,
+     int leaf_node_index,
+     libesedb_page_t **page,
+     uint8_t **definition_data,
+     size_t *definition_data_size,
+     liberror_error_t **error );
+
+int libesedb_catalog_read_catalog_definition(
+     libesedb_catalog_t *catalog,
+     int leaf_node_index,
+     libesedb_catalog_definition_t **catalog_definition,
+     liberror_error_t **error );
+
+int libesedb_catalog_append_table_definition(
+     libesedb_catalog_t *catalog,
+     libesedb_catalog_definition_t *table_catalog_definition,
+     libesedb_table_definition_t **table_definition,
+     liberror_error_t **error );
+
+int libesedb_catalog_set_table_definition_value(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
+     libesedb_catalog_definition_t *catalog_definition,
+     liberror_error_t **error );
+
+int libesedb_catalog_append_definition(
+     libesedb_catalog_t *catalog,
+     libesedb_catalog_definition_t *catalog_definition,
+     libesedb_table_definition_t **table_definition,
+     liberror_error_t **error );
+
+int libesedb_catalog_read_definitions(
+     libesedb_catalog_t *catalog,
+     liberror_error_t **error );
+
+int libesedb_catalog_read_table_definitions(
+     libesedb_catalog_t *catalog,
+     liberror_error_t **error );
+
+int libesedb_catalog_read_table_definition_values(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
+     liberror_error_t **error );
+
+int libesedb_catalog_read_on_demand(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
      liberror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,993 @@
+/*
+ * Catalog cache functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+#include <libnotify.h>
+
+#include "libesedb_catalog.h"
+#include "libesedb_catalog_cache.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_checksum.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_page_cache.h"
+#include "libesedb_table_definition.h"
+
+#include "esedb_catalog_cache.h"
+
+const uint8_t esedb_catalog_cache_signature[ 8 ] = { 'E', 'S', 'E', 'D', 'B', 'C', 'A', 'T' };
+
+/* Reads the catalog from a catalog cache file
+ * The catalog cache file is only used if it was written for the same state of the database file
+ * Returns 1 if successful, 0 if the catalog cache file is missing or does not match or -1 on error
+ */
+int libesedb_catalog_cache_read(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *cache_file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error )
+{
+	uint8_t header_data[ sizeof( esedb_catalog_cache_header_t ) ];
+
+	esedb_catalog_cache_header_t *header = NULL;
+	uint8_t *definitions_data            = NULL;
+	uint8_t *definitions_data_buffer     = NULL;
+	static char *function                = "libesedb_catalog_cache_read";
+	size64_t file_size                   = 0;
+	ssize_t read_count                   = 0;
+	uint64_t value_64bit                 = 0;
+	uint32_t calculated_checksum         = 0;
+	uint32_t definitions_data_size       = 0;
+	uint32_t number_of_definitions       = 0;
+	uint32_t stored_checksum             = 0;
+	uint32_t value_32bit                 = 0;
+	int result                           = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A missing catalog cache file is not considered an error
+	 */
+	if( libbfio_handle_open(
+	     cache_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libnotify_verbose != 0 )
+		{
+			libnotify_printf(
+			 "%s: unable to open catalog cache file.\n",
+			 function );
+		}
+#endif
+		liberror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	if( libbfio_handle_get_size(
+	     cache_file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog cache file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size < (size64_t) sizeof( esedb_catalog_cache_header_t ) )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	read_count = libbfio_handle_read_at(
+	              cache_file_io_handle,
+	              header_data,
+	              sizeof( esedb_catalog_cache_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( esedb_catalog_cache_header_t ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog cache file header.",
+		 function );
+
+		goto on_error;
+	}
+	header = (esedb_catalog_cache_header_t *) header_data;
+
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     &( header_data[ 4 ] ),
+	     sizeof( esedb_catalog_cache_header_t ) - 4,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->checksum,
+	 stored_checksum );
+
+	if( stored_checksum != calculated_checksum )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	if( memory_compare(
+	     header->signature,
+	     esedb_catalog_cache_signature,
+	     8 ) != 0 )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->format_version,
+	 value_32bit );
+
+	if( value_32bit != LIBESEDB_CATALOG_CACHE_FORMAT_VERSION )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	/* The catalog cache file must have been written for the same state of the database file
+	 */
+	byte_stream_copy_to_uint64_little_endian(
+	 header->database_time,
+	 value_64bit );
+
+	if( value_64bit != io_handle->database_time )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	if( memory_compare(
+	     header->database_signature,
+	     io_handle->database_signature,
+	     28 ) != 0 )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->database_state,
+	 value_32bit );
+
+	if( value_32bit != io_handle->database_state )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->page_size,
+	 value_32bit );
+
+	if( value_32bit != io_handle->page_size )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->last_page_number,
+	 value_32bit );
+
+	if( value_32bit != io_handle->last_page_number )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_definitions,
+	 number_of_definitions );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->definitions_data_size,
+	 definitions_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->definitions_data_checksum,
+	 stored_checksum );
+
+	if( (size64_t) definitions_data_size != ( file_size - sizeof( esedb_catalog_cache_header_t ) ) )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	if( definitions_data_size > (uint32_t) SSIZE_MAX )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	if( definitions_data_size > 0 )
+	{
+		/* Use the memory mapped data if available
+		 */
+		result = libbfio_handle_get_data_reference(
+		          cache_file_io_handle,
+		          (off64_t) sizeof( esedb_catalog_cache_header_t ),
+		          (size_t) definitions_data_size,
+		          &definitions_data,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog definitions data reference.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			definitions_data_buffer = (uint8_t *) memory_allocate(
+			                                       sizeof( uint8_t ) * definitions_data_size );
+
+			if( definitions_data_buffer == NULL )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_MEMORY,
+				 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create catalog definitions data.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = libbfio_handle_read_at(
+			              cache_file_io_handle,
+			              definitions_data_buffer,
+			              (size_t) definitions_data_size,
+			              (off64_t) sizeof( esedb_catalog_cache_header_t ),
+			              error );
+
+			if( read_count != (ssize_t) definitions_data_size )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_IO,
+				 LIBERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog definitions data.",
+				 function );
+
+				goto on_error;
+			}
+			definitions_data = definitions_data_buffer;
+		}
+	}
+	/* The XOR-32 checksum of empty definitions data is the initial value
+	 */
+	calculated_checksum = 0x89abcdef;
+
+	if( definitions_data_size > 0 )
+	{
+		if( libesedb_checksum_calculate_little_endian_xor32(
+		     &calculated_checksum,
+		     definitions_data,
+		     (size_t) definitions_data_size,
+		     0x89abcdef,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate XOR-32 checksum.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		result = 0;
+
+		goto on_close;
+	}
+	result = libesedb_catalog_cache_read_definitions(
+	          catalog,
+	          definitions_data,
+	          (size_t) definitions_data_size,
+	          number_of_definitions,
+	          io_handle->ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog definitions.",
+		 function );
+
+		goto on_error;
+	}
+	/* Definitions that cannot be read are handled as a catalog cache file that does not match
+	 * the catalog is read from the database file instead
+	 */
+	else if( result == 0 )
+	{
+		if( libesedb_catalog_empty_table_definitions(
+		     catalog,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty table definitions.",
+			 function );
+
+			goto on_error;
+		}
+		goto on_close;
+	}
+
+on_close:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libnotify_verbose != 0 )
+	{
+		if( result == 0 )
+		{
+			libnotify_printf(
+			 "%s: catalog cache file does not match database file.\n",
+			 function );
+		}
+	}
+#endif
+	if( definitions_data_buffer != NULL )
+	{
+		memory_free(
+		 definitions_data_buffer );
+
+		definitions_data_buffer = NULL;
+	}
+	if( libbfio_handle_close(
+	     cache_file_io_handle,
+	     error ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close catalog cache file.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( definitions_data_buffer != NULL )
+	{
+		memory_free(
+		 definitions_data_buffer );
+	}
+	libbfio_handle_close(
+	 cache_file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the catalog definitions from the catalog cache file definitions data
+ * Returns 1 if successful, 0 if the definitions data is invalid or -1 on error
+ */
+int libesedb_catalog_cache_read_definitions(
+     libesedb_catalog_t *catalog,
+     const uint8_t *definitions_data,
+     size_t definitions_data_size,
+     uint32_t number_of_definitions,
+     int ascii_codepage,
+     liberror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition     = NULL;
+	static char *function                             = "libesedb_catalog_cache_read_definitions";
+	size_t definitions_data_offset                    = 0;
+	uint32_t definition_data_size                     = 0;
+	uint32_t definition_index                         = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( definitions_data == NULL )
+	 && ( definitions_data_size > 0 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definitions data.",
+		 function );
+
+		return( -1 );
+	}
+	if( definitions_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid definitions data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		if( ( definitions_data_size - definitions_data_offset ) < sizeof( esedb_catalog_cache_definition_t ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libnotify_verbose != 0 )
+			{
+				libnotify_printf(
+				 "%s: catalog definition: %" PRIu32 " exceeds definitions data.\n",
+				 function,
+				 definition_index );
+			}
+#endif
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_catalog_cache_definition_t *) &( definitions_data[ definitions_data_offset ] ) )->data_size,
+		 definition_data_size );
+
+		definitions_data_offset += sizeof( esedb_catalog_cache_definition_t );
+
+		if( (size_t) definition_data_size > ( definitions_data_size - definitions_data_offset ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libnotify_verbose != 0 )
+			{
+				libnotify_printf(
+				 "%s: catalog definition: %" PRIu32 " data size exceeds definitions data.\n",
+				 function,
+				 definition_index );
+			}
+#endif
+			return( 0 );
+		}
+		catalog_definition = NULL;
+
+		if( libesedb_catalog_definition_initialize(
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_definition_read(
+		     catalog_definition,
+		     (uint8_t *) &( definitions_data[ definitions_data_offset ] ),
+		     (size_t) definition_data_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libnotify_verbose != 0 )
+			{
+				libnotify_printf(
+				 "%s: unable to read catalog definition: %" PRIu32 ".\n",
+				 function,
+				 definition_index );
+			}
+#endif
+			liberror_error_free(
+			 error );
+
+			libesedb_catalog_definition_free(
+			 &catalog_definition,
+			 NULL );
+
+			return( 0 );
+		}
+		definitions_data_offset += definition_data_size;
+
+		if( libesedb_catalog_append_definition(
+		     catalog,
+		     catalog_definition,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append catalog definition: %" PRIu32 ".",
+			 function,
+			 definition_index );
+
+			return( -1 );
+		}
+	}
+	catalog->table_definitions_read = 1;
+
+	return( 1 );
+}
+
+/* Writes the catalog to a catalog cache file
+ * The catalog values tree must contain all the catalog definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_write(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *cache_file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error )
+{
+	esedb_catalog_cache_header_t header;
+
+	libesedb_page_t *page          = NULL;
+	uint8_t *definition_data       = NULL;
+	uint8_t *definitions_data      = NULL;
+	static char *function          = "libesedb_catalog_cache_write";
+	void *reallocation             = NULL;
+	size_t definition_data_size    = 0;
+	size_t definitions_data_size   = 0;
+	size_t maximum_data_size       = 0;
+	ssize_t write_count            = 0;
+	uint32_t checksum              = 0;
+	int is_open                    = 0;
+	int leaf_node_index            = 0;
+
+	if( catalog == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->values_tree == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing values tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_node_index = 0;
+	     leaf_node_index < catalog->number_of_leaf_nodes;
+	     leaf_node_index++ )
+	{
+		if( libesedb_catalog_read_definition_data(
+		     catalog,
+		     leaf_node_index,
+		     &page,
+		     &definition_data,
+		     &definition_data_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d data.",
+			 function,
+			 leaf_node_index );
+
+			goto on_error;
+		}
+		if( ( definition_data_size + sizeof( esedb_catalog_cache_definition_t ) ) > ( (size_t) UINT32_MAX - definitions_data_size ) )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid definitions data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( definitions_data_size + sizeof( esedb_catalog_cache_definition_t ) + definition_data_size ) > maximum_data_size )
+		{
+			maximum_data_size = 2 * ( definitions_data_size + sizeof( esedb_catalog_cache_definition_t ) + definition_data_size );
+
+			reallocation = memory_reallocate(
+			                definitions_data,
+			                sizeof( uint8_t ) * maximum_data_size );
+
+			if( reallocation == NULL )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_MEMORY,
+				 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize definitions data.",
+				 function );
+
+				goto on_error;
+			}
+			definitions_data = (uint8_t *) reallocation;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_catalog_cache_definition_t *) &( definitions_data[ definitions_data_size ] ) )->data_size,
+		 definition_data_size );
+
+		definitions_data_size += sizeof( esedb_catalog_cache_definition_t );
+
+		if( memory_copy(
+		     &( definitions_data[ definitions_data_size ] ),
+		     definition_data,
+		     definition_data_size ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy catalog definition: %d data.",
+			 function,
+			 leaf_node_index );
+
+			goto on_error;
+		}
+		definitions_data_size += definition_data_size;
+
+		if( libesedb_page_cache_release_page(
+		     catalog->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( memory_set(
+	     &header,
+	     0,
+	     sizeof( esedb_catalog_cache_header_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     header.signature,
+	     esedb_catalog_cache_signature,
+	     8 ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.format_version,
+	 LIBESEDB_CATALOG_CACHE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header.database_time,
+	 io_handle->database_time );
+
+	if( memory_copy(
+	     header.database_signature,
+	     io_handle->database_signature,
+	     28 ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.database_state,
+	 io_handle->database_state );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.page_size,
+	 io_handle->page_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.last_page_number,
+	 io_handle->last_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.number_of_definitions,
+	 (uint32_t) catalog->number_of_leaf_nodes );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.definitions_data_size,
+	 (uint32_t) definitions_data_size );
+
+	/* The XOR-32 checksum of empty definitions data is the initial value
+	 */
+	checksum = 0x89abcdef;
+
+	if( definitions_data_size > 0 )
+	{
+		if( libesedb_checksum_calculate_little_endian_xor32(
+		     &checksum,
+		     definitions_data,
+		     definitions_data_size,
+		     0x89abcdef,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate XOR-32 checksum.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.definitions_data_checksum,
+	 checksum );
+
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &checksum,
+	     &( ( (uint8_t *) &header )[ 4 ] ),
+	     sizeof( esedb_catalog_cache_header_t ) - 4,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.checksum,
+	 checksum );
+
+	if( libbfio_handle_open(
+	     cache_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open catalog cache file.",
+		 function );
+
+		goto on_error;
+	}
+	is_open = 1;
+
+	/* The header is written last so that an incomplete catalog cache file is not used
+	 */
+	if( libbfio_handle_seek_offset(
+	     cache_file_io_handle,
+	     (off64_t) sizeof( esedb_catalog_cache_header_t ),
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek catalog definitions data offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( definitions_data_size > 0 )
+	{
+		write_count = libbfio_handle_write(
+		               cache_file_io_handle,
+		               definitions_data,
+		               definitions_data_size,
+		               error );
+
+		if( write_count != (ssize_t) definitions_data_size )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write catalog definitions data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_seek_offset(
+	     cache_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek header offset.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write(
+	               cache_file_io_handle,
+	               (uint8_t *) &header,
+	               sizeof( esedb_catalog_cache_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( esedb_catalog_cache_header_t ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	is_open = 0;
+
+	if( libbfio_handle_close(
+	     cache_file_io_handle,
+	     error ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close catalog cache file.",
+		 function );
+
+		goto on_error;
+	}
+	if( definitions_data != NULL )
+	{
+		memory_free(
+		 definitions_data );
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 catalog->pages_cache,
+		 &page,
+		 NULL );
+	}
+	if( is_open != 0 )
+	{
+		libbfio_handle_close(
+		 cache_file_io_handle,
+		 NULL );
+	}
+	if( definitions_data != NULL )
+	{
+		memory_free(
+		 definitions_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,67 @@
+/*
+ * Catalog cache functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_CATALOG_CACHE_H )
+#define _LIBESEDB_CATALOG_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_catalog.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBESEDB_CATALOG_CACHE_FORMAT_VERSION	1
+
+extern const uint8_t esedb_catalog_cache_signature[ 8 ];
+
+int libesedb_catalog_cache_read(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *cache_file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error );
+
+int libesedb_catalog_cache_read_definitions(
+     libesedb_catalog_t *catalog,
+     const uint8_t *definitions_data,
+     size_t definitions_data_size,
+     uint32_t number_of_definitions,
+     int ascii_codepage,
+     liberror_error_t **error );
+
+int libesedb_catalog_cache_write(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *cache_file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -1163,6 +1163,74 @@ int libesedb_catalog_definition_read(
 	return( 1 );
 }
 
+/* Reads the type from the catalog definition data
+ * Only the fixed size data types up to and including the type are read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_read_type(
+     const uint8_t *definition_data,
+     size_t definition_data_size,
+     uint16_t *type,
+     liberror_error_t **error )
+{
+	const uint8_t *fixed_size_data_type_value_data = NULL;
+	static char *function                          = "libesedb_catalog_definition_read_type";
+
+	if( definition_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definition data.",
+		 function );
+
+		return( -1 );
+	}
+	if( definition_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid definition data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The father data page (FDP) object identifier (4 bytes) precedes the type (2 bytes)
+	 */
+	if( definition_data_size < ( sizeof( esedb_data_definition_header_t ) + 6 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: definition data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	fixed_size_data_type_value_data = &( definition_data[ sizeof( esedb_data_definition_header_t ) ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->type,
+	 *type );
+
+	return( 1 );
+}
+
 /* Retrieves the catalog definition identifier
  * Returns 1 if successful or -1 on error
  */
@@ -113,6 +113,12 @@ int libesedb_catalog_definition_read(
      int ascii_codepage,
      liberror_error_t **error );
 
+int libesedb_catalog_definition_read_type(
+     const uint8_t *definition_data,
+     size_t definition_data_size,
+     uint16_t *type,
+     liberror_error_t **error );
+
 int libesedb_catalog_definition_get_identifier(
      libesedb_catalog_definition_t *catalog_definition,
      uint32_t *identifier,
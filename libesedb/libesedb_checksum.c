@@ -27,6 +27,10 @@
 
 #include "libesedb_checksum.h"
 
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+#include <immintrin.h>
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
@@ -53,6 +57,244 @@ const uint8_t libesedb_checksum_ecc32_include_lookup_table[ 256 ] = {
 	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0
 };
 
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+
+/* The checksum kernels
+ */
+enum LIBESEDB_CHECKSUM_KERNELS
+{
+	LIBESEDB_CHECKSUM_KERNEL_UNDETERMINED	= -1,
+	LIBESEDB_CHECKSUM_KERNEL_SCALAR		= 0,
+	LIBESEDB_CHECKSUM_KERNEL_SSE2		= 1,
+	LIBESEDB_CHECKSUM_KERNEL_AVX2		= 2
+};
+
+/* The checksum kernel supported by the CPU
+ * The value is determined on first use, concurrent determination results in the same value
+ */
+static int libesedb_checksum_kernel = LIBESEDB_CHECKSUM_KERNEL_UNDETERMINED;
+
+/* Determines the checksum kernel supported by the CPU
+ * Returns the checksum kernel
+ */
+int libesedb_checksum_get_kernel(
+     void )
+{
+	int kernel = libesedb_checksum_kernel;
+
+	if( kernel == LIBESEDB_CHECKSUM_KERNEL_UNDETERMINED )
+	{
+		kernel = LIBESEDB_CHECKSUM_KERNEL_SCALAR;
+
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "avx2" ) != 0 )
+		{
+			kernel = LIBESEDB_CHECKSUM_KERNEL_AVX2;
+		}
+		else if( __builtin_cpu_supports( "sse2" ) != 0 )
+		{
+			kernel = LIBESEDB_CHECKSUM_KERNEL_SSE2;
+		}
+		libesedb_checksum_kernel = kernel;
+	}
+	return( kernel );
+}
+
+/* Calculates the ECC-32 part and vertical XOR-32 values of 16-byte blocks using SSE2
+ * The buffer must contain number of blocks * 16 bytes
+ */
+__attribute__((target("sse2")))
+void libesedb_checksum_calculate_ecc32_blocks_sse2(
+     const uint8_t *buffer,
+     size_t number_of_blocks,
+     uint32_t *ecc_checksum_value,
+     uint32_t *bitmask,
+     uint32_t *xor32_vertical_values )
+{
+	__m128i block_value     = _mm_setzero_si128();
+	__m128i vertical_value  = _mm_setzero_si128();
+	__m128i xor128_value    = _mm_setzero_si128();
+	uint32_t vertical[ 4 ];
+	uint32_t xor32_value    = 0;
+	uint8_t mask_table_index = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		block_value    = _mm_loadu_si128( (const __m128i *) buffer );
+		vertical_value = _mm_xor_si128( vertical_value, block_value );
+
+		/* Fold the 4 x 32-bit values into a single 32-bit value
+		 */
+		xor128_value = _mm_xor_si128( block_value, _mm_srli_si128( block_value, 8 ) );
+		xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 4 ) );
+		xor32_value  = (uint32_t) _mm_cvtsi128_si32( xor128_value );
+
+		xor32_value     ^= xor32_value >> 16;
+		mask_table_index = (uint8_t) ( xor32_value ^ ( xor32_value >> 8 ) );
+
+		if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
+		{
+			*ecc_checksum_value ^= *bitmask;
+		}
+		*bitmask -= 0x007fff80UL;
+
+		buffer           += 16;
+		number_of_blocks -= 1;
+	}
+	_mm_storeu_si128(
+	 (__m128i *) vertical,
+	 vertical_value );
+
+	xor32_vertical_values[ 0 ] ^= vertical[ 0 ];
+	xor32_vertical_values[ 1 ] ^= vertical[ 1 ];
+	xor32_vertical_values[ 2 ] ^= vertical[ 2 ];
+	xor32_vertical_values[ 3 ] ^= vertical[ 3 ];
+}
+
+/* Calculates the ECC-32 part and vertical XOR-32 values of 16-byte blocks using AVX2
+ * The buffer must contain number of blocks * 16 bytes
+ */
+__attribute__((target("avx2")))
+void libesedb_checksum_calculate_ecc32_blocks_avx2(
+     const uint8_t *buffer,
+     size_t number_of_blocks,
+     uint32_t *ecc_checksum_value,
+     uint32_t *bitmask,
+     uint32_t *xor32_vertical_values )
+{
+	__m256i block_value      = _mm256_setzero_si256();
+	__m256i vertical_value   = _mm256_setzero_si256();
+	__m256i xor256_value     = _mm256_setzero_si256();
+	__m128i vertical128      = _mm_setzero_si128();
+	uint32_t vertical[ 4 ];
+	uint32_t xor32_value     = 0;
+	uint8_t mask_table_index = 0;
+
+	/* Process 2 blocks per iteration
+	 */
+	while( number_of_blocks >= 2 )
+	{
+		block_value    = _mm256_loadu_si256( (const __m256i *) buffer );
+		vertical_value = _mm256_xor_si256( vertical_value, block_value );
+
+		/* Fold the 4 x 32-bit values of each 128-bit lane into a single 32-bit value
+		 */
+		xor256_value = _mm256_xor_si256( block_value, _mm256_srli_si256( block_value, 8 ) );
+		xor256_value = _mm256_xor_si256( xor256_value, _mm256_srli_si256( xor256_value, 4 ) );
+
+		xor32_value      = (uint32_t) _mm256_extract_epi32( xor256_value, 0 );
+		xor32_value     ^= xor32_value >> 16;
+		mask_table_index = (uint8_t) ( xor32_value ^ ( xor32_value >> 8 ) );
+
+		if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
+		{
+			*ecc_checksum_value ^= *bitmask;
+		}
+		*bitmask -= 0x007fff80UL;
+
+		xor32_value      = (uint32_t) _mm256_extract_epi32( xor256_value, 4 );
+		xor32_value     ^= xor32_value >> 16;
+		mask_table_index = (uint8_t) ( xor32_value ^ ( xor32_value >> 8 ) );
+
+		if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
+		{
+			*ecc_checksum_value ^= *bitmask;
+		}
+		*bitmask -= 0x007fff80UL;
+
+		buffer           += 32;
+		number_of_blocks -= 2;
+	}
+	vertical128 = _mm_xor_si128(
+	               _mm256_castsi256_si128( vertical_value ),
+	               _mm256_extracti128_si256( vertical_value, 1 ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) vertical,
+	 vertical128 );
+
+	xor32_vertical_values[ 0 ] ^= vertical[ 0 ];
+	xor32_vertical_values[ 1 ] ^= vertical[ 1 ];
+	xor32_vertical_values[ 2 ] ^= vertical[ 2 ];
+	xor32_vertical_values[ 3 ] ^= vertical[ 3 ];
+
+	if( number_of_blocks > 0 )
+	{
+		libesedb_checksum_calculate_ecc32_blocks_sse2(
+		 buffer,
+		 number_of_blocks,
+		 ecc_checksum_value,
+		 bitmask,
+		 xor32_vertical_values );
+	}
+}
+
+/* Calculates the XOR-32 of 16-byte blocks using SSE2
+ * The buffer must contain number of blocks * 16 bytes
+ * Returns the XOR-32
+ */
+__attribute__((target("sse2")))
+uint32_t libesedb_checksum_calculate_xor32_blocks_sse2(
+     const uint8_t *buffer,
+     size_t number_of_blocks )
+{
+	__m128i xor128_value = _mm_setzero_si128();
+
+	while( number_of_blocks > 0 )
+	{
+		xor128_value = _mm_xor_si128(
+		                xor128_value,
+		                _mm_loadu_si128( (const __m128i *) buffer ) );
+
+		buffer           += 16;
+		number_of_blocks -= 1;
+	}
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 8 ) );
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 4 ) );
+
+	return( (uint32_t) _mm_cvtsi128_si32( xor128_value ) );
+}
+
+/* Calculates the XOR-32 of 16-byte blocks using AVX2
+ * The buffer must contain number of blocks * 16 bytes
+ * Returns the XOR-32
+ */
+__attribute__((target("avx2")))
+uint32_t libesedb_checksum_calculate_xor32_blocks_avx2(
+     const uint8_t *buffer,
+     size_t number_of_blocks )
+{
+	__m256i xor256_value = _mm256_setzero_si256();
+	__m128i xor128_value = _mm_setzero_si128();
+
+	while( number_of_blocks >= 2 )
+	{
+		xor256_value = _mm256_xor_si256(
+		                xor256_value,
+		                _mm256_loadu_si256( (const __m256i *) buffer ) );
+
+		buffer           += 32;
+		number_of_blocks -= 2;
+	}
+	xor128_value = _mm_xor_si128(
+	                _mm256_castsi256_si128( xor256_value ),
+	                _mm256_extracti128_si256( xor256_value, 1 ) );
+
+	if( number_of_blocks > 0 )
+	{
+		xor128_value = _mm_xor_si128(
+		                xor128_value,
+		                _mm_loadu_si128( (const __m128i *) buffer ) );
+	}
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 8 ) );
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 4 ) );
+
+	return( (uint32_t) _mm_cvtsi128_si32( xor128_value ) );
+}
+
+#endif /* defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD ) */
+
 /* Calculates the little-endian ECC-32 and XOR-32 of a buffer
  * It uses the initial value to calculate a new XOR-32
  * Returns 1 if successful or -1 on error
@@ -80,6 +322,12 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 	uint32_t xor32_vertical_fourth = 0;
 	uint8_t mask_table_index       = 0;
 
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+	uint32_t xor32_vertical_values[ 4 ];
+	size_t number_of_blocks        = 0;
+	int kernel                     = 0;
+#endif
+
 	if( ecc_checksum_value == NULL )
 	{
 		liberror_error_set(
@@ -153,10 +401,60 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 	bitmask             = 0xff800000UL;
 	buffer             += offset;
 
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+	kernel = libesedb_checksum_get_kernel();
+#endif
 	for( buffer_iterator = offset;
 	     buffer_iterator < size;
 	     buffer_iterator += 4 )
 	{
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+		/* Process the remaining 16-byte blocks at once when the buffer is at
+		 * the start of a block, the scalar loop handles the partial blocks
+		 */
+		if( ( buffer_alignment == 0 )
+		 && ( kernel != LIBESEDB_CHECKSUM_KERNEL_SCALAR )
+		 && ( ( size - buffer_iterator ) >= 16 ) )
+		{
+			number_of_blocks = ( size - buffer_iterator ) / 16;
+
+			xor32_vertical_values[ 0 ] = xor32_vertical_first;
+			xor32_vertical_values[ 1 ] = xor32_vertical_second;
+			xor32_vertical_values[ 2 ] = xor32_vertical_third;
+			xor32_vertical_values[ 3 ] = xor32_vertical_fourth;
+
+			if( kernel == LIBESEDB_CHECKSUM_KERNEL_AVX2 )
+			{
+				libesedb_checksum_calculate_ecc32_blocks_avx2(
+				 buffer,
+				 number_of_blocks,
+				 ecc_checksum_value,
+				 &bitmask,
+				 xor32_vertical_values );
+			}
+			else
+			{
+				libesedb_checksum_calculate_ecc32_blocks_sse2(
+				 buffer,
+				 number_of_blocks,
+				 ecc_checksum_value,
+				 &bitmask,
+				 xor32_vertical_values );
+			}
+			xor32_vertical_first  = xor32_vertical_values[ 0 ];
+			xor32_vertical_second = xor32_vertical_values[ 1 ];
+			xor32_vertical_third  = xor32_vertical_values[ 2 ];
+			xor32_vertical_fourth = xor32_vertical_values[ 3 ];
+
+			buffer          += number_of_blocks * 16;
+			buffer_iterator += number_of_blocks * 16;
+
+			if( buffer_iterator >= size )
+			{
+				break;
+			}
+		}
+#endif
 		byte_stream_copy_to_uint32_little_endian(
 		 buffer,
 		 value_32bit );
@@ -343,6 +641,11 @@ int libesedb_checksum_calculate_little_endian_xor32(
 	uint8_t byte_order                          = 0;
 	uint8_t byte_size                           = 0;
 
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+	size_t number_of_blocks                     = 0;
+	int kernel                                  = 0;
+#endif
+
 	if( checksum_value == NULL )
 	{
 		liberror_error_set(
@@ -380,6 +683,34 @@ int libesedb_checksum_calculate_little_endian_xor32(
 
 	buffer_iterator = (uint8_t *) buffer;
 
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+	/* Process the 16-byte blocks at once, the 32-bit values of the remaining
+	 * data have the same alignment relative to the start of the buffer
+	 */
+	kernel = libesedb_checksum_get_kernel();
+
+	if( ( kernel != LIBESEDB_CHECKSUM_KERNEL_SCALAR )
+	 && ( size >= 16 ) )
+	{
+		number_of_blocks = size / 16;
+
+		if( kernel == LIBESEDB_CHECKSUM_KERNEL_AVX2 )
+		{
+			*checksum_value ^= libesedb_checksum_calculate_xor32_blocks_avx2(
+			                    buffer_iterator,
+			                    number_of_blocks );
+		}
+		else
+		{
+			*checksum_value ^= libesedb_checksum_calculate_xor32_blocks_sse2(
+			                    buffer_iterator,
+			                    number_of_blocks );
+		}
+		buffer_iterator += number_of_blocks * 16;
+		size            -= number_of_blocks * 16;
+	}
+#endif
+
 	/* Only optimize when there is the alignment is a multitude of 32-bit
 	 * and for buffers larger than the alignment
 	 */
@@ -31,6 +31,44 @@
 extern "C" {
 #endif
 
+/* The SIMD checksum kernels are available on x86 and x86-64 when the compiler
+ * supports function specific target options and runtime CPU detection
+ */
+#if ( defined( __i386__ ) || defined( __x86_64__ ) ) \
+ && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) ) ) \
+ && !defined( LIBESEDB_DISABLE_SIMD )
+#define LIBESEDB_CHECKSUM_HAVE_X86_SIMD
+#endif
+
+#if defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD )
+
+int libesedb_checksum_get_kernel(
+     void );
+
+void libesedb_checksum_calculate_ecc32_blocks_sse2(
+     const uint8_t *buffer,
+     size_t number_of_blocks,
+     uint32_t *ecc_checksum_value,
+     uint32_t *bitmask,
+     uint32_t *xor32_vertical_values );
+
+void libesedb_checksum_calculate_ecc32_blocks_avx2(
+     const uint8_t *buffer,
+     size_t number_of_blocks,
+     uint32_t *ecc_checksum_value,
+     uint32_t *bitmask,
+     uint32_t *xor32_vertical_values );
+
+uint32_t libesedb_checksum_calculate_xor32_blocks_sse2(
+     const uint8_t *buffer,
+     size_t number_of_blocks );
+
+uint32_t libesedb_checksum_calculate_xor32_blocks_avx2(
+     const uint8_t *buffer,
+     size_t number_of_blocks );
+
+#endif /* defined( LIBESEDB_CHECKSUM_HAVE_X86_SIMD ) */
+
 int libesedb_checksum_calculate_little_endian_ecc32(
      uint32_t *ecc_checksum_value,
      uint32_t *xor_checksum_value,
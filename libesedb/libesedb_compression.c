@@ -28,8 +28,185 @@
 #include <libnotify.h>
 
 #include "libesedb_compression.h"
+#include "libesedb_huffman_table.h"
 #include "libesedb_libuna.h"
 
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_SIMD )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_SIMD )
+
+/* The 7-bit unpack kernels
+ */
+enum LIBESEDB_COMPRESSION_KERNELS
+{
+	LIBESEDB_COMPRESSION_KERNEL_UNDETERMINED	= -1,
+	LIBESEDB_COMPRESSION_KERNEL_SCALAR		= 0,
+	LIBESEDB_COMPRESSION_KERNEL_SSSE3		= 1,
+	LIBESEDB_COMPRESSION_KERNEL_BMI2		= 2
+};
+
+/* The 7-bit unpack kernel supported by the CPU
+ * The value is determined on first use, concurrent determination results in the same value
+ */
+static int libesedb_compression_kernel = LIBESEDB_COMPRESSION_KERNEL_UNDETERMINED;
+
+/* Determines the 7-bit unpack kernel supported by the CPU
+ * SSSE3 is preferred over BMI2 since it unpacks 14 bytes per iteration
+ * and PDEP is microcoded on AMD processors before Zen 3
+ * Returns the 7-bit unpack kernel
+ */
+int libesedb_compression_get_kernel(
+     void )
+{
+	int kernel = libesedb_compression_kernel;
+
+	if( kernel == LIBESEDB_COMPRESSION_KERNEL_UNDETERMINED )
+	{
+		kernel = LIBESEDB_COMPRESSION_KERNEL_SCALAR;
+
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "ssse3" ) != 0 )
+		{
+			kernel = LIBESEDB_COMPRESSION_KERNEL_SSSE3;
+		}
+#if defined( __x86_64__ )
+		else if( __builtin_cpu_supports( "bmi2" ) != 0 )
+		{
+			kernel = LIBESEDB_COMPRESSION_KERNEL_BMI2;
+		}
+#endif
+		libesedb_compression_kernel = kernel;
+	}
+	return( kernel );
+}
+
+/* Unpacks 7-bit packed data in blocks of 14 bytes using SSSE3
+ * Every block is unpacked into 16 bytes, the 16-byte loads require
+ * at least 2 bytes beyond the last block
+ * Returns the number of packed bytes that were unpacked, which is a multiple of 7
+ */
+__attribute__((target("ssse3")))
+size_t libesedb_compression_7bit_unpack_blocks_ssse3(
+        const uint8_t *packed_data,
+        size_t packed_data_size,
+        uint8_t *unpacked_data )
+{
+	__m128i packed_value     = _mm_setzero_si128();
+	__m128i low_value        = _mm_setzero_si128();
+	__m128i high_value       = _mm_setzero_si128();
+	__m128i low_shuffle      = _mm_setzero_si128();
+	__m128i high_shuffle     = _mm_setzero_si128();
+	__m128i shift_multiply   = _mm_setzero_si128();
+	__m128i character_mask   = _mm_setzero_si128();
+	size_t packed_data_index = 0;
+
+	/* Every 16-bit lane contains the 2 packed bytes that hold a character
+	 */
+	low_shuffle = _mm_setr_epi8(
+	               0, 1, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7 );
+
+	high_shuffle = _mm_setr_epi8(
+	                7, 8, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14 );
+
+	/* Character n starts at bit ( 7 * n ) % 8 of its first byte,
+	 * multiplying by 2^( 8 - shift ) moves the character to bits 8 to 14
+	 */
+	shift_multiply = _mm_setr_epi16(
+	                  256, 2, 4, 8, 16, 32, 64, 128 );
+
+	character_mask = _mm_set1_epi16(
+	                  0x007f );
+
+	while( ( packed_data_size - packed_data_index ) >= 16 )
+	{
+		packed_value = _mm_loadu_si128(
+		                (__m128i *) &( packed_data[ packed_data_index ] ) );
+
+		low_value = _mm_shuffle_epi8(
+		             packed_value,
+		             low_shuffle );
+
+		high_value = _mm_shuffle_epi8(
+		              packed_value,
+		              high_shuffle );
+
+		low_value = _mm_mullo_epi16(
+		             low_value,
+		             shift_multiply );
+
+		high_value = _mm_mullo_epi16(
+		              high_value,
+		              shift_multiply );
+
+		low_value = _mm_and_si128(
+		             _mm_srli_epi16(
+		              low_value,
+		              8 ),
+		             character_mask );
+
+		high_value = _mm_and_si128(
+		              _mm_srli_epi16(
+		               high_value,
+		               8 ),
+		              character_mask );
+
+		_mm_storeu_si128(
+		 (__m128i *) unpacked_data,
+		 _mm_packus_epi16(
+		  low_value,
+		  high_value ) );
+
+		packed_data_index += 14;
+		unpacked_data     += 16;
+	}
+	return( packed_data_index );
+}
+
+#if defined( __x86_64__ )
+
+/* Unpacks 7-bit packed data in blocks of 7 bytes using BMI2
+ * Every block is unpacked into 8 bytes, the 8-byte loads require
+ * at least 1 byte beyond the last block
+ * Returns the number of packed bytes that were unpacked, which is a multiple of 7
+ */
+__attribute__((target("bmi2")))
+size_t libesedb_compression_7bit_unpack_blocks_bmi2(
+        const uint8_t *packed_data,
+        size_t packed_data_size,
+        uint8_t *unpacked_data )
+{
+	size_t packed_data_index = 0;
+	uint64_t value_64bit     = 0;
+
+	while( ( packed_data_size - packed_data_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( packed_data[ packed_data_index ] ),
+		 value_64bit );
+
+		/* Deposit the 8 characters of 7 bits in the low bits of 8 bytes
+		 */
+		value_64bit = _pdep_u64(
+		               value_64bit,
+		               0x7f7f7f7f7f7f7f7fULL );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 unpacked_data,
+		 value_64bit );
+
+		packed_data_index += 7;
+		unpacked_data     += 8;
+	}
+	return( packed_data_index );
+}
+
+#endif /* defined( __x86_64__ ) */
+
+#endif /* defined( LIBESEDB_COMPRESSION_HAVE_X86_SIMD ) */
+
 /* Retrieves the size of the decompressed 7-bit compressed-data
  * Returns 1 on success or -1 on error
  */
@@ -102,6 +279,88 @@ int libesedb_compression_7bit_decompress_get_size(
 	return( 1 );
 }
 
+/* Unpacks 7-bit packed data
+ * The packed data should not contain the leading byte of the compressed-data
+ * The unpacked data should be large enough to contain ( packed data size * 8 ) / 7 bytes
+ * Returns the remaining bits of the last packed byte
+ */
+uint16_t libesedb_compression_7bit_unpack(
+          const uint8_t *packed_data,
+          size_t packed_data_size,
+          uint8_t *unpacked_data )
+{
+	size_t packed_data_index   = 0;
+	size_t unpacked_data_index = 0;
+	uint64_t value_64bit       = 0;
+	uint32_t value_32bit       = 0;
+	uint16_t value_16bit       = 0;
+	uint8_t bit_index          = 0;
+
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_SIMD )
+	int kernel                 = 0;
+
+	kernel = libesedb_compression_get_kernel();
+
+	if( kernel == LIBESEDB_COMPRESSION_KERNEL_SSSE3 )
+	{
+		packed_data_index = libesedb_compression_7bit_unpack_blocks_ssse3(
+		                     packed_data,
+		                     packed_data_size,
+		                     unpacked_data );
+	}
+#if defined( __x86_64__ )
+	else if( kernel == LIBESEDB_COMPRESSION_KERNEL_BMI2 )
+	{
+		packed_data_index = libesedb_compression_7bit_unpack_blocks_bmi2(
+		                     packed_data,
+		                     packed_data_size,
+		                     unpacked_data );
+	}
+#endif
+	unpacked_data_index = ( packed_data_index / 7 ) * 8;
+#endif
+	/* Every 7 packed bytes contain 8 characters of 7 bits
+	 * which are unpacked in a single 56-bit value
+	 */
+	while( ( packed_data_size - packed_data_index ) >= 7 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( packed_data[ packed_data_index ] ),
+		 value_32bit );
+
+		value_64bit   = packed_data[ packed_data_index + 6 ];
+		value_64bit <<= 8;
+		value_64bit  |= packed_data[ packed_data_index + 5 ];
+		value_64bit <<= 8;
+		value_64bit  |= packed_data[ packed_data_index + 4 ];
+		value_64bit <<= 32;
+		value_64bit  |= value_32bit;
+
+		unpacked_data[ unpacked_data_index     ] = (uint8_t) ( value_64bit & 0x7f );
+		unpacked_data[ unpacked_data_index + 1 ] = (uint8_t) ( ( value_64bit >> 7 ) & 0x7f );
+		unpacked_data[ unpacked_data_index + 2 ] = (uint8_t) ( ( value_64bit >> 14 ) & 0x7f );
+		unpacked_data[ unpacked_data_index + 3 ] = (uint8_t) ( ( value_64bit >> 21 ) & 0x7f );
+		unpacked_data[ unpacked_data_index + 4 ] = (uint8_t) ( ( value_64bit >> 28 ) & 0x7f );
+		unpacked_data[ unpacked_data_index + 5 ] = (uint8_t) ( ( value_64bit >> 35 ) & 0x7f );
+		unpacked_data[ unpacked_data_index + 6 ] = (uint8_t) ( ( value_64bit >> 42 ) & 0x7f );
+		unpacked_data[ unpacked_data_index + 7 ] = (uint8_t) ( ( value_64bit >> 49 ) & 0x7f );
+
+		packed_data_index   += 7;
+		unpacked_data_index += 8;
+	}
+	while( packed_data_index < packed_data_size )
+	{
+		value_16bit |= (uint16_t) packed_data[ packed_data_index++ ] << bit_index;
+
+		unpacked_data[ unpacked_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
+
+		value_16bit >>= 7;
+
+		bit_index++;
+	}
+	return( value_16bit );
+}
+
 /* Decompresses 7-bit compressed-data
  * Returns 1 on success or -1 on error
  */
@@ -112,11 +371,8 @@ int libesedb_compression_7bit_decompress(
      size_t uncompressed_data_size,
      liberror_error_t **error )
 {
-	static char *function          = "libesedb_compression_7bit_decompress";
-	size_t compressed_data_index   = 0;
-	size_t uncompressed_data_index = 0;
-	uint16_t value_16bit           = 0;
-	uint8_t bit_index              = 0;
+	static char *function = "libesedb_compression_7bit_decompress";
+	uint16_t value_16bit  = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -196,27 +452,11 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	for( compressed_data_index = 1;
-	     compressed_data_index < compressed_data_size;
-	     compressed_data_index++ )
-	{
-		value_16bit |= (uint16_t) compressed_data[ compressed_data_index ] << bit_index;
+	value_16bit = libesedb_compression_7bit_unpack(
+	               &( compressed_data[ 1 ] ),
+	               compressed_data_size - 1,
+	               uncompressed_data );
 
-		uncompressed_data[ uncompressed_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
-
-		value_16bit >>= 7;
-
-		bit_index++;
-
-		if( bit_index == 7 )
-		{
-			uncompressed_data[ uncompressed_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
-
-			value_16bit >>= 7;
-
-			bit_index = 0;
-		}
-	}
 	if( value_16bit != 0 )
 	{
 		liberror_error_set(
@@ -232,16 +472,35 @@ int libesedb_compression_7bit_decompress(
 	return( 1 );
 }
 
-/* Retrieves the size of the decompressed XPRESS compressed-data
+/* Copies 7-bit compressed-data to an UTF-8 string
+ * The compressed-data is unpacked and converted in blocks without intermediate allocations
+ * If the UTF-8 string is NULL only the UTF-8 string index is determined
+ * The UTF-8 string index contains the size of the UTF-8 string including the end-of-string character
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_xpress_decompress_get_size(
+int libesedb_compression_7bit_copy_to_utf8_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
      liberror_error_t **error )
 {
-	static char *function = "libesedb_compression_xpress_decompress_get_size";
+	uint8_t uncompressed_data[ ( LIBESEDB_COMPRESSION_7BIT_BLOCK_SIZE * 8 ) / 7 ];
+
+	uint8_t *block_data                 = NULL;
+	static char *function               = "libesedb_compression_7bit_copy_to_utf8_string";
+	size_t block_data_index             = 0;
+	size_t block_data_size              = 0;
+	size_t compressed_block_size        = 0;
+	size_t compressed_data_index        = 0;
+	size_t uncompressed_data_size       = 0;
+	uint16_t last_character             = 0;
+	uint16_t utf16_character            = 0;
+	uint16_t value_16bit                = 0;
+	uint8_t byte_order                  = 0;
+	uint8_t is_utf16_stream             = 0;
+	uint8_t utf8_character_size         = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -265,7 +524,7 @@ int libesedb_compression_xpress_decompress_get_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size < 3 )
+	if( compressed_data_size < 2 )
 	{
 		liberror_error_set(
 		 error,
@@ -276,18 +535,29 @@ int libesedb_compression_xpress_decompress_get_size(
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid UTF-8 string index.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] != 0x18 )
+	if( compressed_data[ 0 ] == 0x18 )
 	{
 		liberror_error_set(
 		 error,
@@ -299,33 +569,214 @@ int libesedb_compression_xpress_decompress_get_size(
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint16_little_endian(
-	 &( compressed_data[ 1 ] ),
-	 *uncompressed_data_size );
+	uncompressed_data_size = ( ( compressed_data_size - 1 ) * 8 ) / 7;
+
+	/* The uncompressed data contains an UTF-16 little-endian stream
+	 * if the size is even and the 0x10 flag is not set, otherwise ASCII characters
+	 */
+	if( ( ( uncompressed_data_size % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		is_utf16_stream = 1;
+	}
+	*utf8_string_index    = 0;
+	compressed_data_index = 1;
+
+	while( compressed_data_index < compressed_data_size )
+	{
+		compressed_block_size = compressed_data_size - compressed_data_index;
+
+		if( compressed_block_size > LIBESEDB_COMPRESSION_7BIT_BLOCK_SIZE )
+		{
+			compressed_block_size = LIBESEDB_COMPRESSION_7BIT_BLOCK_SIZE;
+		}
+		block_data_size = ( compressed_block_size * 8 ) / 7;
+
+		/* For ASCII characters only the last block is needed to determine the size
+		 */
+		if( ( is_utf16_stream == 0 )
+		 && ( utf8_string == NULL )
+		 && ( compressed_block_size < ( compressed_data_size - compressed_data_index ) ) )
+		{
+			*utf8_string_index    += block_data_size;
+			compressed_data_index += compressed_block_size;
+
+			continue;
+		}
+		if( ( is_utf16_stream == 0 )
+		 && ( utf8_string != NULL ) )
+		{
+			/* ASCII characters are unpacked directly into the UTF-8 string
+			 */
+			if( block_data_size > ( utf8_string_size - *utf8_string_index ) )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			block_data = &( utf8_string[ *utf8_string_index ] );
+		}
+		else
+		{
+			block_data = uncompressed_data;
+		}
+		value_16bit = libesedb_compression_7bit_unpack(
+		               &( compressed_data[ compressed_data_index ] ),
+		               compressed_block_size,
+		               block_data );
+
+		compressed_data_index += compressed_block_size;
+
+		if( is_utf16_stream == 0 )
+		{
+			*utf8_string_index += block_data_size;
+			last_character      = block_data[ block_data_size - 1 ];
+
+			continue;
+		}
+		/* The byte order of the UTF-16 stream is determined from the first character
+		 */
+		if( byte_order == 0 )
+		{
+			if( ( block_data[ 0 ] == 0 )
+			 && ( block_data[ 1 ] != 0 ) )
+			{
+				byte_order = LIBUNA_ENDIAN_BIG;
+			}
+			else
+			{
+				byte_order = LIBUNA_ENDIAN_LITTLE;
+			}
+		}
+		for( block_data_index = 0;
+		     block_data_index < block_data_size;
+		     block_data_index += 2 )
+		{
+			if( byte_order == LIBUNA_ENDIAN_BIG )
+			{
+				utf16_character = ( (uint16_t) block_data[ block_data_index ] << 8 )
+				                | block_data[ block_data_index + 1 ];
+			}
+			else
+			{
+				utf16_character = ( (uint16_t) block_data[ block_data_index + 1 ] << 8 )
+				                | block_data[ block_data_index ];
+			}
+			/* The 7-bit characters cannot form surrogates
+			 */
+			if( utf16_character < 0x0080 )
+			{
+				utf8_character_size = 1;
+			}
+			else if( utf16_character < 0x0800 )
+			{
+				utf8_character_size = 2;
+			}
+			else
+			{
+				utf8_character_size = 3;
+			}
+			if( utf8_string != NULL )
+			{
+				if( (size_t) utf8_character_size > ( utf8_string_size - *utf8_string_index ) )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-8 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( utf8_character_size == 1 )
+				{
+					utf8_string[ *utf8_string_index ] = (uint8_t) utf16_character;
+				}
+				else if( utf8_character_size == 2 )
+				{
+					utf8_string[ *utf8_string_index     ] = (uint8_t) ( 0xc0 | ( utf16_character >> 6 ) );
+					utf8_string[ *utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( utf16_character & 0x3f ) );
+				}
+				else
+				{
+					utf8_string[ *utf8_string_index     ] = (uint8_t) ( 0xe0 | ( utf16_character >> 12 ) );
+					utf8_string[ *utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( ( utf16_character >> 6 ) & 0x3f ) );
+					utf8_string[ *utf8_string_index + 2 ] = (uint8_t) ( 0x80 | ( utf16_character & 0x3f ) );
+				}
+			}
+			*utf8_string_index += utf8_character_size;
+		}
+		last_character = utf16_character;
+	}
+	if( value_16bit != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported remainder: 0x%02" PRIx16 ".",
+		 function,
+		 value_16bit );
 
+		return( -1 );
+	}
+	/* Add an end-of-string character if the uncompressed data is not terminated
+	 */
+	if( last_character != 0 )
+	{
+		if( utf8_string != NULL )
+		{
+			if( *utf8_string_index >= utf8_string_size )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ *utf8_string_index ] = 0;
+		}
+		*utf8_string_index += 1;
+	}
 	return( 1 );
 }
 
-/* Decompresses XPRESS compressed-data
+/* Copies 7-bit compressed-data to an UTF-16 string
+ * The compressed-data is unpacked and converted in blocks without intermediate allocations
+ * If the UTF-16 string is NULL only the UTF-16 string index is determined
+ * The UTF-16 string index contains the size of the UTF-16 string including the end-of-string character
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_xpress_decompress(
+int libesedb_compression_7bit_copy_to_utf16_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
      liberror_error_t **error )
 {
-	static char *function                  = "libesedb_compression_xpress_decompress";
-	size_t compressed_data_iterator        = 0;
-	size_t compression_iterator            = 0;
-	size_t compression_shared_byte_index   = 0;
-	size_t uncompressed_data_iterator      = 0;
-	uint32_t compression_indicator         = 0;
-	uint32_t compression_indicator_bitmask = 0;
-	int16_t compression_offset             = 0;
-	uint16_t compression_size              = 0;
-	uint16_t compression_tuple             = 0;
+	uint8_t uncompressed_data[ ( LIBESEDB_COMPRESSION_7BIT_BLOCK_SIZE * 8 ) / 7 ];
+
+	static char *function               = "libesedb_compression_7bit_copy_to_utf16_string";
+	size_t block_data_index             = 0;
+	size_t block_data_size              = 0;
+	size_t compressed_block_size        = 0;
+	size_t compressed_data_index        = 0;
+	size_t number_of_characters         = 0;
+	size_t uncompressed_data_size       = 0;
+	uint16_t last_character             = 0;
+	uint16_t value_16bit                = 0;
+	uint8_t byte_order                  = 0;
+	uint8_t is_utf16_stream             = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -349,7 +800,7 @@ int libesedb_compression_xpress_decompress(
 
 		return( -1 );
 	}
-	if( compressed_data_size < 3 )
+	if( compressed_data_size < 2 )
 	{
 		liberror_error_set(
 		 error,
@@ -360,29 +811,29 @@ int libesedb_compression_xpress_decompress(
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( utf16_string_size > (size_t) SSIZE_MAX )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( utf16_string_index == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] != 0x18 )
+	if( compressed_data[ 0 ] == 0x18 )
 	{
 		liberror_error_set(
 		 error,
@@ -394,199 +845,1038 @@ int libesedb_compression_xpress_decompress(
 
 		return( -1 );
 	}
-	compressed_data_iterator = 3;
+	uncompressed_data_size = ( ( compressed_data_size - 1 ) * 8 ) / 7;
 
-	while( compressed_data_iterator < compressed_data_size )
+	/* The uncompressed data contains an UTF-16 little-endian stream
+	 * if the size is even and the 0x10 flag is not set, otherwise ASCII characters
+	 */
+	if( ( ( uncompressed_data_size % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		is_utf16_stream = 1;
+	}
+	*utf16_string_index   = 0;
+	compressed_data_index = 1;
+
+	while( compressed_data_index < compressed_data_size )
 	{
-                byte_stream_copy_to_uint32_little_endian(
-                 &( compressed_data[ compressed_data_iterator ] ),
-                 compression_indicator );
+		compressed_block_size = compressed_data_size - compressed_data_index;
 
-		compressed_data_iterator += 4;
+		if( compressed_block_size > LIBESEDB_COMPRESSION_7BIT_BLOCK_SIZE )
+		{
+			compressed_block_size = LIBESEDB_COMPRESSION_7BIT_BLOCK_SIZE;
+		}
+		block_data_size = ( compressed_block_size * 8 ) / 7;
+
+		if( is_utf16_stream == 0 )
+		{
+			number_of_characters = block_data_size;
+		}
+		else
+		{
+			number_of_characters = block_data_size / 2;
+		}
+		/* Since every character maps onto a single UTF-16 character
+		 * only the last block is needed to determine the size
+		 */
+		if( ( utf16_string == NULL )
+		 && ( compressed_block_size < ( compressed_data_size - compressed_data_index ) ) )
+		{
+			*utf16_string_index   += number_of_characters;
+			compressed_data_index += compressed_block_size;
+
+			continue;
+		}
+		value_16bit = libesedb_compression_7bit_unpack(
+		               &( compressed_data[ compressed_data_index ] ),
+		               compressed_block_size,
+		               uncompressed_data );
+
+		compressed_data_index += compressed_block_size;
 
-		for( compression_indicator_bitmask = 0x80000000UL;
-		     compression_indicator_bitmask > 0;
-		     compression_indicator_bitmask >>= 1 )
+		/* The byte order of the UTF-16 stream is determined from the first character
+		 */
+		if( ( is_utf16_stream != 0 )
+		 && ( byte_order == 0 ) )
 		{
-			if( compressed_data_iterator >= compressed_data_size )
+			if( ( uncompressed_data[ 0 ] == 0 )
+			 && ( uncompressed_data[ 1 ] != 0 ) )
 			{
-				break;
+				byte_order = LIBUNA_ENDIAN_BIG;
 			}
-			/* If the indicator bit is 0 the data is uncompressed
-			 * or 1 if the data is compressed
-			 */
-			if( ( compression_indicator & compression_indicator_bitmask ) != 0 )
+			else
+			{
+				byte_order = LIBUNA_ENDIAN_LITTLE;
+			}
+		}
+		if( utf16_string != NULL )
+		{
+			if( number_of_characters > ( utf16_string_size - *utf16_string_index ) )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( is_utf16_stream == 0 )
 			{
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+				for( block_data_index = 0;
+				     block_data_index < block_data_size;
+				     block_data_index++ )
 				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data too small.",
-					 function );
-
-					return( -1 );
+					utf16_string[ *utf16_string_index + block_data_index ] = uncompressed_data[ block_data_index ];
 				}
-		                byte_stream_copy_to_uint16_little_endian(
-		                 &( compressed_data[ compressed_data_iterator ] ),
-		                 compression_tuple );
-
-				compressed_data_iterator += 2;
-
-				/* The compression tuple contains:
-				 * 0 - 2	the size
-				 * 3 - 15	the offset - 1
-				 */
-				compression_size   = ( compression_tuple & 0x0007 );
-				compression_offset = ( compression_tuple >> 3 ) + 1;
-
-				/* Check for a first level extended size
-				 * stored in the 4-bits of a shared extended compression size byte
-				 * the size is added to the previous size
-				 */
-				if( compression_size == 0x07 )
+			}
+			else if( byte_order == LIBUNA_ENDIAN_BIG )
+			{
+				for( block_data_index = 0;
+				     block_data_index < block_data_size;
+				     block_data_index += 2 )
 				{
-					if( compression_shared_byte_index == 0 )
-					{
-						if( compressed_data_iterator >= compressed_data_size )
-						{
-							liberror_error_set(
-							 error,
-							 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-							 "%s: compressed data too small.",
-							 function );
-
-							return( -1 );
-						}
-						compression_size += compressed_data[ compressed_data_iterator ] & 0x0f;
-
-						compression_shared_byte_index = compressed_data_iterator++;
-					}
-					else
-					{
-						compression_size += compressed_data[ compression_shared_byte_index ] >> 4;
-
-						compression_shared_byte_index = 0;
-					}
+					utf16_string[ *utf16_string_index + ( block_data_index / 2 ) ] = ( (uint16_t) uncompressed_data[ block_data_index ] << 8 )
+					                                                               | uncompressed_data[ block_data_index + 1 ];
 				}
-				/* Check for a second level extended size
-				 * stored in the 8-bits of the next byte
-				 * the size is added to the previous size
-				 */
-				if( compression_size == ( 0x07 + 0x0f ) )
+			}
+			else
+			{
+				for( block_data_index = 0;
+				     block_data_index < block_data_size;
+				     block_data_index += 2 )
 				{
-					if( compressed_data_iterator >= compressed_data_size )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: compressed data too small.",
+					utf16_string[ *utf16_string_index + ( block_data_index / 2 ) ] = ( (uint16_t) uncompressed_data[ block_data_index + 1 ] << 8 )
+					                                                               | uncompressed_data[ block_data_index ];
+				}
+			}
+		}
+		*utf16_string_index += number_of_characters;
+
+		if( is_utf16_stream == 0 )
+		{
+			last_character = uncompressed_data[ block_data_size - 1 ];
+		}
+		else
+		{
+			last_character = uncompressed_data[ block_data_size - 2 ]
+			               | uncompressed_data[ block_data_size - 1 ];
+		}
+	}
+	if( value_16bit != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported remainder: 0x%02" PRIx16 ".",
+		 function,
+		 value_16bit );
+
+		return( -1 );
+	}
+	/* Add an end-of-string character if the uncompressed data is not terminated
+	 */
+	if( last_character != 0 )
+	{
+		if( utf16_string != NULL )
+		{
+			if( *utf16_string_index >= utf16_string_size )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf16_string[ *utf16_string_index ] = 0;
+		}
+		*utf16_string_index += 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the decompressed XPRESS compressed-data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_xpress_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_compression_xpress_decompress_get_size";
+
+	if( compressed_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 3 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] != 0x18 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( compressed_data[ 1 ] ),
+	 *uncompressed_data_size );
+
+	return( 1 );
+}
+
+/* Decompresses XPRESS compressed-data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_xpress_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     liberror_error_t **error )
+{
+	uint8_t *match_destination              = NULL;
+	const uint8_t *match_source             = NULL;
+	static char *function                   = "libesedb_compression_xpress_decompress";
+	size_t compressed_data_iterator         = 0;
+	size_t compression_offset               = 0;
+	size_t compression_shared_byte_index    = 0;
+	size_t compression_size                 = 0;
+	size_t literal_size                     = 0;
+	size_t match_data_index                 = 0;
+	size_t uncompressed_data_iterator       = 0;
+	uint32_t compression_indicator          = 0;
+	uint16_t compression_tuple              = 0;
+	uint8_t compression_indicator_bit_index = 0;
+
+	if( compressed_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 3 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] != 0x18 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	compressed_data_iterator = 3;
+
+	while( compressed_data_iterator < compressed_data_size )
+	{
+		/* An incomplete compression indicator contains no data
+		 */
+		if( ( compressed_data_size - compressed_data_iterator ) < 4 )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_iterator ] ),
+		 compression_indicator );
+
+		compressed_data_iterator += 4;
+
+		/* The compression indicator is processed from the most significant bit
+		 * and shifted left after every bit
+		 */
+		compression_indicator_bit_index = 32;
+
+		while( ( compression_indicator_bit_index > 0 )
+		    && ( compressed_data_iterator < compressed_data_size ) )
+		{
+			/* If the indicator bit is 0 the data is uncompressed
+			 * or 1 if the data is compressed
+			 * Runs of uncompressed data are copied at once
+			 */
+			if( ( compression_indicator & 0x80000000UL ) == 0 )
+			{
+				literal_size = 1;
+
+				if( ( compression_indicator & 0xff000000UL ) == 0 )
+				{
+					literal_size = 8;
+
+					if( ( compression_indicator & 0xffff0000UL ) == 0 )
+					{
+						literal_size = 16;
+					}
+				}
+				if( literal_size > compression_indicator_bit_index )
+				{
+					literal_size = compression_indicator_bit_index;
+				}
+				/* The compressed data can end in the middle of a compression indicator
+				 */
+				if( literal_size > ( compressed_data_size - compressed_data_iterator ) )
+				{
+					literal_size = compressed_data_size - compressed_data_iterator;
+				}
+				if( literal_size > ( uncompressed_data_size - uncompressed_data_iterator ) )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( literal_size == 1 )
+				{
+					uncompressed_data[ uncompressed_data_iterator ] = compressed_data[ compressed_data_iterator ];
+				}
+				else if( memory_copy(
+				          &( uncompressed_data[ uncompressed_data_iterator ] ),
+				          &( compressed_data[ compressed_data_iterator ] ),
+				          literal_size ) == NULL )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_MEMORY,
+					 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy uncompressed data.",
+					 function );
+
+					return( -1 );
+				}
+				compressed_data_iterator   += literal_size;
+				uncompressed_data_iterator += literal_size;
+
+				compression_indicator          <<= literal_size;
+				compression_indicator_bit_index -= (uint8_t) literal_size;
+
+				continue;
+			}
+			if( ( compressed_data_size - compressed_data_iterator ) < 2 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( compressed_data[ compressed_data_iterator ] ),
+			 compression_tuple );
+
+			compressed_data_iterator += 2;
+
+			/* The compression tuple contains:
+			 * 0 - 2	the size
+			 * 3 - 15	the offset - 1
+			 */
+			compression_size   = (size_t) ( compression_tuple & 0x0007 );
+			compression_offset = (size_t) ( compression_tuple >> 3 ) + 1;
+
+			/* Check for a first level extended size
+			 * stored in the 4-bits of a shared extended compression size byte
+			 * the size is added to the previous size
+			 */
+			if( compression_size == 0x07 )
+			{
+				if( compression_shared_byte_index == 0 )
+				{
+					if( compressed_data_iterator >= compressed_data_size )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data too small.",
 						 function );
 
-						return( -1 );
-					}
-					compression_size += compressed_data[ compressed_data_iterator++ ];
+						return( -1 );
+					}
+					compression_size += compressed_data[ compressed_data_iterator ] & 0x0f;
+
+					compression_shared_byte_index = compressed_data_iterator++;
+				}
+				else
+				{
+					compression_size += compressed_data[ compression_shared_byte_index ] >> 4;
+
+					compression_shared_byte_index = 0;
+				}
+			}
+			/* Check for a second level extended size
+			 * stored in the 8-bits of the next byte
+			 * the size is added to the previous size
+			 */
+			if( compression_size == ( 0x07 + 0x0f ) )
+			{
+				if( compressed_data_iterator >= compressed_data_size )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				compression_size += compressed_data[ compressed_data_iterator++ ];
+			}
+			/* Check for a third level extended size
+			 * stored in the 16-bits of the next two bytes
+			 * the previous size is ignored
+			 */
+			if( compression_size == ( 0x07 + 0x0f + 0xff ) )
+			{
+				if( ( compressed_data_size - compressed_data_iterator ) < 2 )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ compressed_data_iterator ] ),
+				 compression_size );
+
+				compressed_data_iterator += 2;
+			}
+			/* The size value is stored as
+			 * size - 3
+			 */
+			compression_size += 3;
+
+			if( compression_size > 32771 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
+				 "%s: compression size value out of range.",
+				 function );
+
+				return( -1 );
+			}
+			if( compression_offset > uncompressed_data_iterator )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
+				 "%s: compression offset: %" PRIzd " out of range: %" PRIzd ".",
+				 function,
+				 compression_offset,
+				 uncompressed_data_iterator );
+
+				return( -1 );
+			}
+			if( compression_size > ( uncompressed_data_size - uncompressed_data_iterator ) )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: uncompressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			/* The bounds have been checked for the entire match so the copy loops do not
+			 */
+			match_source      = &( uncompressed_data[ uncompressed_data_iterator - compression_offset ] );
+			match_destination = &( uncompressed_data[ uncompressed_data_iterator ] );
+
+			if( ( compression_offset >= 8 )
+			 && ( ( compression_size + 7 ) <= ( uncompressed_data_size - uncompressed_data_iterator ) ) )
+			{
+				/* Copy 8 bytes at a time, the source never overlaps the bytes written
+				 * by the same copy and the bytes copied past the end of the match
+				 * are overwritten by the data that follows
+				 */
+				for( match_data_index = 0;
+				     match_data_index < compression_size;
+				     match_data_index += 8 )
+				{
+					memory_copy(
+					 &( match_destination[ match_data_index ] ),
+					 &( match_source[ match_data_index ] ),
+					 8 );
+				}
+			}
+			else if( compression_offset == 1 )
+			{
+				memory_set(
+				 match_destination,
+				 match_source[ 0 ],
+				 compression_size );
+			}
+			else
+			{
+				for( match_data_index = 0;
+				     match_data_index < compression_size;
+				     match_data_index++ )
+				{
+					match_destination[ match_data_index ] = match_source[ match_data_index ];
+				}
+			}
+			uncompressed_data_iterator += compression_size;
+
+			compression_indicator          <<= 1;
+			compression_indicator_bit_index -= 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the uncompressed data size of byte-index compressed-data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_byte_index_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     liberror_error_t **error )
+{
+	static char *function                  = "libesedb_compression_byte_index_decompress_get_size";
+	uint16_t stored_uncompressed_data_size = 0;
+
+	if( compressed_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 2 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first 2 bytes contain the uncompressed data size
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 compressed_data,
+	 stored_uncompressed_data_size );
+
+	*uncompressed_data_size = (size_t) stored_uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Decompresses byte-index compressed-data
+ *
+ * The byte-index compressed-data is used by Windows Search and consists of:
+ * a 16-bit little-endian uncompressed data size
+ * a table of 256 bytes with the 4-bit code sizes of the 512 Huffman symbols
+ * where the lower nibble contains the code size of the even symbol
+ * the Huffman encoded bit stream stored as 16-bit little-endian values
+ *
+ * Symbols 0 - 255 are literal bytes, symbols 256 - 511 are matches where
+ * bits 0 - 3 contain the match size - 3 and bits 4 - 7 the number of match offset bits.
+ * Additional match size bytes are stored in the byte stream directly after
+ * the 16-bit values that were read at the time, hence the bit stream is read
+ * ahead in batches of 16-bit values and read back when match size bytes are read.
+ *
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_byte_index_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     liberror_error_t **error )
+{
+	libesedb_huffman_table_t huffman_table;
+	uint8_t code_sizes[ 512 ];
+
+	const uint8_t *match_source             = NULL;
+	uint8_t *match_destination              = NULL;
+	static char *function                   = "libesedb_compression_byte_index_decompress";
+	size_t compressed_data_offset           = 0;
+	size_t match_offset                     = 0;
+	size_t match_size                       = 0;
+	size_t number_of_read_values            = 0;
+	size_t number_of_stored_values          = 0;
+	size_t uncompressed_data_offset         = 0;
+	size_t symbol_bit_offset                = 0;
+	uint64_t bit_buffer                     = 0;
+	uint16_t stored_uncompressed_data_size  = 0;
+	uint16_t symbol                         = 0;
+	uint16_t table_entry                    = 0;
+	uint8_t code_size                       = 0;
+	uint8_t number_of_bits                  = 0;
+	uint8_t number_of_offset_bits           = 0;
+	int symbol_index                        = 0;
+
+	if( compressed_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bit stream starts with 2 16-bit values
+	 */
+	if( compressed_data_size < ( 2 + 256 + 4 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 compressed_data,
+	 stored_uncompressed_data_size );
+
+	if( uncompressed_data_size < (size_t) stored_uncompressed_data_size )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol_index = 0;
+	     symbol_index < 256;
+	     symbol_index++ )
+	{
+		code_sizes[ 2 * symbol_index ]         = compressed_data[ 2 + symbol_index ] & 0x0f;
+		code_sizes[ ( 2 * symbol_index ) + 1 ] = compressed_data[ 2 + symbol_index ] >> 4;
+	}
+	/* The Huffman table is built on the stack to prevent an allocation per value
+	 */
+	if( libesedb_huffman_table_build(
+	     &huffman_table,
+	     code_sizes,
+	     512,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset = 2 + 256;
+
+	while( uncompressed_data_offset < (size_t) stored_uncompressed_data_size )
+	{
+		/* Fill the bit buffer with as many 16-bit values as fit
+		 * the most significant bit of the bit buffer is the next bit in the stream
+		 */
+		while( ( number_of_bits <= 48 )
+		    && ( ( compressed_data_offset + 1 ) < compressed_data_size ) )
+		{
+			bit_buffer |= (uint64_t) ( ( (uint16_t) compressed_data[ compressed_data_offset + 1 ] << 8 )
+			            | compressed_data[ compressed_data_offset ] ) << ( 48 - number_of_bits );
+
+			compressed_data_offset += 2;
+			number_of_bits         += 16;
+			number_of_read_values  += 1;
+		}
+		table_entry = huffman_table.primary_table[ bit_buffer >> ( 64 - LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS ) ];
+
+		if( ( table_entry & LIBESEDB_HUFFMAN_TABLE_ENTRY_FLAG_SECONDARY ) != 0 )
+		{
+			table_entry = huffman_table.secondary_tables[
+			               ( ( table_entry & ~LIBESEDB_HUFFMAN_TABLE_ENTRY_FLAG_SECONDARY ) << LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS )
+			             | (uint16_t) ( ( bit_buffer >> ( 64 - LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE ) ) & ( ( 1 << LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS ) - 1 ) ) ];
+		}
+		code_size = (uint8_t) ( table_entry & 0x0f );
+
+		if( code_size == 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code at compressed data offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			return( -1 );
+		}
+		if( code_size > number_of_bits )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		bit_buffer    <<= code_size;
+		number_of_bits -= code_size;
+
+		symbol = table_entry >> 4;
+
+		if( symbol < 256 )
+		{
+			uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		/* The bit offset of the stream after the symbol code
+		 */
+		symbol_bit_offset = ( number_of_read_values * 16 ) - number_of_bits;
+
+		match_size            = symbol & 0x0f;
+		number_of_offset_bits = (uint8_t) ( ( symbol >> 4 ) & 0x0f );
+
+		if( number_of_offset_bits > number_of_bits )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		match_offset = (size_t) 1 << number_of_offset_bits;
+
+		if( number_of_offset_bits > 0 )
+		{
+			match_offset |= (size_t) ( bit_buffer >> ( 64 - number_of_offset_bits ) );
+
+			bit_buffer    <<= number_of_offset_bits;
+			number_of_bits -= number_of_offset_bits;
+		}
+		if( match_size == 0x0f )
+		{
+			/* The match size bytes follow the 16-bit values that contain the symbol code,
+			 * which are the 16-bit values needed for 16 bits after the code and at least 2
+			 */
+			number_of_stored_values = ( ( symbol_bit_offset + 15 ) / 16 ) + 1;
+
+			if( number_of_stored_values < 2 )
+			{
+				number_of_stored_values = 2;
+			}
+			if( number_of_read_values > number_of_stored_values )
+			{
+				/* Put back the 16-bit values that were read ahead
+				 */
+				compressed_data_offset -= 2 * ( number_of_read_values - number_of_stored_values );
+				number_of_bits         -= (uint8_t) ( 16 * ( number_of_read_values - number_of_stored_values ) );
+				number_of_read_values   = number_of_stored_values;
+
+				if( number_of_bits == 0 )
+				{
+					bit_buffer = 0;
 				}
-				/* Check for a third level extended size
-				 * stored in the 16-bits of the next two bytes
-				 * the previous size is ignored
-				 */
-				if( compression_size == ( 0x07 + 0x0f + 0xff ) )
+				else
 				{
-					if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: compressed data too small.",
-						 function );
-
-						return( -1 );
-					}
-			                byte_stream_copy_to_uint16_little_endian(
-			                 &( compressed_data[ compressed_data_iterator ] ),
-			                 compression_size );
-		
-					compressed_data_iterator += 2;
+					bit_buffer &= ~( (uint64_t) 0xffffffffffffffffULL >> number_of_bits );
 				}
-				/* The size value is stored as
-				 * size - 3
-				 */
-				compression_size += 3;
-
-				if( compression_size > 32771 )
+			}
+			while( number_of_read_values < number_of_stored_values )
+			{
+				if( ( compressed_data_offset + 1 ) >= compressed_data_size )
 				{
 					liberror_error_set(
 					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
-					 "%s: compression size value out of range.",
+					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data size value too small.",
 					 function );
 
 					return( -1 );
 				}
-				compression_iterator = uncompressed_data_iterator - compression_offset;
-
-				while( compression_size > 0 )
-				{
-					if( compression_iterator > uncompressed_data_iterator )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "compression iterator: %" PRIzd " out of range: %" PRIzd ".",
-						 function,
-						 compression_iterator,
-						 uncompressed_data_iterator );
+				bit_buffer |= (uint64_t) ( ( (uint16_t) compressed_data[ compressed_data_offset + 1 ] << 8 )
+				            | compressed_data[ compressed_data_offset ] ) << ( 48 - number_of_bits );
 
-						return( -1 );
-					}
-					if( uncompressed_data_iterator > uncompressed_data_size )
-					{
-						liberror_error_set(
-						 error,
-						 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: uncompressed data too small.",
-						 function );
-
-						return( -1 );
-					}
-					uncompressed_data[ uncompressed_data_iterator++ ] = uncompressed_data[ compression_iterator++ ];
-
-					compression_size--;
-				}
+				compressed_data_offset += 2;
+				number_of_bits         += 16;
+				number_of_read_values  += 1;
 			}
-			else
+			if( compressed_data_offset >= compressed_data_size )
 			{
-				if( compressed_data_iterator >= compressed_data_size )
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			match_size += compressed_data[ compressed_data_offset++ ];
+
+			if( match_size == ( 0x0f + 0xff ) )
+			{
+				if( ( compressed_data_offset + 1 ) >= compressed_data_size )
 				{
 					liberror_error_set(
 					 error,
 					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data too small.",
+					 "%s: compressed data size value too small.",
 					 function );
 
 					return( -1 );
 				}
-				if( uncompressed_data_iterator > uncompressed_data_size )
+				match_size = ( (size_t) compressed_data[ compressed_data_offset + 1 ] << 8 )
+				           | compressed_data[ compressed_data_offset ];
+
+				compressed_data_offset += 2;
+
+				if( match_size < ( 0x0f + 0xff ) )
 				{
 					liberror_error_set(
 					 error,
-					 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: uncompressed data too small.",
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: match size value out of bounds.",
 					 function );
 
 					return( -1 );
 				}
-				uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ compressed_data_iterator++ ];
+			}
+		}
+		match_size += 3;
+
+		if( match_offset > uncompressed_data_offset )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: match offset value exceeds uncompressed data offset.",
+			 function );
+
+			return( -1 );
+		}
+		if( match_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: uncompressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		match_destination = &( uncompressed_data[ uncompressed_data_offset ] );
+		match_source      = match_destination - match_offset;
+
+		uncompressed_data_offset += match_size;
+
+		if( match_offset >= match_size )
+		{
+			if( memory_copy(
+			     match_destination,
+			     match_source,
+			     match_size ) == NULL )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_MEMORY,
+				 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy match.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			while( match_size > 0 )
+			{
+				*match_destination++ = *match_source++;
+
+				match_size--;
 			}
 		}
 	}
@@ -793,23 +2083,34 @@ int libesedb_compression_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	/* 7-bit compressed-data is unpacked and converted directly
+	 */
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_copy_to_utf8_string(
+		     compressed_data,
+		     compressed_data_size,
+		     NULL,
+		     0,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of 7-bit compressed-data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -834,25 +2135,12 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -865,9 +2153,7 @@ int libesedb_compression_get_utf8_string_size(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf8_string_size_from_utf16_stream(
 			  uncompressed_data,
@@ -946,6 +2232,7 @@ int libesedb_compression_copy_to_utf8_string(
 	uint8_t *uncompressed_data    = NULL;
 	static char *function         = "libesedb_compression_copy_to_utf8_string";
 	size_t uncompressed_data_size = 0;
+	size_t utf8_string_index      = 0;
 	int result                    = 0;
 
 	if( compressed_data == NULL )
@@ -981,23 +2268,34 @@ int libesedb_compression_copy_to_utf8_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	/* 7-bit compressed-data is unpacked and converted directly
+	 */
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_copy_to_utf8_string(
+		     compressed_data,
+		     compressed_data_size,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 7-bit compressed-data to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -1022,25 +2320,12 @@ int libesedb_compression_copy_to_utf8_string(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -1053,9 +2338,7 @@ int libesedb_compression_copy_to_utf8_string(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf8_string_copy_from_utf16_stream(
 			  utf8_string,
@@ -1170,23 +2453,34 @@ int libesedb_compression_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	/* 7-bit compressed-data is unpacked and converted directly
+	 */
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_copy_to_utf16_string(
+		     compressed_data,
+		     compressed_data_size,
+		     NULL,
+		     0,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of 7-bit compressed-data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -1211,25 +2505,12 @@ int libesedb_compression_get_utf16_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -1242,9 +2523,7 @@ int libesedb_compression_get_utf16_string_size(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf16_string_size_from_utf16_stream(
 			  uncompressed_data,
@@ -1323,6 +2602,7 @@ int libesedb_compression_copy_to_utf16_string(
 	uint8_t *uncompressed_data    = NULL;
 	static char *function         = "libesedb_compression_copy_to_utf16_string";
 	size_t uncompressed_data_size = 0;
+	size_t utf16_string_index     = 0;
 	int result                    = 0;
 
 	if( compressed_data == NULL )
@@ -1358,23 +2638,34 @@ int libesedb_compression_copy_to_utf16_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	/* 7-bit compressed-data is unpacked and converted directly
+	 */
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_copy_to_utf16_string(
+		     compressed_data,
+		     compressed_data_size,
+		     utf16_string,
+		     utf16_string_size,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 7-bit compressed-data to UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -1399,25 +2690,12 @@ int libesedb_compression_copy_to_utf16_string(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libesedb_compression_xpress_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -1430,9 +2708,7 @@ int libesedb_compression_copy_to_utf16_string(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf16_string_copy_from_utf16_stream(
 			  utf16_string,
@@ -27,16 +27,58 @@
 
 #include <liberror.h>
 
+#include "libesedb_extern.h"
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The number of 7-bit compressed-data bytes that is unpacked at a time
+ * This must be a multiple of 7
+ */
+#define LIBESEDB_COMPRESSION_7BIT_BLOCK_SIZE	448
+
+/* The SIMD 7-bit unpack kernels are available on x86 and x86-64 when the compiler
+ * supports function specific target options and runtime CPU detection
+ */
+#if ( defined( __i386__ ) || defined( __x86_64__ ) ) \
+ && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) ) ) \
+ && !defined( LIBESEDB_DISABLE_SIMD )
+#define LIBESEDB_COMPRESSION_HAVE_X86_SIMD
+#endif
+
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_SIMD )
+
+int libesedb_compression_get_kernel(
+     void );
+
+size_t libesedb_compression_7bit_unpack_blocks_ssse3(
+        const uint8_t *packed_data,
+        size_t packed_data_size,
+        uint8_t *unpacked_data );
+
+#if defined( __x86_64__ )
+
+size_t libesedb_compression_7bit_unpack_blocks_bmi2(
+        const uint8_t *packed_data,
+        size_t packed_data_size,
+        uint8_t *unpacked_data );
+
+#endif /* defined( __x86_64__ ) */
+
+#endif /* defined( LIBESEDB_COMPRESSION_HAVE_X86_SIMD ) */
+
 int libesedb_compression_7bit_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *uncompressed_data_size,
      liberror_error_t **error );
 
+uint16_t libesedb_compression_7bit_unpack(
+          const uint8_t *packed_data,
+          size_t packed_data_size,
+          uint8_t *unpacked_data );
+
 int libesedb_compression_7bit_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -44,6 +86,22 @@ int libesedb_compression_7bit_decompress(
      size_t uncompressed_data_size,
      liberror_error_t **error );
 
+int libesedb_compression_7bit_copy_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     liberror_error_t **error );
+
+int libesedb_compression_7bit_copy_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     liberror_error_t **error );
+
 int libesedb_compression_xpress_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -57,6 +115,21 @@ int libesedb_compression_xpress_decompress(
      size_t uncompressed_data_size,
      liberror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_compression_byte_index_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_compression_byte_index_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     liberror_error_t **error );
+
 int libesedb_compression_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
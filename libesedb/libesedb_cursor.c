@@ -0,0 +1,1228 @@
+/*
+ * Cursor functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_cursor.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+#include "libesedb_values_tree.h"
+#include "libesedb_values_tree_value.h"
+
+/* Creates a cursor
+ * The cursor is positioned before the first value of the page tree
+ * that starts at the father data page (FDP)
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_initialize(
+     libesedb_cursor_t **cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
+     libfdata_tree_t *table_values_tree,
+     libfcache_cache_t *table_values_cache,
+     libfdata_tree_t *long_values_tree,
+     libfcache_cache_t *long_values_cache,
+     uint32_t object_identifier,
+     uint32_t father_data_page_number,
+     uint8_t type,
+     liberror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_initialize";
+
+	if( cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( father_data_page_number == 0 )
+	 || ( father_data_page_number > io_handle->last_page_number ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid father data page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type != LIBESEDB_CURSOR_TYPE_INDEX )
+	 && ( type != LIBESEDB_CURSOR_TYPE_TABLE ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cursor type: 0x%02" PRIx8 ".",
+		 function,
+		 type );
+
+		return( -1 );
+	}
+	internal_cursor = memory_allocate_structure(
+	                   libesedb_internal_cursor_t );
+
+	if( internal_cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cursor,
+	     0,
+	     sizeof( libesedb_internal_cursor_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cursor.",
+		 function );
+
+		memory_free(
+		 internal_cursor );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_initialize(
+	     &( internal_cursor->page_tree ),
+	     io_handle,
+	     pages_cache,
+	     object_identifier,
+	     table_definition,
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_values_tree_value_initialize(
+	     &( internal_cursor->values_tree_value ),
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values tree value.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor->file_io_handle            = file_io_handle;
+	internal_cursor->io_handle                 = io_handle;
+	internal_cursor->table_definition          = table_definition;
+	internal_cursor->template_table_definition = template_table_definition;
+	internal_cursor->pages_cache               = pages_cache;
+	internal_cursor->long_values_pages_cache   = long_values_pages_cache;
+	internal_cursor->table_values_tree         = table_values_tree;
+	internal_cursor->table_values_cache        = table_values_cache;
+	internal_cursor->long_values_tree          = long_values_tree;
+	internal_cursor->long_values_cache         = long_values_cache;
+	internal_cursor->father_data_page_number   = father_data_page_number;
+	internal_cursor->type                      = type;
+
+	*cursor = (libesedb_cursor_t *) internal_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_cursor != NULL )
+	{
+		if( internal_cursor->page_tree != NULL )
+		{
+			libesedb_page_tree_free(
+			 &( internal_cursor->page_tree ),
+			 NULL );
+		}
+		memory_free(
+		 internal_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_free(
+     libesedb_cursor_t **cursor,
+     liberror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_free";
+	int result                                  = 1;
+
+	if( cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		internal_cursor = (libesedb_internal_cursor_t *) *cursor;
+		*cursor         = NULL;
+
+		/* The file_io_handle, io_handle, table_definition, template_table_definition,
+		 * pages_cache, long_values_pages_cache, table_values_tree, table_values_cache,
+		 * long_values_tree and long_values_cache
+		 * references are freed elsewhere
+		 */
+		if( libesedb_values_tree_value_free(
+		     &( internal_cursor->values_tree_value ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free values tree value.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_page_tree_free(
+		     &( internal_cursor->page_tree ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_cursor->column_identifiers != NULL )
+		{
+			memory_free(
+			 internal_cursor->column_identifiers );
+		}
+		memory_free(
+		 internal_cursor );
+	}
+	return( result );
+}
+
+/* Retrieves a specific page
+ * The page must be released with libesedb_page_cache_release_page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_page(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_cursor_get_page";
+	off64_t page_offset   = 0;
+
+	if( internal_cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > internal_cursor->io_handle->last_page_number ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	page_offset  = page_number - 1;
+	page_offset *= internal_cursor->io_handle->page_size;
+
+	if( libesedb_page_cache_get_page(
+	     internal_cursor->pages_cache,
+	     internal_cursor->file_io_handle,
+	     page_offset,
+	     page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " at offset: %" PRIi64 ".",
+		 function,
+		 page_number,
+		 page_offset );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the values tree value of a specific page value into the cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_read_page_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t page_number,
+     uint16_t page_value_index,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_cursor_read_page_value";
+	off64_t page_offset   = 0;
+
+	if( internal_cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_values_tree_value_clear(
+	     internal_cursor->values_tree_value,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear values tree value.",
+		 function );
+
+		return( -1 );
+	}
+	page_offset  = page_number - 1;
+	page_offset *= internal_cursor->io_handle->page_size;
+
+	internal_cursor->values_tree_value->page_offset      = page_offset;
+	internal_cursor->values_tree_value->page_number      = page_number;
+	internal_cursor->values_tree_value->page_value_index = page_value_index;
+
+	if( libesedb_page_tree_read_page_value(
+	     internal_cursor->page_tree,
+	     internal_cursor->file_io_handle,
+	     page_offset,
+	     page_number,
+	     page_value_index,
+	     NULL,
+	     internal_cursor->values_tree_value,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page: %" PRIu32 " value: %" PRIu16 ".",
+		 function,
+		 page_number,
+		 page_value_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the page number of the first leaf page
+ * The branch pages are descended through their first non-defunct page value
+ * Returns 1 if successful, 0 if the page tree is empty or -1 on error
+ */
+int libesedb_cursor_get_first_leaf_page_number(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t *page_number,
+     liberror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_get_first_leaf_page_number";
+	uint32_t child_page_number        = 0;
+	uint32_t depth                    = 0;
+	uint32_t safe_page_number         = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	int result                        = 0;
+
+	if( internal_cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page number.",
+		 function );
+
+		return( -1 );
+	}
+	safe_page_number = internal_cursor->father_data_page_number;
+
+	for( depth = 0;
+	     depth < internal_cursor->io_handle->last_page_number;
+	     depth++ )
+	{
+		if( libesedb_cursor_get_page(
+		     internal_cursor,
+		     safe_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 safe_page_number );
+
+			goto on_error;
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			break;
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			*page_number = safe_page_number;
+			result       = 1;
+
+			break;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		/* The page value 0 contains the page header
+		 */
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+			{
+				break;
+			}
+		}
+		if( page_value_index >= number_of_page_values )
+		{
+			break;
+		}
+		if( libesedb_cursor_read_page_value(
+		     internal_cursor,
+		     safe_page_number,
+		     page_value_index,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page: %" PRIu32 " value: %" PRIu16 ".",
+			 function,
+			 safe_page_number,
+			 page_value_index );
+
+			goto on_error;
+		}
+		/* The page remains referenced while the page value is read
+		 * so it cannot be evicted from the cache
+		 */
+		if( libesedb_page_get_value(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( ( (size_t) internal_cursor->values_tree_value->data_offset + 4 ) > (size_t) page_value->size )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: page value: %" PRIu16 " too small to contain child page number.",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( page_value->data[ internal_cursor->values_tree_value->data_offset ] ),
+		 child_page_number );
+
+		if( libesedb_page_cache_release_page(
+		     internal_cursor->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page: %" PRIu32 ".",
+			 function,
+			 safe_page_number );
+
+			goto on_error;
+		}
+		safe_page_number = child_page_number;
+	}
+	if( page != NULL )
+	{
+		if( libesedb_page_cache_release_page(
+		     internal_cursor->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page: %" PRIu32 ".",
+			 function,
+			 safe_page_number );
+
+			return( -1 );
+		}
+	}
+	else if( depth >= internal_cursor->io_handle->last_page_number )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: page tree depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 internal_cursor->pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the column identifiers of the columns to read
+ * The records retrieved by the cursor will only contain the values of these columns,
+ * the values of the other columns are empty. If column identifiers is NULL all the
+ * columns are read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_set_column_identifiers(
+     libesedb_cursor_t *cursor,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     liberror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	uint32_t *safe_column_identifiers           = NULL;
+	static char *function                       = "libesedb_cursor_set_column_identifiers";
+
+	if( cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( ( column_identifiers == NULL )
+	 && ( number_of_column_identifiers != 0 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_column_identifiers < 0 )
+	 || ( (size_t) number_of_column_identifiers > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of column identifiers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifiers != NULL )
+	{
+		/* Make sure at least one element is allocated when an empty set of columns is selected
+		 */
+		safe_column_identifiers = (uint32_t *) memory_allocate(
+		                                        sizeof( uint32_t ) * ( number_of_column_identifiers + 1 ) );
+
+		if( safe_column_identifiers == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     safe_column_identifiers,
+		     column_identifiers,
+		     sizeof( uint32_t ) * number_of_column_identifiers ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy column identifiers.",
+			 function );
+
+			memory_free(
+			 safe_column_identifiers );
+
+			return( -1 );
+		}
+	}
+	if( internal_cursor->column_identifiers != NULL )
+	{
+		memory_free(
+		 internal_cursor->column_identifiers );
+	}
+	internal_cursor->column_identifiers           = safe_column_identifiers;
+	internal_cursor->number_of_column_identifiers = number_of_column_identifiers;
+
+	return( 1 );
+}
+
+/* Moves the cursor to the next (non-defunct) value
+ * The leaf pages are read in order of their next page numbers
+ * Returns 1 if successful, 0 if no more values are available or -1 on error
+ */
+int libesedb_cursor_next(
+     libesedb_cursor_t *cursor,
+     liberror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_cursor_next";
+	uint32_t next_page_number                   = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+	int result                                  = 0;
+
+	if( cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( internal_cursor->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->is_at_end != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_cursor->page_number == 0 )
+	{
+		result = libesedb_cursor_get_first_leaf_page_number(
+		          internal_cursor,
+		          &( internal_cursor->page_number ),
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			internal_cursor->is_at_end = 1;
+
+			return( 0 );
+		}
+		internal_cursor->page_value_index     = 0;
+		internal_cursor->number_of_leaf_pages = 1;
+	}
+	internal_cursor->is_positioned = 0;
+
+	result = 0;
+
+	while( internal_cursor->is_at_end == 0 )
+	{
+		if( libesedb_cursor_get_page(
+		     internal_cursor,
+		     internal_cursor->page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 internal_cursor->page_number );
+
+			goto on_error;
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+			 function,
+			 internal_cursor->page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		/* The page value 0 contains the page header
+		 */
+		for( page_value_index = internal_cursor->page_value_index + 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+			{
+				break;
+			}
+		}
+		if( page_value_index < number_of_page_values )
+		{
+			if( libesedb_cursor_read_page_value(
+			     internal_cursor,
+			     internal_cursor->page_number,
+			     page_value_index,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_IO,
+				 LIBERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page: %" PRIu32 " value: %" PRIu16 ".",
+				 function,
+				 internal_cursor->page_number,
+				 page_value_index );
+
+				goto on_error;
+			}
+			internal_cursor->page_value_index = page_value_index;
+			internal_cursor->is_positioned    = 1;
+
+			result = 1;
+
+			break;
+		}
+		next_page_number = page->next_page_number;
+
+		if( libesedb_page_cache_release_page(
+		     internal_cursor->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page: %" PRIu32 ".",
+			 function,
+			 internal_cursor->page_number );
+
+			goto on_error;
+		}
+		if( next_page_number == 0 )
+		{
+			internal_cursor->is_at_end = 1;
+
+			break;
+		}
+		/* Prevent loops in the leaf page chain
+		 */
+		if( internal_cursor->number_of_leaf_pages >= internal_cursor->io_handle->last_page_number )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: number of leaf pages value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		internal_cursor->page_number           = next_page_number;
+		internal_cursor->page_value_index      = 0;
+		internal_cursor->number_of_leaf_pages += 1;
+	}
+	if( page != NULL )
+	{
+		if( libesedb_page_cache_release_page(
+		     internal_cursor->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page: %" PRIu32 ".",
+			 function,
+			 internal_cursor->page_number );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 internal_cursor->pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record at the current position of the cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     liberror_error_t **error )
+{
+	libfdata_tree_node_t *record_values_tree_node          = NULL;
+	libesedb_internal_cursor_t *internal_cursor            = NULL;
+	libesedb_page_t *page                                  = NULL;
+	libesedb_values_tree_value_t *record_values_tree_value = NULL;
+	uint8_t *index_data                                    = NULL;
+	static char *function                                  = "libesedb_cursor_get_record";
+	size_t index_data_size                                 = 0;
+
+	if( cursor == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->is_positioned == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - not positioned on a value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->type == LIBESEDB_CURSOR_TYPE_INDEX )
+	{
+		if( libesedb_values_tree_value_read_data(
+		     internal_cursor->values_tree_value,
+		     internal_cursor->file_io_handle,
+		     internal_cursor->io_handle,
+		     internal_cursor->pages_cache,
+		     &page,
+		     &index_data,
+		     &index_data_size,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index values tree value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_values_tree_get_leaf_node_by_key(
+		     internal_cursor->table_values_tree,
+		     internal_cursor->file_io_handle,
+		     internal_cursor->table_values_cache,
+		     index_data,
+		     index_data_size,
+		     &record_values_tree_node,
+		     0,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values tree node.",
+			 function );
+
+			libesedb_page_cache_release_page(
+			 internal_cursor->pages_cache,
+			 &page,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libesedb_page_cache_release_page(
+		     internal_cursor->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfdata_tree_node_get_node_value(
+		     record_values_tree_node,
+		     internal_cursor->file_io_handle,
+		     internal_cursor->table_values_cache,
+		     (intptr_t **) &record_values_tree_value,
+		     0,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node value from record values tree node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		record_values_tree_value = internal_cursor->values_tree_value;
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_cursor->file_io_handle,
+	     internal_cursor->io_handle,
+	     internal_cursor->table_definition,
+	     internal_cursor->template_table_definition,
+	     internal_cursor->pages_cache,
+	     internal_cursor->long_values_pages_cache,
+	     record_values_tree_value,
+	     internal_cursor->long_values_tree,
+	     internal_cursor->long_values_cache,
+	     internal_cursor->column_identifiers,
+	     internal_cursor->number_of_column_identifiers,
+	     LIBESEDB_ITEM_FLAGS_DEFAULT,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
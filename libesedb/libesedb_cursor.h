@@ -0,0 +1,204 @@
+/*
+ * Cursor functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_CURSOR_H )
+#define _LIBESEDB_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_extern.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_cache.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+#include "libesedb_values_tree_value.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBESEDB_CURSOR_TYPES
+{
+	LIBESEDB_CURSOR_TYPE_INDEX	= (uint8_t) 'i',
+	LIBESEDB_CURSOR_TYPE_TABLE	= (uint8_t) 't'
+};
+
+typedef struct libesedb_internal_cursor libesedb_internal_cursor_t;
+
+struct libesedb_internal_cursor
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The table definition
+	 */
+	libesedb_table_definition_t *table_definition;
+
+	/* The template table definition
+	 */
+	libesedb_table_definition_t *template_table_definition;
+
+	/* The pages cache
+	 */
+	libesedb_page_cache_t *pages_cache;
+
+	/* The long values pages cache
+	 */
+	libesedb_page_cache_t *long_values_pages_cache;
+
+	/* The table values tree
+	 */
+	libfdata_tree_t *table_values_tree;
+
+	/* The table values cache
+	 */
+	libfcache_cache_t *table_values_cache;
+
+	/* The long values tree
+	 */
+	libfdata_tree_t *long_values_tree;
+
+	/* The long values cache
+	 */
+	libfcache_cache_t *long_values_cache;
+
+	/* The cursor type
+	 */
+	uint8_t type;
+
+	/* The page tree
+	 */
+	libesedb_page_tree_t *page_tree;
+
+	/* The father data page (FDP) number
+	 */
+	uint32_t father_data_page_number;
+
+	/* The current (leaf) page number
+	 */
+	uint32_t page_number;
+
+	/* The current page value index
+	 */
+	uint16_t page_value_index;
+
+	/* The number of leaf pages read
+	 */
+	uint32_t number_of_leaf_pages;
+
+	/* The values tree value of the current page value
+	 */
+	libesedb_values_tree_value_t *values_tree_value;
+
+	/* Value to indicate the cursor is positioned on a page value
+	 */
+	uint8_t is_positioned;
+
+	/* Value to indicate the cursor has passed the last page value
+	 */
+	uint8_t is_at_end;
+
+	/* The column identifiers of the columns to read
+	 * If NULL all columns are read
+	 */
+	uint32_t *column_identifiers;
+
+	/* The number of column identifiers
+	 */
+	int number_of_column_identifiers;
+};
+
+int libesedb_cursor_initialize(
+     libesedb_cursor_t **cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
+     libfdata_tree_t *table_values_tree,
+     libfcache_cache_t *table_values_cache,
+     libfdata_tree_t *long_values_tree,
+     libfcache_cache_t *long_values_cache,
+     uint32_t object_identifier,
+     uint32_t father_data_page_number,
+     uint8_t type,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_free(
+     libesedb_cursor_t **cursor,
+     liberror_error_t **error );
+
+int libesedb_cursor_get_page(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     liberror_error_t **error );
+
+int libesedb_cursor_read_page_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t page_number,
+     uint16_t page_value_index,
+     liberror_error_t **error );
+
+int libesedb_cursor_get_first_leaf_page_number(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t *page_number,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_set_column_identifiers(
+     libesedb_cursor_t *cursor,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_next(
+     libesedb_cursor_t *cursor,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -142,10 +142,10 @@ int libesedb_database_read(
      libesedb_database_t *database,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      liberror_error_t **error )
 {
+	libesedb_page_t *page                           = NULL;
 	libesedb_page_tree_t *database_page_tree        = NULL;
 	libesedb_values_tree_value_t *values_tree_value = NULL;
 	libfcache_cache_t *database_values_cache        = NULL;
@@ -172,7 +172,6 @@ int libesedb_database_read(
 	if( libesedb_page_tree_initialize(
 	     &database_page_tree,
 	     io_handle,
-	     pages_vector,
 	     pages_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_DATABASE,
 	     NULL,
@@ -304,8 +303,8 @@ int libesedb_database_read(
 		     values_tree_value,
 		     file_io_handle,
 		     io_handle,
-		     pages_vector,
 		     pages_cache,
+		     &page,
 		     &data,
 		     &data_size,
 		     error ) != 1 )
@@ -335,6 +334,20 @@ int libesedb_database_read(
 			}
 		}
 #endif
+		if( libesedb_page_cache_release_page(
+		     pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libfcache_cache_free(
 	     &database_values_cache,
@@ -365,6 +378,13 @@ int libesedb_database_read(
 	return( 1 );
 
 on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 pages_cache,
+		 &page,
+		 NULL );
+	}
 	if( database_values_cache != NULL )
 	{
 		libfcache_cache_free(
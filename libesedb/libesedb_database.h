@@ -31,6 +31,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,8 +57,7 @@ int libesedb_database_read(
      libesedb_database_t *database,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      liberror_error_t **error );
 
 #if defined( __cplusplus )
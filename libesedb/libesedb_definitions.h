@@ -46,13 +46,15 @@
 /* The access flags definitions
  * bit 1        set to 1 for read access
  * bit 2        set to 1 for write access
- * bit 3-8      not used
+ * bit 3        set to 1 to memory map the file (read access only)
+ * bit 4-8      not used
  */
 enum LIBESEDB_ACCESS_FLAGS
 {
 	LIBESEDB_ACCESS_FLAG_READ					= 0x01,
 /* Reserved: not supported yet */
-	LIBESEDB_ACCESS_FLAG_WRITE					= 0x02
+	LIBESEDB_ACCESS_FLAG_WRITE					= 0x02,
+	LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED				= 0x04
 };
 
 /* The file access macros
@@ -117,6 +119,24 @@ enum LIBESEDB_VALUE_FLAGS
 	LIBESEDB_VALUE_FLAG_0x10					= 0x10
 };
 
+/* The checksum policies
+ */
+enum LIBESEDB_CHECKSUM_POLICIES
+{
+	LIBESEDB_CHECKSUM_POLICY_ALWAYS					= 0,
+	LIBESEDB_CHECKSUM_POLICY_ONCE					= 1,
+	LIBESEDB_CHECKSUM_POLICY_NEVER					= 2
+};
+
+/* The page checksum status
+ */
+enum LIBESEDB_PAGE_CHECKSUM_STATUS
+{
+	LIBESEDB_PAGE_CHECKSUM_STATUS_UNVERIFIED			= 0,
+	LIBESEDB_PAGE_CHECKSUM_STATUS_VALID				= 1,
+	LIBESEDB_PAGE_CHECKSUM_STATUS_MISMATCH				= 2
+};
+
 #endif /* !defined( HAVE_LOCAL_LIBESEDB ) */
 
 #define LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT			0x0b
@@ -219,14 +239,34 @@ enum LIBESEDB_FILE_ATTRIBUTE_FLAGS
 	LIBESEDB_FILE_ATTRIBUTE_FLAG_VIRTUAL				= 0x00010000
 };
 
+/* The default size of the pages cache in bytes
+ */
+#define LIBESEDB_DEFAULT_PAGES_CACHE_SIZE				( 64 * 1024 * 1024 )
+
+/* The default number of leaf pages to read ahead
+ */
+#define LIBESEDB_DEFAULT_READAHEAD_WINDOW				32
+
+/* The minimum number of cache entries definitions
+ */
+#define LIBESEDB_MINIMUM_CACHE_ENTRIES_PAGES				64
+
+/* The number of shards of the pages cache
+ * Every shard has its own lock, a page is assigned to a shard by its page number
+ */
+#define LIBESEDB_NUMBER_OF_PAGES_CACHE_SHARDS				16
+
 /* The maximum number of cache entries defintions
  */
-#define LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES				( 8 * 1024 ) - 3
 #define LIBESEDB_MAXIMUM_CACHE_ENTRIES_INDEX_VALUES			( 32 * 1024 ) - 3
 #define LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES			( 128 * 1024 ) - 3
 #define LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES_DATA			8
 #define LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES			( 32 * 1024 ) - 3
 #define LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES			( 128 * 1024 ) - 3
 
+/* The maximum number of pool entries definitions
+ */
+#define LIBESEDB_MAXIMUM_POOL_ENTRIES_PAGES				64
+
 #endif
 
@@ -38,6 +38,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 
@@ -193,6 +194,22 @@ int libesedb_file_free(
 		}
 		*file = NULL;
 
+		if( internal_file->catalog_cache_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->catalog_cache_file_io_handle ),
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog cache file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libesedb_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -342,6 +359,23 @@ int libesedb_file_open(
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( libbfio_file_set_use_memory_map(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set use memory map in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libesedb_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -479,6 +513,23 @@ int libesedb_file_open_wide(
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( libbfio_file_set_use_memory_map(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set use memory map in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libesedb_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -722,20 +773,7 @@ int libesedb_file_close(
 	internal_file->file_io_handle                    = NULL;
 	internal_file->file_io_handle_created_in_library = 0;
 
-	if( libfdata_vector_free(
-	     &( internal_file->pages_vector ),
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free pages vector.",
-		 function );
-
-		result = -1;
-	}
-	if( libfcache_cache_free(
+	if( libesedb_page_cache_free(
 	     &( internal_file->pages_cache ),
 	     error ) != 1 )
 	{
@@ -784,10 +822,11 @@ int libesedb_file_open_read(
      libesedb_internal_file_t *internal_file,
      liberror_error_t **error )
 {
-	static char *function = "libesedb_file_open_read";
-	off64_t file_offset   = 0;
-	size64_t file_size    = 0;
-	int result            = 0;
+	static char *function          = "libesedb_file_open_read";
+	off64_t file_offset            = 0;
+	size64_t file_size             = 0;
+	size64_t maximum_cache_entries = 0;
+	int result                     = 0;
 
 	if( internal_file == NULL )
 	{
@@ -811,17 +850,6 @@ int libesedb_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->pages_vector != NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid internal file - pages vector already set.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_file->pages_cache != NULL )
 	{
 		liberror_error_set(
@@ -1029,45 +1057,24 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
-	/* TODO clone function ? */
-	if( libfdata_vector_initialize(
-	     &( internal_file->pages_vector ),
-	     (size64_t) internal_file->io_handle->page_size,
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     &libesedb_io_handle_read_page,
-	     LIBFDATA_FLAG_IO_HANDLE_NON_MANAGED,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
+	/* The pages cache is shared by the catalog, the tables and the indexes
+	 * and is bounded by the pages cache size
+	 */
+	maximum_cache_entries = internal_file->io_handle->pages_cache_size
+	                      / internal_file->io_handle->page_size;
 
-		goto on_error;
+	if( maximum_cache_entries < LIBESEDB_MINIMUM_CACHE_ENTRIES_PAGES )
+	{
+		maximum_cache_entries = LIBESEDB_MINIMUM_CACHE_ENTRIES_PAGES;
 	}
-	if( libfdata_vector_append_segment(
-	     internal_file->pages_vector,
-	     internal_file->io_handle->pages_data_offset,
-	     internal_file->io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
+	else if( maximum_cache_entries > (size64_t) INT_MAX )
 	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
-		 function );
-
-		goto on_error;
+		maximum_cache_entries = (size64_t) INT_MAX;
 	}
-	if( libfcache_cache_initialize(
+	if( libesedb_page_cache_initialize(
 	     &( internal_file->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     internal_file->io_handle,
+	     (int) maximum_cache_entries,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1105,7 +1112,6 @@ int libesedb_file_open_read(
 		     internal_file->database,
 		     internal_file->file_io_handle,
 		     internal_file->io_handle,
-		     internal_file->pages_vector,
 		     internal_file->pages_cache,
 		     error ) != 1 )
 		{
@@ -1142,8 +1148,9 @@ int libesedb_file_open_read(
 		     internal_file->catalog,
 		     internal_file->file_io_handle,
 		     internal_file->io_handle,
-		     internal_file->pages_vector,
 		     internal_file->pages_cache,
+		     internal_file->catalog_cache_file_io_handle,
+		     internal_file->catalog_read_on_demand,
 		     error ) != 1 )
 		{
 			liberror_error_set(
@@ -1160,15 +1167,9 @@ int libesedb_file_open_read(
 	return( 1 );
 
 on_error:
-	if( internal_file->pages_vector != NULL )
-	{
-		libfdata_vector_free(
-		 &( internal_file->pages_vector ),
-		 NULL );
-	}
 	if( internal_file->pages_cache != NULL )
 	{
-		libfcache_cache_free(
+		libesedb_page_cache_free(
 		 &( internal_file->pages_cache ),
 		 NULL );
 	}
@@ -1417,16 +1418,16 @@ int libesedb_file_get_page_size(
 	return( 1 );
 }
 
-/* Retrieves the number of tables
+/* Retrieves the checksum policy
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_number_of_tables(
+int libesedb_file_get_checksum_policy(
      libesedb_file_t *file,
-     int *number_of_tables,
+     uint8_t *checksum_policy,
      liberror_error_t **error )
 {
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_number_of_tables";
+	static char *function                   = "libesedb_file_get_checksum_policy";
 
 	if( file == NULL )
 	{
@@ -1441,54 +1442,44 @@ int libesedb_file_get_number_of_tables(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->catalog == NULL )
+	if( internal_file->io_handle == NULL )
 	{
-		if( number_of_tables == NULL )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid number of tables.",
-			 function );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
 
-			return( -1 );
-		}
-		*number_of_tables = 0;
+		return( -1 );
 	}
-	else
+	if( checksum_policy == NULL )
 	{
-		if( libesedb_catalog_get_number_of_table_definitions(
-		     internal_file->catalog,
-		     number_of_tables,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of tables.",
-			 function );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum policy.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
+	*checksum_policy = internal_file->io_handle->checksum_policy;
+
 	return( 1 );
 }
 
-/* Retrieves a specific table
+/* Sets the checksum policy
+ * The policy determines if the page checksums are verified always, once or never
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_table(
+int libesedb_file_set_checksum_policy(
      libesedb_file_t *file,
-     int table_entry,
-     libesedb_table_t **table,
+     uint8_t checksum_policy,
      liberror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table";
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_checksum_policy";
 
 	if( file == NULL )
 	{
@@ -1503,121 +1494,99 @@ int libesedb_file_get_table(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( table == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
-		 function );
-
-		return( -1 );
-	}
-	if( *table != NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid table value already set.",
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_catalog_get_table_definition_by_index(
-	     internal_file->catalog,
-	     table_entry,
-	     &table_definition,
-	     error ) != 1 )
+	if( ( checksum_policy != LIBESEDB_CHECKSUM_POLICY_ALWAYS )
+	 && ( checksum_policy != LIBESEDB_CHECKSUM_POLICY_ONCE )
+	 && ( checksum_policy != LIBESEDB_CHECKSUM_POLICY_NEVER ) )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve table definition: %d.",
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum policy: %" PRIu8 ".",
 		 function,
-		 table_entry );
+		 checksum_policy );
 
 		return( -1 );
 	}
-	if( table_definition == NULL )
+	internal_file->io_handle->checksum_policy = checksum_policy;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the pages cache in bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_cache_size(
+     libesedb_file_t *file,
+     size64_t *cache_size,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_cache_size";
+
+	if( file == NULL )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing table definition.",
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_definition->table_catalog_definition == NULL )
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid table definition - missing table catalog definition.",
+		 "%s: invalid internal file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_definition->table_catalog_definition->template_name != NULL )
-	{
-		if( libesedb_catalog_get_table_definition_by_utf8_name(
-		     internal_file->catalog,
-		     table_definition->table_catalog_definition->template_name,
-		     table_definition->table_catalog_definition->template_name_size,
-		     &template_table_definition,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template table definition.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( libesedb_table_initialize(
-	     table,
-	     internal_file->file_io_handle,
-	     internal_file->io_handle,
-	     table_definition,
-	     template_table_definition,
-	     LIBESEDB_ITEM_FLAGS_DEFAULT,
-	     error ) != 1 )
+	if( cache_size == NULL )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table.",
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
 		 function );
 
 		return( -1 );
 	}
+	*cache_size = internal_file->io_handle->pages_cache_size;
+
 	return( 1 );
 }
 
-/* Retrieves the table for the UTF-8 encoded name
- * Returns 1 if successful, 0 if no table could be found or -1 on error
+/* Sets the size of the pages cache in bytes
+ * The pages cache is shared by all the tables and indexes of the file
+ * The size must be set before the file is opened
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_table_by_utf8_name(
+int libesedb_file_set_cache_size(
      libesedb_file_t *file,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libesedb_table_t **table,
+     size64_t cache_size,
      liberror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table_by_utf8_name";
-	int result                                             = 0;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_cache_size";
 
 	if( file == NULL )
 	{
@@ -1632,52 +1601,834 @@ int libesedb_file_get_table_by_utf8_name(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( table == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *table != NULL )
+	if( internal_file->pages_cache != NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid table value already set.",
+		 "%s: invalid internal file - pages cache already set.",
 		 function );
 
 		return( -1 );
 	}
-	result = libesedb_catalog_get_table_definition_by_utf8_name(
-	          internal_file->catalog,
-	          utf8_string,
-	          utf8_string_length,
-	          &table_definition,
-	          error );
-
-	if( result == -1 )
+	if( cache_size == 0 )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve table definition.",
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid cache size value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
-	{
-		if( table_definition == NULL )
-		{
-			liberror_error_set(
-			 error,
+	internal_file->io_handle->pages_cache_size = cache_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of leaf pages that are read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_readahead_window(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_readahead_window";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pages = internal_file->io_handle->readahead_window;
+
+	return( 1 );
+}
+
+/* Sets the number of leaf pages that are read ahead
+ * The leaf pages are read ahead when they are read sequentially
+ * The child pages of a branch page are read ahead when the branch page is read
+ * 0 disables the read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_readahead_window(
+     libesedb_file_t *file,
+     uint32_t number_of_pages,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_readahead_window";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_pages_state_lock(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->readahead_window      = number_of_pages;
+	internal_file->io_handle->readahead_page_number = 0;
+
+	if( libesedb_io_handle_release_pages_state_lock(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value to indicate the catalog is read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t *read_on_demand,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_catalog_read_on_demand";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( read_on_demand == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read on demand.",
+		 function );
+
+		return( -1 );
+	}
+	*read_on_demand = internal_file->catalog_read_on_demand;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate the catalog is read on demand
+ * If set only the table definitions are read when the tables are first accessed
+ * and the column and index definitions of a table when the table is first retrieved
+ * otherwise the entire catalog is read when the file is opened
+ * This value needs to be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t read_on_demand,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_catalog_read_on_demand";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal file - catalog already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_on_demand != 0 )
+	{
+		internal_file->catalog_read_on_demand = 1;
+	}
+	else
+	{
+		internal_file->catalog_read_on_demand = 0;
+	}
+	return( 1 );
+}
+
+/* Sets the filename of the catalog cache file
+ * The catalog cache file contains a copy of the catalog that is used instead of
+ * the catalog in the database file when it was written for the same state of the database file
+ * If the catalog cache file is missing or does not match it is (re)written when the file is opened
+ * This value needs to be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_catalog_cache_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     liberror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_catalog_cache_filename";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal file - catalog already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     libcstring_narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_use_memory_map(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use memory map in catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->catalog_cache_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->catalog_cache_file_io_handle ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog cache file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->catalog_cache_file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the catalog cache file
+ * This value needs to be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_catalog_cache_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     liberror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_catalog_cache_filename_wide";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal file - catalog already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     libcstring_wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_use_memory_map(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use memory map in catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->catalog_cache_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->catalog_cache_file_io_handle ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog cache file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->catalog_cache_file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif
+
+/* Retrieves the checksum status of a specific page
+ * The status is only known for pages that were read while the checksums were verified
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_page_checksum_status(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     uint8_t *checksum_status,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_page_checksum_status";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > internal_file->io_handle->last_page_number ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_get_page_checksum_status(
+	     internal_file->io_handle,
+	     page_number,
+	     checksum_status,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checksum status of page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of tables
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_tables(
+     libesedb_file_t *file,
+     int *number_of_tables,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_tables";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog == NULL )
+	{
+		if( number_of_tables == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of tables.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_tables = 0;
+	}
+	else
+	{
+		if( libesedb_catalog_get_number_of_table_definitions(
+		     internal_file->catalog,
+		     number_of_tables,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of tables.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_table(
+     libesedb_file_t *file,
+     int table_entry,
+     libesedb_table_t **table,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file                = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	static char *function                                  = "libesedb_file_get_table";
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_table_definition_by_index(
+	     internal_file->catalog,
+	     table_entry,
+	     &table_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition: %d.",
+		 function,
+		 table_entry );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition->template_name != NULL )
+	{
+		if( libesedb_catalog_get_table_definition_by_utf8_name(
+		     internal_file->catalog,
+		     table_definition->table_catalog_definition->template_name,
+		     table_definition->table_catalog_definition->template_name_size,
+		     &template_table_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template table definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_table_initialize(
+	     table,
+	     internal_file->file_io_handle,
+	     internal_file->io_handle,
+	     internal_file->pages_cache,
+	     table_definition,
+	     template_table_definition,
+	     LIBESEDB_ITEM_FLAGS_DEFAULT,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table for the UTF-8 encoded name
+ * Returns 1 if successful, 0 if no table could be found or -1 on error
+ */
+int libesedb_file_get_table_by_utf8_name(
+     libesedb_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_table_t **table,
+     liberror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file                = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	static char *function                                  = "libesedb_file_get_table_by_utf8_name";
+	int result                                             = 0;
+
+	if( file == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          internal_file->catalog,
+	          utf8_string,
+	          utf8_string_length,
+	          &table_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( table_definition == NULL )
+		{
+			liberror_error_set(
+			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing table definition.",
@@ -1719,6 +2470,7 @@ int libesedb_file_get_table_by_utf8_name(
 		     table,
 		     internal_file->file_io_handle,
 		     internal_file->io_handle,
+		     internal_file->pages_cache,
 		     table_definition,
 		     template_table_definition,
 		     LIBESEDB_ITEM_FLAGS_DEFAULT,
@@ -1853,6 +2605,7 @@ int libesedb_file_get_table_by_utf16_name(
 		     table,
 		     internal_file->file_io_handle,
 		     internal_file->io_handle,
+		     internal_file->pages_cache,
 		     table_definition,
 		     template_table_definition,
 		     LIBESEDB_ITEM_FLAGS_DEFAULT,
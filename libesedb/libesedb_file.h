@@ -41,6 +41,7 @@
  * mess up exporting the legacy functions
  */
 #include "libesedb_legacy.h"
+#include "libesedb_page_cache.h"
 #endif
 
 #if defined( __cplusplus )
@@ -63,13 +64,9 @@ struct libesedb_internal_file
 	 */
 	uint8_t file_io_handle_created_in_library;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
 	/* The pages cache
 	 */
-	libfcache_cache_t *pages_cache;
+	libesedb_page_cache_t *pages_cache;
 
 	/* The database
 	 */
@@ -79,6 +76,14 @@ struct libesedb_internal_file
 	 */
 	libesedb_catalog_t *catalog;
 
+	/* Value to indicate the catalog is read on demand
+	 */
+	uint8_t catalog_read_on_demand;
+
+	/* The catalog cache file IO handle
+	 */
+	libbfio_handle_t *catalog_cache_file_io_handle;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -157,6 +162,75 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      liberror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_get_checksum_policy(
+     libesedb_file_t *file,
+     uint8_t *checksum_policy,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_checksum_policy(
+     libesedb_file_t *file,
+     uint8_t checksum_policy,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_cache_size(
+     libesedb_file_t *file,
+     size64_t *cache_size,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_cache_size(
+     libesedb_file_t *file,
+     size64_t cache_size,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_readahead_window(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_readahead_window(
+     libesedb_file_t *file,
+     uint32_t number_of_pages,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t *read_on_demand,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t read_on_demand,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_cache_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     liberror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_cache_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     liberror_error_t **error );
+#endif
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_page_checksum_status(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     uint8_t *checksum_status,
+     liberror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
@@ -0,0 +1,684 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_hash_table.h"
+#include "libesedb_libuna.h"
+
+/* The initial number of entries of a hash table
+ */
+#define LIBESEDB_HASH_TABLE_INITIAL_NUMBER_OF_ENTRIES	16
+
+/* The FNV-1a hash parameters
+ */
+#define LIBESEDB_HASH_TABLE_FNV_OFFSET_BASIS		0x811c9dc5UL
+#define LIBESEDB_HASH_TABLE_FNV_PRIME			0x01000193UL
+
+/* Creates a hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_initialize(
+     libesedb_hash_table_t **hash_table,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_initialize";
+
+	if( hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_table = memory_allocate_structure(
+	               libesedb_hash_table_t );
+
+	if( *hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_table,
+	     0,
+	     sizeof( libesedb_hash_table_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_hash_table_resize(
+	     *hash_table,
+	     LIBESEDB_HASH_TABLE_INITIAL_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize hash table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *hash_table != NULL )
+	{
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash table
+ * The values are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_free(
+     libesedb_hash_table_t **hash_table,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_free";
+
+	if( hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		if( ( *hash_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->entries );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes a hash table
+ * The number of entries must be a power of 2 and larger than the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_resize(
+     libesedb_hash_table_t *hash_table,
+     int number_of_entries,
+     liberror_error_t **error )
+{
+	libesedb_hash_table_entry_t *entries     = NULL;
+	libesedb_hash_table_entry_t *old_entries = NULL;
+	static char *function                    = "libesedb_hash_table_resize";
+	uint32_t entry_mask                      = 0;
+	uint32_t entry_index                     = 0;
+	int old_entry_index                      = 0;
+	int old_number_of_entries                = 0;
+
+	if( hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= hash_table->number_of_values )
+	 || ( ( number_of_entries & ( number_of_entries - 1 ) ) != 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) SSIZE_MAX / sizeof( libesedb_hash_table_entry_t ) ) ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries = (libesedb_hash_table_entry_t *) memory_allocate(
+	                                           sizeof( libesedb_hash_table_entry_t ) * number_of_entries );
+
+	if( entries == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     sizeof( libesedb_hash_table_entry_t ) * number_of_entries ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 entries );
+
+		return( -1 );
+	}
+	old_entries           = hash_table->entries;
+	old_number_of_entries = hash_table->number_of_entries;
+	entry_mask            = (uint32_t) number_of_entries - 1;
+
+	/* Re-insert the values of the previous entries
+	 */
+	for( old_entry_index = 0;
+	     old_entry_index < old_number_of_entries;
+	     old_entry_index++ )
+	{
+		if( old_entries[ old_entry_index ].value == NULL )
+		{
+			continue;
+		}
+		entry_index = old_entries[ old_entry_index ].hash & entry_mask;
+
+		while( entries[ entry_index ].value != NULL )
+		{
+			entry_index = ( entry_index + 1 ) & entry_mask;
+		}
+		entries[ entry_index ].hash  = old_entries[ old_entry_index ].hash;
+		entries[ entry_index ].value = old_entries[ old_entry_index ].value;
+	}
+	if( old_entries != NULL )
+	{
+		memory_free(
+		 old_entries );
+	}
+	hash_table->entries           = entries;
+	hash_table->number_of_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Inserts a value into the hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_insert_value(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     intptr_t *value,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_insert_value";
+	uint32_t entry_mask   = 0;
+	uint32_t entry_index  = 0;
+
+	if( hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor at or below 50%
+	 */
+	if( ( hash_table->number_of_values + 1 ) > ( hash_table->number_of_entries / 2 ) )
+	{
+		if( hash_table->number_of_entries > ( INT_MAX / 2 ) )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hash table - number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_hash_table_resize(
+		     hash_table,
+		     hash_table->number_of_entries * 2,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry_mask  = (uint32_t) hash_table->number_of_entries - 1;
+	entry_index = hash & entry_mask;
+
+	while( hash_table->entries[ entry_index ].value != NULL )
+	{
+		entry_index = ( entry_index + 1 ) & entry_mask;
+	}
+	hash_table->entries[ entry_index ].hash  = hash;
+	hash_table->entries[ entry_index ].value = value;
+
+	hash_table->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next value with a specific hash
+ * The probe index should be 0 for the first call and is updated for every value found,
+ * different values can share the same hash so the caller must compare the value
+ * Returns 1 if successful, 0 if no more values with the hash are available or -1 on error
+ */
+int libesedb_hash_table_get_next_value_by_hash(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     int *probe_index,
+     intptr_t **value,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_get_next_value_by_hash";
+	uint32_t entry_mask   = 0;
+	uint32_t entry_index  = 0;
+
+	if( hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table->entries == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash table - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( probe_index == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid probe index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *probe_index < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid probe index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	entry_mask = (uint32_t) hash_table->number_of_entries - 1;
+
+	/* The table always contains empty entries which terminate the probe sequence
+	 */
+	while( *probe_index < hash_table->number_of_entries )
+	{
+		entry_index = ( hash + (uint32_t) *probe_index ) & entry_mask;
+
+		if( hash_table->entries[ entry_index ].value == NULL )
+		{
+			break;
+		}
+		*probe_index += 1;
+
+		if( hash_table->entries[ entry_index ].hash == hash )
+		{
+			*value = hash_table->entries[ entry_index ].value;
+
+			return( 1 );
+		}
+	}
+	*value = NULL;
+
+	return( 0 );
+}
+
+/* Calculates the hash of a byte stream string
+ * The hash is calculated over the Unicode characters so that it matches
+ * the hash of the same string in UTF-8 or UTF-16, a terminating zero character is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_calculate_hash_from_byte_stream(
+     uint32_t *hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     liberror_error_t **error )
+{
+	static char *function                        = "libesedb_hash_table_calculate_hash_from_byte_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t byte_stream_index                     = 0;
+	uint32_t safe_hash                           = LIBESEDB_HASH_TABLE_FNV_OFFSET_BASIS;
+
+	if( hash == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size > 0 )
+	 && ( byte_stream[ byte_stream_size - 1 ] == 0 ) )
+	{
+		byte_stream_size -= 1;
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     codepage,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		safe_hash ^= (uint32_t) unicode_character;
+		safe_hash *= LIBESEDB_HASH_TABLE_FNV_PRIME;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 string
+ * The hash is calculated over the Unicode characters, a terminating zero character is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_calculate_hash_from_utf8_string(
+     uint32_t *hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     liberror_error_t **error )
+{
+	static char *function                        = "libesedb_hash_table_calculate_hash_from_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_hash                           = LIBESEDB_HASH_TABLE_FNV_OFFSET_BASIS;
+
+	if( hash == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length -= 1;
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     (libuna_utf8_character_t *) utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_hash ^= (uint32_t) unicode_character;
+		safe_hash *= LIBESEDB_HASH_TABLE_FNV_PRIME;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-16 string
+ * The hash is calculated over the Unicode characters, a terminating zero character is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_calculate_hash_from_utf16_string(
+     uint32_t *hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     liberror_error_t **error )
+{
+	static char *function                        = "libesedb_hash_table_calculate_hash_from_utf16_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_hash                           = LIBESEDB_HASH_TABLE_FNV_OFFSET_BASIS;
+
+	if( hash == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length > 0 )
+	 && ( utf16_string[ utf16_string_length - 1 ] == 0 ) )
+	{
+		utf16_string_length -= 1;
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     (libuna_utf16_character_t *) utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_hash ^= (uint32_t) unicode_character;
+		safe_hash *= LIBESEDB_HASH_TABLE_FNV_PRIME;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_HASH_TABLE_H )
+#define _LIBESEDB_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_hash_table_entry libesedb_hash_table_entry_t;
+
+struct libesedb_hash_table_entry
+{
+	/* The hash
+	 */
+	uint32_t hash;
+
+	/* The value
+	 */
+	intptr_t *value;
+};
+
+typedef struct libesedb_hash_table libesedb_hash_table_t;
+
+/* The hash table uses open addressing with linear probing
+ * Multiple values can be stored with the same hash, the values are not owned by the hash table
+ */
+struct libesedb_hash_table
+{
+	/* The entries
+	 */
+	libesedb_hash_table_entry_t *entries;
+
+	/* The number of entries
+	 * Always a power of 2
+	 */
+	int number_of_entries;
+
+	/* The number of values
+	 */
+	int number_of_values;
+};
+
+int libesedb_hash_table_initialize(
+     libesedb_hash_table_t **hash_table,
+     liberror_error_t **error );
+
+int libesedb_hash_table_free(
+     libesedb_hash_table_t **hash_table,
+     liberror_error_t **error );
+
+int libesedb_hash_table_resize(
+     libesedb_hash_table_t *hash_table,
+     int number_of_entries,
+     liberror_error_t **error );
+
+int libesedb_hash_table_insert_value(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     intptr_t *value,
+     liberror_error_t **error );
+
+int libesedb_hash_table_get_next_value_by_hash(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     int *probe_index,
+     intptr_t **value,
+     liberror_error_t **error );
+
+int libesedb_hash_table_calculate_hash_from_byte_stream(
+     uint32_t *hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     liberror_error_t **error );
+
+int libesedb_hash_table_calculate_hash_from_utf8_string(
+     uint32_t *hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     liberror_error_t **error );
+
+int libesedb_hash_table_calculate_hash_from_utf16_string(
+     uint32_t *hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,398 @@
+/*
+ * Huffman table functions
+ *
+ * Copyright (c) 2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_huffman_table.h"
+
+/* Initializes the Huffman table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_huffman_table_initialize(
+     libesedb_huffman_table_t **huffman_table,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_huffman_table_initialize";
+
+	if( huffman_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *huffman_table != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Huffman table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*huffman_table = memory_allocate_structure(
+	                  libesedb_huffman_table_t );
+
+	if( *huffman_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Huffman table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *huffman_table,
+	     0,
+	     sizeof( libesedb_huffman_table_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Huffman table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *huffman_table != NULL )
+	{
+		memory_free(
+		 *huffman_table );
+
+		*huffman_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the Huffman table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_huffman_table_free(
+     libesedb_huffman_table_t **huffman_table,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_huffman_table_free";
+
+	if( huffman_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *huffman_table != NULL )
+	{
+		memory_free(
+		 *huffman_table );
+
+		*huffman_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Builds the lookup tables of the Huffman table from the code sizes of the symbols
+ * The codes are canonical, codes are assigned in order of code size and then symbol
+ * A code size of 0 indicates the symbol has no code
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_huffman_table_build(
+     libesedb_huffman_table_t *huffman_table,
+     const uint8_t *code_sizes,
+     int number_of_symbols,
+     liberror_error_t **error )
+{
+	uint16_t sorted_symbols[ LIBESEDB_HUFFMAN_TABLE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+	int code_size_counts[ LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE + 1 ];
+	int symbol_offsets[ LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE + 2 ];
+
+	static char *function           = "libesedb_huffman_table_build";
+	uint16_t table_entry            = 0;
+	uint8_t code_size               = 0;
+	int entry_index                 = 0;
+	int first_secondary_prefix      = 0;
+	int number_of_codes             = 0;
+	int number_of_entries           = 0;
+	int number_of_secondary_entries = 0;
+	int number_of_secondary_tables  = 0;
+	int sorted_symbol_index         = 0;
+	int symbol                      = 0;
+	int table_index                 = 0;
+
+	if( huffman_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_symbols <= 0 )
+	 || ( number_of_symbols > LIBESEDB_HUFFMAN_TABLE_MAXIMUM_NUMBER_OF_SYMBOLS ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_size = 0;
+	     code_size <= LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		code_size_counts[ code_size ] = 0;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		if( code_sizes[ symbol ] > LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code size of symbol: %d value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		code_size_counts[ code_sizes[ symbol ] ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+
+	/* Make sure the codes fit in the code space, otherwise the codes are not prefix free
+	 * Unused codes are allowed and are detected when decoding
+	 */
+	number_of_codes = 1;
+
+	for( code_size = 1;
+	     code_size <= LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		number_of_codes <<= 1;
+		number_of_codes  -= code_size_counts[ code_size ];
+
+		if( number_of_codes < 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: code sizes exceed code space.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_codes == ( 1 << LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing codes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the symbols by code size maintaining the order of the symbols with the same code size
+	 */
+	symbol_offsets[ 1 ] = 0;
+
+	for( code_size = 1;
+	     code_size <= LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		symbol_offsets[ code_size + 1 ] = symbol_offsets[ code_size ] + code_size_counts[ code_size ];
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size != 0 )
+		{
+			sorted_symbols[ symbol_offsets[ code_size ] ] = (uint16_t) symbol;
+
+			symbol_offsets[ code_size ] += 1;
+		}
+	}
+	/* The codes are assigned in order of code size hence the codes larger than the primary table bits
+	 * follow the smaller codes and occupy a contiguous range of secondary tables
+	 */
+	for( code_size = 1;
+	     code_size <= LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS;
+	     code_size++ )
+	{
+		first_secondary_prefix += code_size_counts[ code_size ] << ( LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS - code_size );
+	}
+	for( code_size = LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS + 1;
+	     code_size <= LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		number_of_secondary_entries += code_size_counts[ code_size ] << ( LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE - code_size );
+	}
+	number_of_secondary_tables = ( number_of_secondary_entries + ( 1 << LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS ) - 1 ) >> LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS;
+
+	if( number_of_secondary_tables > LIBESEDB_HUFFMAN_TABLE_MAXIMUM_NUMBER_OF_SECONDARY_TABLES )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of secondary tables value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* If the codes use the entire code space every table entry is filled
+	 * otherwise the unused entries are cleared to mark them as invalid
+	 */
+	if( number_of_codes != 0 )
+	{
+		if( memory_set(
+		     huffman_table->primary_table,
+		     0,
+		     sizeof( uint16_t ) << LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear primary table.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_secondary_tables > 0 )
+		{
+			if( memory_set(
+			     huffman_table->secondary_tables,
+			     0,
+			     sizeof( uint16_t ) * ( (size_t) number_of_secondary_tables << LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS ) ) == NULL )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_MEMORY,
+				 LIBERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear secondary tables.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	huffman_table->number_of_secondary_tables = number_of_secondary_tables;
+
+	/* Fill the lookup tables with an entry for every value the bits following a code can have
+	 * the codes are consecutive so the entries of every next code directly follow the previous
+	 */
+	sorted_symbol_index = 0;
+	table_index         = 0;
+
+	for( code_size = 1;
+	     code_size <= LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS;
+	     code_size++ )
+	{
+		number_of_entries = 1 << ( LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS - code_size );
+
+		for( symbol = code_size_counts[ code_size ];
+		     symbol > 0;
+		     symbol-- )
+		{
+			table_entry = (uint16_t) ( ( sorted_symbols[ sorted_symbol_index++ ] << 4 ) | code_size );
+
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				huffman_table->primary_table[ table_index++ ] = table_entry;
+			}
+		}
+	}
+	table_index = 0;
+
+	for( code_size = LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS + 1;
+	     code_size <= LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		number_of_entries = 1 << ( LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE - code_size );
+
+		for( symbol = code_size_counts[ code_size ];
+		     symbol > 0;
+		     symbol-- )
+		{
+			table_entry = (uint16_t) ( ( sorted_symbols[ sorted_symbol_index++ ] << 4 ) | code_size );
+
+			huffman_table->primary_table[ first_secondary_prefix + ( table_index >> LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS ) ] =
+				(uint16_t) ( LIBESEDB_HUFFMAN_TABLE_ENTRY_FLAG_SECONDARY | ( table_index >> LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS ) );
+
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				huffman_table->secondary_tables[ table_index++ ] = table_entry;
+			}
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,104 @@
+/*
+ * Huffman table functions
+ *
+ * Copyright (c) 2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_HUFFMAN_TABLE_H )
+#define _LIBESEDB_HUFFMAN_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum code size in bits
+ */
+#define LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE		15
+
+/* The maximum number of symbols
+ */
+#define LIBESEDB_HUFFMAN_TABLE_MAXIMUM_NUMBER_OF_SYMBOLS	512
+
+/* The number of code bits resolved by the primary lookup table
+ */
+#define LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS			10
+
+/* The number of code bits resolved by a secondary lookup table
+ */
+#define LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS			( LIBESEDB_HUFFMAN_TABLE_MAXIMUM_CODE_SIZE - LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS )
+
+/* The maximum number of secondary lookup tables
+ * A code larger than LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS fills at most half a secondary table
+ */
+#define LIBESEDB_HUFFMAN_TABLE_MAXIMUM_NUMBER_OF_SECONDARY_TABLES	( LIBESEDB_HUFFMAN_TABLE_MAXIMUM_NUMBER_OF_SYMBOLS / 2 )
+
+/* The flag that indicates a lookup table entry refers to a secondary lookup table
+ */
+#define LIBESEDB_HUFFMAN_TABLE_ENTRY_FLAG_SECONDARY		0x8000
+
+typedef struct libesedb_huffman_table libesedb_huffman_table_t;
+
+/* The Huffman table has a fixed size so it can be built on the stack
+ * The lookup table entries contain:
+ * 0 if no code is defined for the bits
+ * ( symbol << 4 ) | code size if a code is defined
+ * LIBESEDB_HUFFMAN_TABLE_ENTRY_FLAG_SECONDARY | secondary table index
+ * if the code is larger than LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS
+ */
+struct libesedb_huffman_table
+{
+	/* The primary lookup table
+	 * contains an entry for every value of the first LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS code bits
+	 */
+	uint16_t primary_table[ 1 << LIBESEDB_HUFFMAN_TABLE_PRIMARY_BITS ];
+
+	/* The secondary lookup tables
+	 * contains an entry for every value of the remaining code bits
+	 */
+	uint16_t secondary_tables[ LIBESEDB_HUFFMAN_TABLE_MAXIMUM_NUMBER_OF_SECONDARY_TABLES << LIBESEDB_HUFFMAN_TABLE_SECONDARY_BITS ];
+
+	/* The number of secondary lookup tables
+	 */
+	int number_of_secondary_tables;
+};
+
+int libesedb_huffman_table_initialize(
+     libesedb_huffman_table_t **huffman_table,
+     liberror_error_t **error );
+
+int libesedb_huffman_table_free(
+     libesedb_huffman_table_t **huffman_table,
+     liberror_error_t **error );
+
+int libesedb_huffman_table_build(
+     libesedb_huffman_table_t *huffman_table,
+     const uint8_t *code_sizes,
+     int number_of_symbols,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
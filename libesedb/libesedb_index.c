@@ -27,6 +27,7 @@
 #include <libnotify.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_cursor.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_index.h"
@@ -47,10 +48,8 @@ int libesedb_index_initialize(
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libesedb_catalog_definition_t *index_catalog_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
      libfdata_tree_t *table_values_tree,
      libfcache_cache_t *table_values_cache,
      libfdata_tree_t *long_values_tree,
@@ -190,7 +189,6 @@ int libesedb_index_initialize(
 	if( libesedb_page_tree_initialize(
 	     &index_page_tree,
 	     io_handle,
-	     pages_vector,
 	     pages_cache,
 	     index_catalog_definition->identifier,
 	     NULL,
@@ -267,9 +265,7 @@ int libesedb_index_initialize(
 	internal_index->table_definition          = table_definition;
 	internal_index->template_table_definition = template_table_definition;
 	internal_index->index_catalog_definition  = index_catalog_definition;
-	internal_index->pages_vector              = pages_vector;
 	internal_index->pages_cache               = pages_cache;
-	internal_index->long_values_pages_vector  = long_values_pages_vector;
 	internal_index->long_values_pages_cache   = long_values_pages_cache;
 	internal_index->table_values_tree         = table_values_tree;
 	internal_index->table_values_cache        = table_values_cache;
@@ -339,7 +335,7 @@ int libesedb_index_free(
 		*index         = NULL;
 
 		/* The io_handle, table_definition, template_table_definition, index_catalog_definition,
-		 * pages_vector, pages_cache, table_values_tree, table_values_cache, long_values_tree
+		 * pages_cache, table_values_tree, table_values_cache, long_values_tree
 		 * and long_values_cache references are freed elsewhere
 		 */
 		if( ( internal_index->flags & LIBESEDB_ITEM_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
@@ -720,13 +716,15 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      liberror_error_t **error )
 {
-	libfdata_tree_node_t *index_values_tree_node          = NULL;
-	libfdata_tree_node_t *record_values_tree_node         = NULL;
-	libesedb_internal_index_t *internal_index             = NULL;
-	libesedb_values_tree_value_t *index_values_tree_value = NULL;
-	uint8_t *index_data                                   = NULL;
-	static char *function                                 = "libesedb_index_get_record";
-	size_t index_data_size                                = 0;
+	libfdata_tree_node_t *index_values_tree_node           = NULL;
+	libfdata_tree_node_t *record_values_tree_node          = NULL;
+	libesedb_internal_index_t *internal_index              = NULL;
+	libesedb_page_t *page                                  = NULL;
+	libesedb_values_tree_value_t *index_values_tree_value  = NULL;
+	libesedb_values_tree_value_t *record_values_tree_value = NULL;
+	uint8_t *index_data                                    = NULL;
+	static char *function                                  = "libesedb_index_get_record";
+	size_t index_data_size                                 = 0;
 
 	if( index == NULL )
 	{
@@ -803,8 +801,8 @@ int libesedb_index_get_record(
 	     index_values_tree_value,
 	     internal_index->file_io_handle,
 	     internal_index->io_handle,
-	     internal_index->pages_vector,
 	     internal_index->pages_cache,
+	     &page,
 	     &index_data,
 	     &index_data_size,
 	     error ) != 1 )
@@ -835,6 +833,42 @@ int libesedb_index_get_record(
 		 "%s: unable to retrieve record values tree node.",
 		 function );
 
+		libesedb_page_cache_release_page(
+		 internal_index->pages_cache,
+		 &page,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_release_page(
+	     internal_index->pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_tree_node_get_node_value(
+	     record_values_tree_node,
+	     internal_index->file_io_handle,
+	     internal_index->table_values_cache,
+	     (intptr_t **) &record_values_tree_value,
+	     0,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node value from record values tree node.",
+		 function );
+
 		return( -1 );
 	}
 	if( libesedb_record_initialize(
@@ -843,14 +877,13 @@ int libesedb_index_get_record(
 	     internal_index->io_handle,
 	     internal_index->table_definition,
 	     internal_index->template_table_definition,
-	     internal_index->pages_vector,
 	     internal_index->pages_cache,
-	     internal_index->long_values_pages_vector,
 	     internal_index->long_values_pages_cache,
-	     record_values_tree_node,
-	     internal_index->table_values_cache,
+	     record_values_tree_value,
 	     internal_index->long_values_tree,
 	     internal_index->long_values_cache,
+	     NULL,
+	     0,
              LIBESEDB_ITEM_FLAGS_DEFAULT,
 	     error ) != 1 )
 	{
@@ -866,3 +899,67 @@ int libesedb_index_get_record(
 	return( 1 );
 }
 
+/* Opens a cursor to sequentially read the records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_open_cursor(
+     libesedb_index_t *index,
+     libesedb_cursor_t **cursor,
+     liberror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                   = "libesedb_index_open_cursor";
+
+	if( index == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_initialize(
+	     cursor,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->table_definition,
+	     internal_index->template_table_definition,
+	     internal_index->pages_cache,
+	     internal_index->long_values_pages_cache,
+	     internal_index->table_values_tree,
+	     internal_index->table_values_cache,
+	     internal_index->long_values_tree,
+	     internal_index->long_values_cache,
+	     internal_index->index_catalog_definition->identifier,
+	     internal_index->index_catalog_definition->father_data_page_number,
+	     LIBESEDB_CURSOR_TYPE_INDEX,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
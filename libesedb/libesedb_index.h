@@ -33,6 +33,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -64,21 +65,13 @@ struct libesedb_internal_index
 	 */
 	libesedb_catalog_definition_t *index_catalog_definition;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
 	/* The pages cache
 	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
+	libesedb_page_cache_t *pages_cache;
 
 	/* The long values pages cache
 	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_page_cache_t *long_values_pages_cache;
 
 	/* The table values tree
 	 */
@@ -116,10 +109,8 @@ int libesedb_index_initialize(
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libesedb_catalog_definition_t *index_catalog_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
      libfdata_tree_t *table_values_tree,
      libfcache_cache_t *table_values_cache,
      libfdata_tree_t *long_values_tree,
@@ -177,6 +168,12 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      liberror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_index_open_cursor(
+     libesedb_index_t *index,
+     libesedb_cursor_t **cursor,
+     liberror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
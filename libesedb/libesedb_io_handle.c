@@ -33,9 +33,6 @@
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
-#include "libesedb_page.h"
 #include "libesedb_unused.h"
 
 #include "esedb_file_header.h"
@@ -102,7 +99,40 @@ int libesedb_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *io_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_init(
+	     &( ( *io_handle )->pages_state_lock ),
+	     NULL ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize pages state lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( pthread_mutex_init(
+	     &( ( *io_handle )->file_io_lock ),
+	     NULL ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO lock.",
+		 function );
+
+		pthread_mutex_destroy(
+		 &( ( *io_handle )->pages_state_lock ) );
+
+		goto on_error;
+	}
+#endif
+	( *io_handle )->ascii_codepage   = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	( *io_handle )->pages_cache_size = LIBESEDB_DEFAULT_PAGES_CACHE_SIZE;
+	( *io_handle )->readahead_window = LIBESEDB_DEFAULT_READAHEAD_WINDOW;
 
 	return( 1 );
 
@@ -140,6 +170,42 @@ int libesedb_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->verified_pages_bitmap != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->verified_pages_bitmap );
+		}
+		if( ( *io_handle )->mismatched_pages_bitmap != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->mismatched_pages_bitmap );
+		}
+#if defined( HAVE_PTHREAD )
+		if( pthread_mutex_destroy(
+		     &( ( *io_handle )->pages_state_lock ) ) != 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy pages state lock.",
+			 function );
+
+			result = -1;
+		}
+		if( pthread_mutex_destroy(
+		     &( ( *io_handle )->file_io_lock ) ) != 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy file IO lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -148,6 +214,178 @@ int libesedb_io_handle_free(
 	return( result );
 }
 
+/* Grabs the pages state lock
+ * The lock guards the pages bitmaps and the read ahead page number
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_grab_pages_state_lock(
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_grab_pages_state_lock";
+
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_lock(
+	     &( io_handle->pages_state_lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to lock pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the pages state lock
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_release_pages_state_lock(
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_release_pages_state_lock";
+
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_unlock(
+	     &( io_handle->pages_state_lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Grabs the file IO lock if the file IO handle does not support concurrent reads
+ * File IO handles that read at an offset without changing their state
+ * are read by multiple threads at the same time
+ * Returns 1 if the lock was grabbed, 0 if not required or -1 on error
+ */
+int libesedb_io_handle_grab_file_io_lock(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_grab_file_io_lock";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_supports_concurrent_reads(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle supports concurrent reads.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_lock(
+	     &( io_handle->file_io_lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to lock file IO lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the file IO lock grabbed by libesedb_io_handle_grab_file_io_lock
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_release_file_io_lock(
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_release_file_io_lock";
+
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_unlock(
+	     &( io_handle->file_io_lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock file IO lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
 /* Sets the pages data range
  * Returns 1 if successful or -1 on error
  */
@@ -184,6 +422,279 @@ int libesedb_io_handle_set_pages_data_range(
 	io_handle->pages_data_size   = file_size - (size64_t) io_handle->pages_data_offset;
 	io_handle->last_page_number  = (uint32_t) ( io_handle->pages_data_size / io_handle->page_size );
 
+	if( io_handle->verified_pages_bitmap != NULL )
+	{
+		memory_free(
+		 io_handle->verified_pages_bitmap );
+
+		io_handle->verified_pages_bitmap = NULL;
+	}
+	if( io_handle->mismatched_pages_bitmap != NULL )
+	{
+		memory_free(
+		 io_handle->mismatched_pages_bitmap );
+
+		io_handle->mismatched_pages_bitmap = NULL;
+	}
+	/* Page numbers start at 1
+	 */
+	io_handle->pages_bitmap_size = (size_t) ( io_handle->last_page_number / 8 ) + 1;
+
+	io_handle->verified_pages_bitmap = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * io_handle->pages_bitmap_size );
+
+	if( io_handle->verified_pages_bitmap == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verified pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     io_handle->verified_pages_bitmap,
+	     0,
+	     sizeof( uint8_t ) * io_handle->pages_bitmap_size ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verified pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->mismatched_pages_bitmap = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * io_handle->pages_bitmap_size );
+
+	if( io_handle->mismatched_pages_bitmap == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mismatched pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     io_handle->mismatched_pages_bitmap,
+	     0,
+	     sizeof( uint8_t ) * io_handle->pages_bitmap_size ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mismatched pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_handle->mismatched_pages_bitmap != NULL )
+	{
+		memory_free(
+		 io_handle->mismatched_pages_bitmap );
+
+		io_handle->mismatched_pages_bitmap = NULL;
+	}
+	if( io_handle->verified_pages_bitmap != NULL )
+	{
+		memory_free(
+		 io_handle->verified_pages_bitmap );
+
+		io_handle->verified_pages_bitmap = NULL;
+	}
+	io_handle->pages_bitmap_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the checksum status of a specific page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_page_checksum_status(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint8_t *checksum_status,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_get_page_checksum_status";
+	size_t bitmap_index   = 0;
+	uint8_t bitmap_mask   = 0;
+
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_status == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum status.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_index = (size_t) ( page_number / 8 );
+	bitmap_mask  = (uint8_t) ( 1 << ( page_number % 8 ) );
+
+	*checksum_status = LIBESEDB_PAGE_CHECKSUM_STATUS_UNVERIFIED;
+
+	/* Pages outside the pages data range are not tracked
+	 */
+	if( ( io_handle->verified_pages_bitmap == NULL )
+	 || ( bitmap_index >= io_handle->pages_bitmap_size ) )
+	{
+		return( 1 );
+	}
+	if( libesedb_io_handle_grab_pages_state_lock(
+	     io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->verified_pages_bitmap[ bitmap_index ] & bitmap_mask ) != 0 )
+	{
+		if( ( io_handle->mismatched_pages_bitmap[ bitmap_index ] & bitmap_mask ) != 0 )
+		{
+			*checksum_status = LIBESEDB_PAGE_CHECKSUM_STATUS_MISMATCH;
+		}
+		else
+		{
+			*checksum_status = LIBESEDB_PAGE_CHECKSUM_STATUS_VALID;
+		}
+	}
+	if( libesedb_io_handle_release_pages_state_lock(
+	     io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the checksum status of a specific page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_set_page_checksum_status(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint8_t checksum_status,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_set_page_checksum_status";
+	size_t bitmap_index   = 0;
+	uint8_t bitmap_mask   = 0;
+
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checksum_status != LIBESEDB_PAGE_CHECKSUM_STATUS_UNVERIFIED )
+	 && ( checksum_status != LIBESEDB_PAGE_CHECKSUM_STATUS_VALID )
+	 && ( checksum_status != LIBESEDB_PAGE_CHECKSUM_STATUS_MISMATCH ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum status: %" PRIu8 ".",
+		 function,
+		 checksum_status );
+
+		return( -1 );
+	}
+	bitmap_index = (size_t) ( page_number / 8 );
+	bitmap_mask  = (uint8_t) ( 1 << ( page_number % 8 ) );
+
+	/* Pages outside the pages data range are not tracked
+	 */
+	if( ( io_handle->verified_pages_bitmap == NULL )
+	 || ( bitmap_index >= io_handle->pages_bitmap_size ) )
+	{
+		return( 1 );
+	}
+	if( libesedb_io_handle_grab_pages_state_lock(
+	     io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_status == LIBESEDB_PAGE_CHECKSUM_STATUS_UNVERIFIED )
+	{
+		io_handle->verified_pages_bitmap[ bitmap_index ] &= ~bitmap_mask;
+	}
+	else
+	{
+		io_handle->verified_pages_bitmap[ bitmap_index ] |= bitmap_mask;
+	}
+	if( checksum_status == LIBESEDB_PAGE_CHECKSUM_STATUS_MISMATCH )
+	{
+		io_handle->mismatched_pages_bitmap[ bitmap_index ] |= bitmap_mask;
+	}
+	else
+	{
+		io_handle->mismatched_pages_bitmap[ bitmap_index ] &= ~bitmap_mask;
+	}
+	if( libesedb_io_handle_release_pages_state_lock(
+	     io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pages state lock.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -233,22 +744,6 @@ int libesedb_io_handle_read_file_header(
 		 file_offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek file header offset: %" PRIi64 ".",
-		 function,
-		 file_offset );
-
-		goto on_error;
-	}
 	file_header_data = (uint8_t *) memory_allocate(
 	                                sizeof( uint8_t ) * read_size );
 
@@ -263,10 +758,11 @@ int libesedb_io_handle_read_file_header(
 
 		goto on_error;
 	}
-	read_count = libbfio_handle_read(
+	read_count = libbfio_handle_read_at(
 	              file_io_handle,
 	              file_header_data,
 	              read_size,
+	              file_offset,
 	              error );
 
 	if( read_count != (ssize_t) read_size )
@@ -275,8 +771,9 @@ int libesedb_io_handle_read_file_header(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_IO,
 		 LIBERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
-		 function );
+		 "%s: unable to read file header at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
 
 		goto on_error;
 	}
@@ -360,6 +857,29 @@ int libesedb_io_handle_read_file_header(
 	 ( (esedb_file_header_t *) file_header_data )->creation_format_revision,
 	 creation_format_revision );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->database_time,
+	 io_handle->database_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->database_state,
+	 io_handle->database_state );
+
+	if( memory_copy(
+	     io_handle->database_signature,
+	     ( (esedb_file_header_t *) file_header_data )->database_signature,
+	     28 ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
 	{
@@ -847,84 +1367,3 @@ on_error:
 	}
 	return( -1 );
 }
-
-/* Reads a page
- * Callback function for the page vector
- * Returns 1 if successful or -1 on error
- */
-int libesedb_io_handle_read_page(
-     intptr_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfcache_cache_t *cache,
-     int element_index,
-     off64_t element_data_offset,
-     size64_t element_data_size LIBESEDB_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBESEDB_ATTRIBUTE_UNUSED,
-     liberror_error_t **error )
-{
-	libesedb_page_t *page = NULL;
-	static char *function = "libesedb_io_handle_read_page";
-
-	LIBESEDB_UNREFERENCED_PARAMETER( element_data_size );
-	LIBESEDB_UNREFERENCED_PARAMETER( read_flags );
-
-	if( libesedb_page_initialize(
-	     &page,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page.",
-		 function );
-
-		goto on_error;
-	}
-	if( libesedb_page_read(
-	     page,
-	     (libesedb_io_handle_t *) io_handle,
-	     file_io_handle,
-	     element_data_offset,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_set_element_value_by_index(
-	     vector,
-	     cache,
-	     element_index,
-	     (intptr_t *) page,
-	     (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set page as element value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( page != NULL )
-	{
-		libesedb_page_free(
-		 &page,
-		 NULL );
-	}
-	return( -1 );
-}
-
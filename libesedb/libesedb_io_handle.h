@@ -27,6 +27,10 @@
 
 #include <liberror.h>
 
+#if defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+#endif
+
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
@@ -61,6 +65,18 @@ struct libesedb_io_handle
 	 */
 	uint32_t creation_format_revision;
 
+	/* The database time
+	 */
+	uint64_t database_time;
+
+	/* The database signature
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* The database state
+	 */
+	uint32_t database_state;
+
 	/* The pages data offset
 	 */
 	off64_t pages_data_offset;
@@ -80,6 +96,49 @@ struct libesedb_io_handle
 	/* The codepage of the ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* The size of the pages cache in bytes
+	 */
+	size64_t pages_cache_size;
+
+	/* The number of leaf pages to read ahead
+	 * 0 disables the read ahead
+	 */
+	uint32_t readahead_window;
+
+	/* The page number of the first page that has not been read ahead
+	 */
+	uint32_t readahead_page_number;
+
+	/* The checksum policy
+	 */
+	uint8_t checksum_policy;
+
+	/* The verified pages bitmap
+	 * Contains a bit per page that is set when the page checksum was calculated
+	 */
+	uint8_t *verified_pages_bitmap;
+
+	/* The mismatched pages bitmap
+	 * Contains a bit per page that is set when the page checksum did not match
+	 */
+	uint8_t *mismatched_pages_bitmap;
+
+	/* The pages bitmap size
+	 */
+	size_t pages_bitmap_size;
+
+#if defined( HAVE_PTHREAD )
+	/* The pages state lock
+	 * Guards the pages bitmaps and the read ahead page number
+	 */
+	pthread_mutex_t pages_state_lock;
+
+	/* The file IO lock
+	 * Serializes the reads from file IO handles that do not support concurrent reads
+	 */
+	pthread_mutex_t file_io_lock;
+#endif
 };
 
 int libesedb_io_handle_initialize(
@@ -90,26 +149,44 @@ int libesedb_io_handle_free(
      libesedb_io_handle_t **io_handle,
      liberror_error_t **error );
 
+int libesedb_io_handle_grab_pages_state_lock(
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error );
+
+int libesedb_io_handle_release_pages_state_lock(
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error );
+
+int libesedb_io_handle_grab_file_io_lock(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     liberror_error_t **error );
+
+int libesedb_io_handle_release_file_io_lock(
+     libesedb_io_handle_t *io_handle,
+     liberror_error_t **error );
+
 int libesedb_io_handle_set_pages_data_range(
      libesedb_io_handle_t *io_handle,
      size64_t file_size,
      liberror_error_t **error );
 
-int libesedb_io_handle_read_file_header(
+int libesedb_io_handle_get_page_checksum_status(
      libesedb_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t page_number,
+     uint8_t *checksum_status,
      liberror_error_t **error );
 
-int libesedb_io_handle_read_page(
-     intptr_t *io_handle,
+int libesedb_io_handle_set_page_checksum_status(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint8_t checksum_status,
+     liberror_error_t **error );
+
+int libesedb_io_handle_read_file_header(
+     libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfcache_cache_t *cache,
-     int element_index,
-     off64_t element_data_offset,
-     size64_t element_data_size,
-     uint8_t read_flags,
+     off64_t file_offset,
      liberror_error_t **error );
 
 #if defined( __cplusplus )
@@ -41,8 +41,7 @@ int libesedb_long_value_initialize(
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
      libesedb_catalog_definition_t *column_catalog_definition,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
      libfdata_tree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
      uint8_t *long_value_key,
@@ -246,7 +245,6 @@ int libesedb_long_value_initialize(
 	if( libesedb_values_tree_value_read_long_value(
 	     values_tree_value,
 	     internal_long_value->file_io_handle,
-	     long_values_pages_vector,
 	     long_values_pages_cache,
 	     error ) != 1 )
 	{
@@ -299,7 +297,6 @@ int libesedb_long_value_initialize(
 			     values_tree_value,
 			     internal_long_value->file_io_handle,
 			     io_handle,
-			     long_values_pages_vector,
 			     long_values_pages_cache,
 			     long_value_segment_offset,
 			     internal_long_value->data_block,
@@ -319,6 +316,7 @@ int libesedb_long_value_initialize(
 	}
 	while( result == 1 );
 
+	internal_long_value->io_handle                 = io_handle;
 	internal_long_value->column_catalog_definition = column_catalog_definition;
 	internal_long_value->flags                     = flags;
 
@@ -500,6 +498,8 @@ int libesedb_long_value_get_segment_data(
 {
 	libesedb_internal_long_value_t *internal_long_value = NULL;
 	static char *function                               = "libesedb_long_value_get_segment_data";
+	int result                                          = 0;
+	int is_locked                                       = 0;
 
 	if( long_value == NULL )
 	{
@@ -514,15 +514,35 @@ int libesedb_long_value_get_segment_data(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
-	if( libfdata_block_get_segment_data(
-	     internal_long_value->data_block,
-	     internal_long_value->file_io_handle,
-	     internal_long_value->data_cache,
-	     data_segment_index,
-	     segment_data,
-	     segment_data_size,
-	     0,
-	     error ) != 1 )
+	/* The segment data is read from the file IO handle on a cache miss
+	 */
+	is_locked = libesedb_io_handle_grab_file_io_lock(
+	             internal_long_value->io_handle,
+	             internal_long_value->file_io_handle,
+	             error );
+
+	if( is_locked == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO lock.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfdata_block_get_segment_data(
+	          internal_long_value->data_block,
+	          internal_long_value->file_io_handle,
+	          internal_long_value->data_cache,
+	          data_segment_index,
+	          segment_data,
+	          segment_data_size,
+	          0,
+	          error );
+
+	if( result != 1 )
 	{
 		liberror_error_set(
 		 error,
@@ -531,8 +551,24 @@ int libesedb_long_value_get_segment_data(
 		 "%s: unable to retrieve segment data.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	return( 1 );
+	if( is_locked != 0 )
+	{
+		if( libesedb_io_handle_release_file_io_lock(
+		     internal_long_value->io_handle,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO lock.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
 }
 
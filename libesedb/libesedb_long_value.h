@@ -33,6 +33,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_types.h"
 
 #if defined( __cplusplus )
@@ -47,6 +48,10 @@ struct libesedb_internal_long_value
 	 */
 	libbfio_handle_t *file_io_handle;
 
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
 	/* The column catalog definition
 	 */
 	libesedb_catalog_definition_t *column_catalog_definition;
@@ -77,8 +82,7 @@ int libesedb_long_value_initialize(
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
      libesedb_catalog_definition_t *column_catalog_definition,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
      libfdata_tree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
      uint8_t *long_value_key,
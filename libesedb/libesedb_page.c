@@ -27,221 +27,15 @@
 #include <liberror.h>
 #include <libnotify.h>
 
-#include "libesedb_array_type.h"
 #include "libesedb_checksum.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_page.h"
+#include "libesedb_page_pool.h"
 
 #include "esedb_page.h"
 
-/* Creates a page value
- * Returns 1 if successful or -1 on error
- */
-int libesedb_page_value_initialize(
-     libesedb_page_value_t **page_value,
-     liberror_error_t **error )
-{
-	static char *function = "libesedb_page_value_initialize";
-
-	if( page_value == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *page_value != NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page value value already set.",
-		 function );
-
-		return( -1 );
-	}
-	*page_value = memory_allocate_structure(
-	               libesedb_page_value_t );
-
-	if( *page_value == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_MEMORY,
-		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page value.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_set(
-	     *page_value,
-	     0,
-	     sizeof( libesedb_page_value_t ) ) == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_MEMORY,
-		 LIBERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear page value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( *page_value != NULL )
-	{
-		memory_free(
-		 *page_value );
-
-		*page_value = NULL;
-	}
-	return( -1 );
-}
-
-/* Frees the page value
- * Returns 1 if successful or -1 on error
- */
-int libesedb_page_value_free(
-     libesedb_page_value_t **page_value,
-     liberror_error_t **error )
-{
-	static char *function = "libesedb_page_value_free";
-
-	if( page_value == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *page_value != NULL )
-	{
-		/* The data is referenced and freed elsewhere
-		 */
-		memory_free(
-		 *page_value );
-
-		*page_value = NULL;
-	}
-	return( 1 );
-}
-
-/* Creates a page tags value
- * Returns 1 if successful or -1 on error
- */
-int libesedb_page_tags_value_initialize(
-     libesedb_page_tags_value_t **page_tags_value,
-     liberror_error_t **error )
-{
-	static char *function = "libesedb_page_tags_value_initialize";
-
-	if( page_tags_value == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *page_tags_value != NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page tags value value already set.",
-		 function );
-
-		return( -1 );
-	}
-	*page_tags_value = memory_allocate_structure(
-	                    libesedb_page_tags_value_t );
-
-	if( *page_tags_value == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_MEMORY,
-		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page tags value.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_set(
-	     *page_tags_value,
-	     0,
-	     sizeof( libesedb_page_tags_value_t ) ) == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_MEMORY,
-		 LIBERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear page tags value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( *page_tags_value != NULL )
-	{
-		memory_free(
-		 *page_tags_value );
-
-		*page_tags_value = NULL;
-	}
-	return( -1 );
-}
-
-/* Frees the page tags value
- * Returns 1 if successful or -1 on error
- */
-int libesedb_page_tags_value_free(
-     libesedb_page_tags_value_t **page_tags_value,
-     liberror_error_t **error )
-{
-	static char *function = "libesedb_page_tags_value_free";
-
-	if( page_tags_value == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *page_tags_value != NULL )
-	{
-		memory_free(
-		 *page_tags_value );
-
-		*page_tags_value = NULL;
-	}
-	return( 1 );
-}
-
 /* Creates a page
  * Returns 1 if successful or -1 on error
  */
@@ -301,20 +95,6 @@ int libesedb_page_initialize(
 
 		goto on_error;
 	}
-	if( libesedb_array_initialize(
-	     &( ( *page )->values_array ),
-	     0,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page values array.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -351,33 +131,81 @@ int libesedb_page_free(
 	}
 	if( *page != NULL )
 	{
-		if( libesedb_array_free(
-		     &( ( *page )->values_array ),
-		     (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_value_free,
-		     error ) != 1 )
+		if( ( *page )->pool != NULL )
 		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the page values array.",
-			 function );
+			if( libesedb_page_pool_release_page(
+			     ( *page )->pool,
+			     *page,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
 		}
-		if( ( *page )->data != NULL )
+		else
 		{
+			/* The page data is either a reference or the page data buffer
+			 */
+			if( ( *page )->buffer != NULL )
+			{
+				memory_free(
+				 ( *page )->buffer );
+			}
+			if( ( *page )->values != NULL )
+			{
+				memory_free(
+				 ( *page )->values );
+			}
 			memory_free(
-			 ( *page )->data );
+			 *page );
 		}
-		memory_free(
-		 *page );
-
 		*page = NULL;
 	}
 	return( result );
 }
 
+/* Clears a page for reuse
+ * The page data buffer and values are kept allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_clear(
+     libesedb_page_t *page,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_clear";
+
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	page->page_number                        = 0;
+	page->previous_page_number               = 0;
+	page->next_page_number                   = 0;
+	page->father_data_page_object_identifier = 0;
+	page->flags                              = 0;
+	page->data                               = NULL;
+	page->data_size                          = 0;
+	page->data_is_reference                  = 0;
+	page->offset                             = 0;
+	page->number_of_values                   = 0;
+	page->reference_count                    = 0;
+
+	return( 1 );
+}
+
 /* Reads a page and its values
  * Returns 1 if successful or -1 on error
  */
@@ -388,8 +216,8 @@ int libesedb_page_read(
      off64_t file_offset,
      liberror_error_t **error )
 {
-	libesedb_array_t *page_tags_array  = NULL;
 	uint8_t *page_values_data          = NULL;
+	void *reallocation                 = NULL;
 	static char *function              = "libesedb_page_read";
 	size_t page_values_data_offset     = 0;
 	size_t page_values_data_size       = 0;
@@ -402,6 +230,9 @@ int libesedb_page_read(
 	uint32_t stored_xor32_checksum     = 0;
 	uint16_t available_data_size       = 0;
 	uint16_t available_page_tag        = 0;
+	uint8_t checksum_status            = 0;
+	uint8_t verify_checksum            = 0;
+	int result                         = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit               = 0;
@@ -456,54 +287,82 @@ int libesedb_page_read(
 		 page->offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     page->offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	page->data_size = (size_t) io_handle->page_size;
+
+	/* Pages with an extended page header are modified when read
+	 * so they cannot reference memory mapped data
+	 */
+	if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 || ( io_handle->page_size < 16384 ) )
 	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek page offset: %" PRIi64 ".",
-		 function,
-		 page->offset );
+		result = libbfio_handle_get_data_reference(
+		          file_io_handle,
+		          page->offset,
+		          page->data_size,
+		          &( page->data ),
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve page data reference.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			page->data_is_reference = 1;
+		}
 	}
-	page->data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->page_size );
-
-	if( page->data == NULL )
+	if( page->data_is_reference == 0 )
 	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_MEMORY,
-		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page data.",
-		 function );
+		/* The page data buffer is reused when the page is recycled
+		 */
+		if( page->buffer_size < page->data_size )
+		{
+			reallocation = memory_reallocate(
+			                page->buffer,
+			                page->data_size );
 
-		goto on_error;
-	}
-	page->data_size = (size_t) io_handle->page_size;
+			if( reallocation == NULL )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_MEMORY,
+				 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize page data buffer.",
+				 function );
 
-	read_count = libbfio_handle_read(
-	              file_io_handle,
-	              page->data,
-	              page->data_size,
-	              error );
+				goto on_error;
+			}
+			page->buffer      = (uint8_t *) reallocation;
+			page->buffer_size = page->data_size;
+		}
+		page->data = page->buffer;
 
-	if( read_count != (ssize_t) page->data_size )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page data.",
-		 function );
+		read_count = libbfio_handle_read_at(
+		              file_io_handle,
+		              page->data,
+		              page->data_size,
+		              page->offset,
+		              error );
 
-		goto on_error;
+		if( read_count != (ssize_t) page->data_size )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page data at offset: %" PRIi64 ".",
+			 function,
+			 page->offset );
+
+			goto on_error;
+		}
 	}
 	page_values_data      = page->data;
 	page_values_data_size = page->data_size;
@@ -670,13 +529,47 @@ int libesedb_page_read(
 		 "\n" );
 	}
 #endif
+	/* Determine if the page checksum needs to be verified
+	 */
+	verify_checksum = 1;
+
+	if( io_handle->checksum_policy == LIBESEDB_CHECKSUM_POLICY_NEVER )
+	{
+		verify_checksum = 0;
+	}
+	else if( io_handle->checksum_policy == LIBESEDB_CHECKSUM_POLICY_ONCE )
+	{
+		if( libesedb_io_handle_get_page_checksum_status(
+		     io_handle,
+		     calculated_page_number,
+		     &checksum_status,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve checksum status of page: %" PRIu32 ".",
+			 function,
+			 calculated_page_number );
+
+			goto on_error;
+		}
+		if( checksum_status != LIBESEDB_PAGE_CHECKSUM_STATUS_UNVERIFIED )
+		{
+			verify_checksum = 0;
+		}
+	}
 	/* TODO for now don't bother calculating a checksum for uninitialized pages */
 
-	if( ( page_values_data[ 0 ] != 0 )
-	 || ( page_values_data[ 1 ] != 0 )
-	 || ( page_values_data[ 2 ] != 0 )
-	 || ( page_values_data[ 3 ] != 0 ) )
+	if( ( verify_checksum != 0 )
+	 && ( ( page_values_data[ 0 ] != 0 )
+	  || ( page_values_data[ 1 ] != 0 )
+	  || ( page_values_data[ 2 ] != 0 )
+	  || ( page_values_data[ 3 ] != 0 ) ) )
 	{
+		checksum_status = LIBESEDB_PAGE_CHECKSUM_STATUS_VALID;
+
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
@@ -725,6 +618,8 @@ int libesedb_page_read(
 		}
 		if( stored_xor32_checksum != calculated_xor32_checksum )
 		{
+			checksum_status = LIBESEDB_PAGE_CHECKSUM_STATUS_MISMATCH;
+
 #ifdef TODO
 			liberror_error_set(
 			 error,
@@ -749,6 +644,8 @@ int libesedb_page_read(
 		}
 		if( stored_ecc32_checksum != calculated_ecc32_checksum )
 		{
+			checksum_status = LIBESEDB_PAGE_CHECKSUM_STATUS_MISMATCH;
+
 #ifdef TODO
 			liberror_error_set(
 			 error,
@@ -771,6 +668,28 @@ int libesedb_page_read(
 			}
 #endif
 		}
+		/* The checksum of pages with an extended page header is not calculated yet
+		 */
+		if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+		 || ( io_handle->page_size < 16384 ) )
+		{
+			if( libesedb_io_handle_set_page_checksum_status(
+			     io_handle,
+			     calculated_page_number,
+			     checksum_status,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set checksum status of page: %" PRIu32 ".",
+				 function,
+				 calculated_page_number );
+
+				goto on_error;
+			}
+		}
 	}
 	page_values_data        += sizeof( esedb_page_header_t );
 	page_values_data_size   -= sizeof( esedb_page_header_t );
@@ -839,24 +758,8 @@ int libesedb_page_read(
 	}
 	if( available_page_tag > 0 )
 	{
-		/* Create the page tags array
-		 */
-		if( libesedb_array_initialize(
-		     &page_tags_array,
-		     0,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tags array.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_read_tags(
-		     page_tags_array,
+		     page,
 		     io_handle,
 		     available_page_tag,
 		     page->data,
@@ -877,7 +780,6 @@ int libesedb_page_read(
 		if( libesedb_page_read_values(
 		     page,
 		     io_handle,
-		     page_tags_array,
 		     page_values_data,
 		     page_values_data_size,
 		     page_values_data_offset,
@@ -892,70 +794,198 @@ int libesedb_page_read(
 
 			goto on_error;
 		}
-		if( libesedb_array_free(
-		     &page_tags_array,
-		     (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_tags_value_free,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the page tags array.",
-			 function );
-
-			goto on_error;
-		}
 	}
 	return( 1 );
 
 on_error:
-	if( page_tags_array != NULL )
+	page->data              = NULL;
+	page->data_is_reference = 0;
+	page->number_of_values  = 0;
+
+	return( -1 );
+}
+
+/* Reads ahead the leaf pages that follow a specific leaf page
+ * The read ahead is only issued when the next page of the leaf page
+ * directly follows it in the file, i.e. when the leaf pages are read sequentially
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_readahead(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     liberror_error_t **error )
+{
+	static char *function      = "libesedb_page_readahead";
+	off64_t readahead_offset   = 0;
+	size64_t readahead_size    = 0;
+	uint32_t first_page_number = 0;
+	uint32_t last_page_number  = 0;
+
+	if( page == NULL )
 	{
-		libesedb_array_free(
-		 &page_tags_array,
-		 (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_tags_value_free,
-		 NULL );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
 	}
-	if( page->data != NULL )
+	if( io_handle == NULL )
 	{
-		memory_free(
-		 page->data );
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-		page->data = NULL;
+		return( -1 );
 	}
-	return( -1 );
+	if( io_handle->readahead_window == 0 )
+	{
+		return( 1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	{
+		return( 1 );
+	}
+	if( ( page->next_page_number == 0 )
+	 || ( page->next_page_number != ( page->page_number + 1 ) )
+	 || ( page->next_page_number > io_handle->last_page_number ) )
+	{
+		return( 1 );
+	}
+	if( libesedb_io_handle_grab_pages_state_lock(
+	     io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+	first_page_number = page->next_page_number;
+
+	/* The pages within the previous read ahead window are not read ahead again
+	 * the window is only extended when less than half of it remains
+	 */
+	if( ( io_handle->readahead_page_number > first_page_number )
+	 && ( ( io_handle->readahead_page_number - first_page_number ) <= io_handle->readahead_window ) )
+	{
+		if( ( io_handle->readahead_page_number - first_page_number ) > ( io_handle->readahead_window / 2 ) )
+		{
+			first_page_number = 0;
+		}
+		else
+		{
+			first_page_number = io_handle->readahead_page_number;
+		}
+	}
+	if( io_handle->readahead_window > ( io_handle->last_page_number - page->next_page_number ) )
+	{
+		last_page_number = io_handle->last_page_number;
+	}
+	else
+	{
+		last_page_number = page->next_page_number + io_handle->readahead_window - 1;
+	}
+	/* The window is claimed before the pages are read ahead
+	 * so that concurrent readers do not read ahead the same pages
+	 */
+	if( ( first_page_number != 0 )
+	 && ( first_page_number <= last_page_number ) )
+	{
+		io_handle->readahead_page_number = last_page_number + 1;
+	}
+	if( libesedb_io_handle_release_pages_state_lock(
+	     io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pages state lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_page_number == 0 )
+	 || ( first_page_number > last_page_number ) )
+	{
+		return( 1 );
+	}
+	readahead_offset = io_handle->pages_data_offset
+	                 + ( (off64_t) ( first_page_number - 1 ) * io_handle->page_size );
+	readahead_size   = (size64_t) ( last_page_number - first_page_number + 1 ) * io_handle->page_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libnotify_verbose != 0 )
+	{
+		libnotify_printf(
+		 "%s: reading ahead pages: %" PRIu32 " - %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 first_page_number,
+		 last_page_number,
+		 readahead_offset,
+		 readahead_offset );
+	}
+#endif
+	if( libbfio_handle_prefetch(
+	     file_io_handle,
+	     readahead_offset,
+	     readahead_size,
+	     error ) == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ahead pages: %" PRIu32 " - %" PRIu32 ".",
+		 function,
+		 first_page_number,
+		 last_page_number );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
 /* Reads the page tags
+ * The page tags are stored as the page values, the value data is set by libesedb_page_read_values
  * Returns 1 if successful or -1 on error
  */
 int libesedb_page_read_tags(
-     libesedb_array_t *page_tags_array,
+     libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
      uint16_t number_of_page_tags,
      uint8_t *page_data,
      size_t page_data_size,
      liberror_error_t **error )
 {
-	libesedb_page_tags_value_t *page_tags_value = NULL;
-	uint8_t *page_tags_data                     = NULL;
-	static char *function                       = "libesedb_page_read_tags";
-	uint16_t page_tag_offset                    = 0;
-	uint16_t page_tag_size                      = 0;
-	uint16_t page_tags_index                    = 0;
+	libesedb_page_value_t *page_value = NULL;
+	uint8_t *page_tags_data           = NULL;
+	void *reallocation                = NULL;
+	static char *function             = "libesedb_page_read_tags";
+	size_t page_tags_data_size        = 0;
+	uint16_t page_tag_offset          = 0;
+	uint16_t page_tag_size            = 0;
+	uint16_t page_tags_index          = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	size_t page_tags_data_size                  = 0;
-#endif
-
-	if( page_tags_array == NULL )
+	if( page == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags array.",
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
@@ -993,26 +1023,46 @@ int libesedb_page_read_tags(
 
 		return( -1 );
 	}
-	if( libesedb_array_resize(
-	     page_tags_array,
-	     number_of_page_tags,
-	     (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_tags_value_free,
-	     error ) != 1 )
+	page_tags_data_size = 4 * (size_t) number_of_page_tags;
+
+	if( page_tags_data_size > page_data_size )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize page tags array.",
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of page tags value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	/* The page values are reused when the page is recycled
+	 */
+	if( page->number_of_allocated_values < number_of_page_tags )
+	{
+		reallocation = memory_reallocate(
+		                page->values,
+		                sizeof( libesedb_page_value_t ) * number_of_page_tags );
+
+		if( reallocation == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize page values.",
+			 function );
+
+			return( -1 );
+		}
+		page->values                     = (libesedb_page_value_t *) reallocation;
+		page->number_of_allocated_values = number_of_page_tags;
 	}
+	page->number_of_values = 0;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
 	{
-		page_tags_data_size = 4 * number_of_page_tags;
-
 		libnotify_printf(
 		 "%s: page tags:\n",
 		 function );
@@ -1029,19 +1079,8 @@ int libesedb_page_read_tags(
 	     page_tags_index < number_of_page_tags;
 	     page_tags_index++ )
 	{
-		if( libesedb_page_tags_value_initialize(
-		     &page_tags_value,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tags value.",
-			 function );
+		page_value = &( page->values[ page_tags_index ] );
 
-			goto on_error;
-		}
 		byte_stream_copy_to_uint16_little_endian(
 		 page_tags_data,
 		 page_tag_offset );
@@ -1054,18 +1093,20 @@ int libesedb_page_read_tags(
 
 		page_tags_data -= 2;
 
+		page_value->data = NULL;
+
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
-			page_tags_value->flags  = 0;
-			page_tags_value->offset = page_tag_offset & 0x7fff;
-			page_tags_value->size   = page_tag_size & 0x7fff;;
+			page_value->flags  = 0;
+			page_value->offset = page_tag_offset & 0x7fff;
+			page_value->size   = page_tag_size & 0x7fff;
 		}
 		else
 		{
-			page_tags_value->flags  = page_tag_offset >> 13;
-			page_tags_value->offset = page_tag_offset & 0x1fff;
-			page_tags_value->size   = page_tag_size & 0x1fff;
+			page_value->flags  = (uint8_t) ( page_tag_offset >> 13 );
+			page_value->offset = page_tag_offset & 0x1fff;
+			page_value->size   = page_tag_size & 0x1fff;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
@@ -1074,14 +1115,14 @@ int libesedb_page_read_tags(
 			 "%s: page tag: %03" PRIu16 " offset\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
 			 function,
 			 page_tags_index,
-			 page_tags_value->offset,
+			 page_value->offset,
 			 page_tag_offset );
 
 			libnotify_printf(
 			 "%s: page tag: %03" PRIu16 " size\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
 			 function,
 			 page_tags_index,
-			 page_tags_value->size,
+			 page_value->size,
 			 page_tag_size );
 
 			if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
@@ -1091,32 +1132,17 @@ int libesedb_page_read_tags(
 				 "%s: page tag: %03" PRIu16 " flags\t\t\t\t: 0x%02" PRIx8 "",
 				 function,
 				 page_tags_index,
-				 page_tags_value->flags );
+				 page_value->flags );
 				libesedb_debug_print_page_tag_flags(
-				 page_tags_value->flags );
+				 page_value->flags );
 				libnotify_printf(
 				 "\n" );
 			}
 		}
 #endif
-		if( libesedb_array_set_entry_by_index(
-		     page_tags_array,
-		     (int) page_tags_index,
-		     (intptr_t *) page_tags_value,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set page tag: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
-		}
-		page_tags_value = NULL;
 	}
+	page->number_of_values = number_of_page_tags;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
 	{
@@ -1125,33 +1151,23 @@ int libesedb_page_read_tags(
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( page_tags_value != NULL )
-	{
-		libesedb_page_tags_value_free(
-		 &page_tags_value,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Reads the page values
+ * The page tags must have been read before by libesedb_page_read_tags
  * Returns 1 if successful or -1 on error
  */
 int libesedb_page_read_values(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
-     libesedb_array_t *page_tags_array,
      uint8_t *page_values_data,
      size_t page_values_data_size,
      size_t page_values_data_offset,
      liberror_error_t **error )
 {
-	libesedb_page_tags_value_t *page_tags_value = NULL;
-	libesedb_page_value_t *page_value           = NULL;
-	static char *function                       = "libesedb_page_read_values";
-	uint16_t page_tags_index                    = 0;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_page_read_values";
+	uint16_t page_tags_index          = 0;
 
 	if( page == NULL )
 	{
@@ -1164,13 +1180,14 @@ int libesedb_page_read_values(
 
 		return( -1 );
 	}
-	if( page->values_array == NULL )
+	if( ( page->values == NULL )
+	 && ( page->number_of_values > 0 ) )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid page  - missing values array.",
+		 "%s: invalid page - missing values.",
 		 function );
 
 		return( -1 );
@@ -1186,17 +1203,6 @@ int libesedb_page_read_values(
 
 		return( -1 );
 	}
-	if( page_tags_array == NULL )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags array.",
-		 function );
-
-		return( -1 );
-	}
 	if( page_values_data == NULL )
 	{
 		liberror_error_set(
@@ -1219,73 +1225,20 @@ int libesedb_page_read_values(
 
 		return( -1 );
 	}
-	if( libesedb_array_resize(
-	     page->values_array,
-	     page_tags_array->number_of_entries,
-	     (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_value_free,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize page values array.",
-		 function );
-
-		goto on_error;
-	}
 	for( page_tags_index = 0;
-	     page_tags_index < page_tags_array->number_of_entries;
+	     page_tags_index < page->number_of_values;
 	     page_tags_index++ )
 	{
-		if( libesedb_array_get_entry_by_index(
-		     page_tags_array,
-		     page_tags_index,
-		     (intptr_t **) &page_tags_value,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page tag: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
-		}
-		if( page_tags_value == NULL )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid page tags value.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_page_value_initialize(
-		     &page_value,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create tags value.",
-			 function );
+		page_value = &( page->values[ page_tags_index ] );
 
-			goto on_error;
-		}
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
 			/* The page tags flags are stored in the upper byte of the first 16-bit value
 			 */
-			page_tags_value->flags = page_values_data[ page_tags_value->offset + 1 ] >> 5;
+			page_value->flags = page_values_data[ page_value->offset + 1 ] >> 5;
 
-			page_values_data[ page_tags_value->offset + 1 ] &= 0x1f;
+			page_values_data[ page_value->offset + 1 ] &= 0x1f;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
@@ -1294,39 +1247,19 @@ int libesedb_page_read_values(
 			 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 ", flags: 0x%02" PRIx8 "",
 			 function,
 			 page_tags_index,
-			 page_tags_value->offset,
-			 page_tags_value->size,
-			 page_tags_value->flags );
+			 page_value->offset,
+			 page_value->size,
+			 page_value->flags );
 			libesedb_debug_print_page_tag_flags(
-			 page_tags_value->flags );
+			 page_value->flags );
 			libnotify_printf(
 			 "\n" );
 		}
 #endif
 		/* TODO check sanity of offset and size */
 
-		page_value->data   = &( page_values_data[ page_tags_value->offset ] );
-		page_value->offset = (uint16_t) ( page_values_data_offset + page_tags_value->offset );
-		page_value->size   = page_tags_value->size;
-		page_value->flags  = page_tags_value->flags;
-
-		if( libesedb_array_set_entry_by_index(
-		     page->values_array,
-		     (int) page_tags_index,
-		     (intptr_t *) page_value,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set page value: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
-		}
-		page_value = NULL;
+		page_value->data   = &( page_values_data[ page_value->offset ] );
+		page_value->offset = (uint16_t) ( page_values_data_offset + page_value->offset );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
@@ -1336,15 +1269,6 @@ int libesedb_page_read_values(
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( page_value != NULL )
-	{
-		libesedb_page_value_free(
-		 &page_value,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the number of page values
@@ -1355,8 +1279,7 @@ int libesedb_page_get_number_of_values(
      uint16_t *number_of_values,
      liberror_error_t **error )
 {
-	static char *function     = "libesedb_page_get_number_of_values";
-	int page_number_of_values = 0;
+	static char *function = "libesedb_page_get_number_of_values";
 
 	if( page == NULL )
 	{
@@ -1380,32 +1303,7 @@ int libesedb_page_get_number_of_values(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_number_of_entries(
-	     page->values_array,
-	     &page_number_of_values,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
-		 function );
-
-		return( -1 );
-	}
-	if( page_number_of_values > (int) UINT16_MAX )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid number of page values value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	*number_of_values = (uint16_t) page_number_of_values;
+	*number_of_values = page->number_of_values;
 
 	return( 1 );
 }
@@ -1432,22 +1330,30 @@ int libesedb_page_get_value(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     page->values_array,
-	     (int) value_index,
-	     (intptr_t **) page_value,
-	     error ) != 1 )
+	if( value_index >= page->number_of_values )
 	{
 		liberror_error_set(
 		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page value: %" PRIu16 ".",
-		 function,
-		 value_index );
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
 
 		return( -1 );
 	}
+	*page_value = &( page->values[ value_index ] );
+
 	return( 1 );
 }
 
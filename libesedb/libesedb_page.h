@@ -27,7 +27,6 @@
 
 #include <liberror.h>
 
-#include "libesedb_array_type.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 
@@ -35,23 +34,6 @@
 extern "C" {
 #endif
 
-typedef struct libesedb_page_tags_value libesedb_page_tags_value_t;
-
-struct libesedb_page_tags_value
-{
-	/* The offset of the value
-	 */
-	uint16_t offset;
-
-	/* The size of the value
-	 */
-	uint16_t size;
-
-	/* The flags of the value
-	 */
-	uint8_t flags;
-};
-
 typedef struct libesedb_page_value libesedb_page_value_t;
 
 struct libesedb_page_value
@@ -74,6 +56,7 @@ struct libesedb_page_value
 };
 
 typedef struct libesedb_page libesedb_page_t;
+typedef struct libesedb_page_pool libesedb_page_pool_t;
 
 struct libesedb_page
 {
@@ -105,30 +88,46 @@ struct libesedb_page
 	 */
 	size_t data_size;
 
+	/* Value to indicate the page data is a reference
+	 * to memory mapped data that is not managed by the page
+	 */
+	uint8_t data_is_reference;
+
+	/* The page data buffer
+	 * The buffer is kept when the page is recycled
+	 */
+	uint8_t *buffer;
+
+	/* The page data buffer size
+	 */
+	size_t buffer_size;
+
 	/* The file offset of the page
 	 */
 	off64_t offset;
 
-	/* The page values array
+	/* The page values
 	 */
-	libesedb_array_t *values_array;
-};
+	libesedb_page_value_t *values;
 
-int libesedb_page_value_initialize(
-     libesedb_page_value_t **page_value,
-     liberror_error_t **error );
+	/* The number of page values
+	 */
+	uint16_t number_of_values;
 
-int libesedb_page_value_free(
-     libesedb_page_value_t **page_value,
-     liberror_error_t **error );
+	/* The number of allocated page values
+	 */
+	uint16_t number_of_allocated_values;
 
-int libesedb_page_tags_value_initialize(
-     libesedb_page_tags_value_t **page_tags_value,
-     liberror_error_t **error );
+	/* The page pool the page was obtained from
+	 */
+	libesedb_page_pool_t *pool;
 
-int libesedb_page_tags_value_free(
-     libesedb_page_tags_value_t **page_tags_value,
-     liberror_error_t **error );
+	/* The number of references to the page
+	 * The pages cache holds a reference while the page is cached
+	 * and every reader while it uses the page
+	 */
+	int reference_count;
+};
 
 int libesedb_page_initialize(
      libesedb_page_t **page,
@@ -138,6 +137,10 @@ int libesedb_page_free(
      libesedb_page_t **page,
      liberror_error_t **error );
 
+int libesedb_page_clear(
+     libesedb_page_t *page,
+     liberror_error_t **error );
+
 int libesedb_page_read(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
@@ -145,8 +148,14 @@ int libesedb_page_read(
      off64_t file_offset,
      liberror_error_t **error );
 
+int libesedb_page_readahead(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     liberror_error_t **error );
+
 int libesedb_page_read_tags(
-     libesedb_array_t *page_tags_array,
+     libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
      uint16_t number_of_page_tags,
      uint8_t *page_data,
@@ -156,7 +165,6 @@ int libesedb_page_read_tags(
 int libesedb_page_read_values(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
-     libesedb_array_t *page_tags_array,
      uint8_t *page_values_data,
      size_t page_values_data_size,
      size_t page_values_data_offset,
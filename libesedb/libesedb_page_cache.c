@@ -0,0 +1,1042 @@
+/*
+ * Page cache functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_page.h"
+#include "libesedb_page_cache.h"
+#include "libesedb_page_pool.h"
+
+/* Creates a page cache
+ * The pages are divided over shards by their page number, every shard has
+ * its own cache, page pool and lock so that pages in different shards
+ * are retrieved at the same time
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_initialize(
+     libesedb_page_cache_t **page_cache,
+     libesedb_io_handle_t *io_handle,
+     int maximum_cache_entries,
+     liberror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	static char *function              = "libesedb_page_cache_initialize";
+	size_t shards_size                 = 0;
+	int maximum_pool_entries           = 0;
+	int maximum_shard_entries          = 0;
+	int shard_index                    = 0;
+
+	if( page_cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_cache != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->page_size == 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_entries <= 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*page_cache = memory_allocate_structure(
+	               libesedb_page_cache_t );
+
+	if( *page_cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_cache,
+	     0,
+	     sizeof( libesedb_page_cache_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page cache.",
+		 function );
+
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+
+		return( -1 );
+	}
+	shards_size = sizeof( libesedb_page_cache_shard_t ) * LIBESEDB_NUMBER_OF_PAGES_CACHE_SHARDS;
+
+	( *page_cache )->shards = (libesedb_page_cache_shard_t *) memory_allocate(
+	                                                           shards_size );
+
+	if( ( *page_cache )->shards == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *page_cache )->shards,
+	     0,
+	     shards_size ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cache entries and pool entries are divided over the shards
+	 */
+	maximum_shard_entries = maximum_cache_entries / LIBESEDB_NUMBER_OF_PAGES_CACHE_SHARDS;
+
+	if( maximum_shard_entries < LIBFCACHE_CACHE_NUMBER_OF_WAYS )
+	{
+		maximum_shard_entries = LIBFCACHE_CACHE_NUMBER_OF_WAYS;
+	}
+	maximum_pool_entries = LIBESEDB_MAXIMUM_POOL_ENTRIES_PAGES / LIBESEDB_NUMBER_OF_PAGES_CACHE_SHARDS;
+
+	if( maximum_pool_entries < 1 )
+	{
+		maximum_pool_entries = 1;
+	}
+	for( shard_index = 0;
+	     shard_index < LIBESEDB_NUMBER_OF_PAGES_CACHE_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( ( *page_cache )->shards[ shard_index ] );
+
+		if( libfcache_cache_initialize(
+		     &( shard->cache ),
+		     maximum_shard_entries,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( libesedb_page_pool_initialize(
+		     &( shard->page_pool ),
+		     maximum_pool_entries,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page pool of shard: %d.",
+			 function,
+			 shard_index );
+
+			libfcache_cache_free(
+			 &( shard->cache ),
+			 NULL );
+
+			goto on_error;
+		}
+#if defined( HAVE_PTHREAD )
+		if( pthread_mutex_init(
+		     &( shard->lock ),
+		     NULL ) != 0 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize lock of shard: %d.",
+			 function,
+			 shard_index );
+
+			libesedb_page_pool_free(
+			 &( shard->page_pool ),
+			 NULL );
+			libfcache_cache_free(
+			 &( shard->cache ),
+			 NULL );
+
+			goto on_error;
+		}
+#endif
+		( *page_cache )->number_of_shards += 1;
+	}
+	( *page_cache )->io_handle = io_handle;
+
+	return( 1 );
+
+on_error:
+	if( *page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 page_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a page cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_free(
+     libesedb_page_cache_t **page_cache,
+     liberror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	static char *function              = "libesedb_page_cache_free";
+	int result                         = 1;
+	int shard_index                    = 0;
+
+	if( page_cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_cache != NULL )
+	{
+		/* The io_handle reference is freed elsewhere
+		 */
+		for( shard_index = 0;
+		     shard_index < ( *page_cache )->number_of_shards;
+		     shard_index++ )
+		{
+			shard = &( ( *page_cache )->shards[ shard_index ] );
+
+			/* The cache is freed before the page pool since it releases
+			 * the cached pages to the page pool
+			 */
+			if( libfcache_cache_free(
+			     &( shard->cache ),
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free cache of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+			if( libesedb_page_pool_free(
+			     &( shard->page_pool ),
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page pool of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+#if defined( HAVE_PTHREAD )
+			if( pthread_mutex_destroy(
+			     &( shard->lock ) ) != 0 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to destroy lock of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+#endif
+		}
+		if( ( *page_cache )->shards != NULL )
+		{
+			memory_free(
+			 ( *page_cache )->shards );
+		}
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the shard of a specific page offset
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_get_shard(
+     libesedb_page_cache_t *page_cache,
+     off64_t page_offset,
+     libesedb_page_cache_shard_t **shard,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_cache_get_shard";
+	int shard_index       = 0;
+
+	if( page_cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_cache->number_of_shards <= 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page cache - number of shards value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_offset < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid page offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive pages are assigned to different shards
+	 */
+	shard_index = (int) ( ( (uint64_t) page_offset / page_cache->io_handle->page_size )
+	                    % (uint64_t) page_cache->number_of_shards );
+
+	*shard = &( page_cache->shards[ shard_index ] );
+
+	return( 1 );
+}
+
+/* Grabs the lock of a shard
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_shard_grab_lock(
+     libesedb_page_cache_shard_t *shard,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_cache_shard_grab_lock";
+
+	if( shard == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_lock(
+	     &( shard->lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to lock shard.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the lock of a shard
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_shard_release_lock(
+     libesedb_page_cache_shard_t *shard,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_cache_shard_release_lock";
+
+	if( shard == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PTHREAD )
+	if( pthread_mutex_unlock(
+	     &( shard->lock ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock shard.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Looks up a page in a shard and references it
+ * The lock of the shard must be held
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libesedb_page_cache_shard_reference_page(
+     libesedb_page_cache_shard_t *shard,
+     off64_t page_offset,
+     libesedb_page_t **page,
+     liberror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libesedb_page_t *cached_page         = NULL;
+	static char *function                = "libesedb_page_cache_shard_reference_page";
+	int result                           = 0;
+
+	if( shard == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          shard->cache,
+	          page_offset,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) &cached_page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page from cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_page == NULL )
+	{
+		return( 0 );
+	}
+	cached_page->reference_count += 1;
+
+	*page = cached_page;
+
+	return( 1 );
+}
+
+/* Dereferences a page and releases it to its page pool when it is no longer referenced
+ * The lock of the shard of the page must be held
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_dereference_page(
+     libesedb_page_t **page,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_cache_dereference_page";
+
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page != NULL )
+	{
+		if( ( *page )->reference_count > 1 )
+		{
+			( *page )->reference_count -= 1;
+		}
+		else
+		{
+			( *page )->reference_count = 0;
+
+			if( libesedb_page_free(
+			     page,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		*page = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific page
+ * The page offset is relative to the start of the pages data
+ * The page is referenced and must be released with libesedb_page_cache_release_page
+ * The shard lock is only held while the cache is searched and updated,
+ * the page is read without holding it
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_get_page(
+     libesedb_page_cache_t *page_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t page_offset,
+     libesedb_page_t **page,
+     liberror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	libesedb_page_t *cached_page       = NULL;
+	libesedb_page_t *read_page         = NULL;
+	static char *function              = "libesedb_page_cache_get_page";
+	off64_t file_offset                = 0;
+	int is_locked                      = 0;
+	int result                         = 0;
+
+	if( page_cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_offset < 0 )
+	 || ( (size64_t) page_offset >= page_cache->io_handle->pages_data_size ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_get_shard(
+	     page_cache,
+	     page_offset,
+	     &shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shard of page at offset: %" PRIi64 ".",
+		 function,
+		 page_offset );
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_shard_grab_lock(
+	     shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard lock.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_cache_shard_reference_page(
+	          shard,
+	          page_offset,
+	          &cached_page,
+	          error );
+
+	/* Pages are recycled by the page pool when released by the cache
+	 */
+	if( result == 0 )
+	{
+		if( libesedb_page_pool_get_page(
+		     shard->page_pool,
+		     &read_page,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( libesedb_page_cache_shard_release_lock(
+	     shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard lock.",
+		 function );
+
+		result = -1;
+	}
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page at offset: %" PRIi64 ".",
+		 function,
+		 page_offset );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*page = cached_page;
+
+		return( 1 );
+	}
+	is_locked = libesedb_io_handle_grab_file_io_lock(
+	             page_cache->io_handle,
+	             file_io_handle,
+	             error );
+
+	if( is_locked == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO lock.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = page_cache->io_handle->pages_data_offset + page_offset;
+
+	result = libesedb_page_read(
+	          read_page,
+	          page_cache->io_handle,
+	          file_io_handle,
+	          file_offset,
+	          error );
+
+	if( result != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page at offset: %" PRIi64 ".",
+		 function,
+		 page_offset );
+
+		result = -1;
+	}
+	if( is_locked != 0 )
+	{
+		if( libesedb_io_handle_release_file_io_lock(
+		     page_cache->io_handle,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO lock.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_page_readahead(
+	     read_page,
+	     page_cache->io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_IO,
+		 LIBERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ahead pages.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_cache_shard_grab_lock(
+	     shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard lock.",
+		 function );
+
+		goto on_error;
+	}
+	/* Another thread could have cached the same page while it was read
+	 */
+	result = libesedb_page_cache_shard_reference_page(
+	          shard,
+	          page_offset,
+	          &cached_page,
+	          error );
+
+	if( result == 0 )
+	{
+		/* The cache holds one reference and the caller the other
+		 */
+		read_page->reference_count = 2;
+
+		result = libfcache_cache_set_value_by_identifier(
+		          shard->cache,
+		          page_offset,
+		          0,
+		          (intptr_t *) read_page,
+		          (int (*)(intptr_t **, liberror_error_t **)) &libesedb_page_cache_dereference_page,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          error );
+
+		if( result == 1 )
+		{
+			cached_page = read_page;
+			read_page   = NULL;
+		}
+		else
+		{
+			read_page->reference_count = 0;
+		}
+	}
+	if( read_page != NULL )
+	{
+		if( libesedb_page_free(
+		     &read_page,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( libesedb_page_cache_shard_release_lock(
+	     shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == -1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set page at offset: %" PRIi64 " in cache.",
+		 function,
+		 page_offset );
+
+		return( -1 );
+	}
+	*page = cached_page;
+
+	return( 1 );
+
+on_error:
+	if( read_page != NULL )
+	{
+		if( libesedb_page_cache_shard_grab_lock(
+		     shard,
+		     NULL ) == 1 )
+		{
+			libesedb_page_free(
+			 &read_page,
+			 NULL );
+
+			libesedb_page_cache_shard_release_lock(
+			 shard,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Releases a page retrieved by libesedb_page_cache_get_page
+ * The page remains available while it is cached or referenced by other readers
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_release_page(
+     libesedb_page_cache_t *page_cache,
+     libesedb_page_t **page,
+     liberror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	static char *function              = "libesedb_page_cache_release_page";
+	off64_t page_offset                = 0;
+	int result                         = 1;
+
+	if( page_cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		return( 1 );
+	}
+	page_offset = ( *page )->offset - page_cache->io_handle->pages_data_offset;
+
+	if( libesedb_page_cache_get_shard(
+	     page_cache,
+	     page_offset,
+	     &shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shard of page at offset: %" PRIi64 ".",
+		 function,
+		 page_offset );
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_shard_grab_lock(
+	     shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_dereference_page(
+	     page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to dereference page.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_page_cache_shard_release_lock(
+	     shard,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard lock.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,132 @@
+/*
+ * Page cache functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_CACHE_H )
+#define _LIBESEDB_PAGE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#if defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+#endif
+
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_page.h"
+#include "libesedb_page_pool.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_cache_shard libesedb_page_cache_shard_t;
+
+struct libesedb_page_cache_shard
+{
+	/* The cache
+	 */
+	libfcache_cache_t *cache;
+
+	/* The page pool
+	 */
+	libesedb_page_pool_t *page_pool;
+
+#if defined( HAVE_PTHREAD )
+	/* The lock
+	 * Guards the cache, the page pool and the reference counts of the pages of the shard
+	 */
+	pthread_mutex_t lock;
+#endif
+};
+
+typedef struct libesedb_page_cache libesedb_page_cache_t;
+
+struct libesedb_page_cache
+{
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The shards
+	 */
+	libesedb_page_cache_shard_t *shards;
+
+	/* The number of shards
+	 */
+	int number_of_shards;
+};
+
+int libesedb_page_cache_initialize(
+     libesedb_page_cache_t **page_cache,
+     libesedb_io_handle_t *io_handle,
+     int maximum_cache_entries,
+     liberror_error_t **error );
+
+int libesedb_page_cache_free(
+     libesedb_page_cache_t **page_cache,
+     liberror_error_t **error );
+
+int libesedb_page_cache_get_shard(
+     libesedb_page_cache_t *page_cache,
+     off64_t page_offset,
+     libesedb_page_cache_shard_t **shard,
+     liberror_error_t **error );
+
+int libesedb_page_cache_shard_grab_lock(
+     libesedb_page_cache_shard_t *shard,
+     liberror_error_t **error );
+
+int libesedb_page_cache_shard_release_lock(
+     libesedb_page_cache_shard_t *shard,
+     liberror_error_t **error );
+
+int libesedb_page_cache_shard_reference_page(
+     libesedb_page_cache_shard_t *shard,
+     off64_t page_offset,
+     libesedb_page_t **page,
+     liberror_error_t **error );
+
+int libesedb_page_cache_dereference_page(
+     libesedb_page_t **page,
+     liberror_error_t **error );
+
+int libesedb_page_cache_get_page(
+     libesedb_page_cache_t *page_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t page_offset,
+     libesedb_page_t **page,
+     liberror_error_t **error );
+
+int libesedb_page_cache_release_page(
+     libesedb_page_cache_t *page_cache,
+     libesedb_page_t **page,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,379 @@
+/*
+ * Page pool functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_page.h"
+#include "libesedb_page_pool.h"
+
+/* Creates a page pool
+ * The pool recycles pages, including their data buffer and values,
+ * so that reading a page does not require new allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_initialize(
+     libesedb_page_pool_t **page_pool,
+     int maximum_number_of_pages,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_initialize";
+	size_t pages_size     = 0;
+
+	if( page_pool == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_pool != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_pages <= 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of pages value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	pages_size = sizeof( libesedb_page_t * ) * maximum_number_of_pages;
+
+	if( pages_size > (size_t) SSIZE_MAX )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid pages size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*page_pool = memory_allocate_structure(
+	              libesedb_page_pool_t );
+
+	if( *page_pool == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_pool,
+	     0,
+	     sizeof( libesedb_page_pool_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_pool )->pages = (libesedb_page_t **) memory_allocate(
+	                                              pages_size );
+
+	if( ( *page_pool )->pages == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pages.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_pool )->maximum_number_of_pages = maximum_number_of_pages;
+
+	return( 1 );
+
+on_error:
+	if( *page_pool != NULL )
+	{
+		memory_free(
+		 *page_pool );
+
+		*page_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page pool
+ * If pages obtained from the pool are still in use the pool is detached
+ * and freed when the last of these pages is released
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_free(
+     libesedb_page_pool_t **page_pool,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_free";
+	int page_index        = 0;
+	int result            = 1;
+
+	if( page_pool == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_pool != NULL )
+	{
+		for( page_index = 0;
+		     page_index < ( *page_pool )->number_of_pages;
+		     page_index++ )
+		{
+			if( libesedb_page_free(
+			     &( ( *page_pool )->pages[ page_index ] ),
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page: %d.",
+				 function,
+				 page_index );
+
+				result = -1;
+			}
+		}
+		( *page_pool )->number_of_pages = 0;
+
+		memory_free(
+		 ( *page_pool )->pages );
+
+		( *page_pool )->pages = NULL;
+
+		if( ( *page_pool )->number_of_outstanding_pages > 0 )
+		{
+			( *page_pool )->is_detached = 1;
+		}
+		else
+		{
+			memory_free(
+			 *page_pool );
+		}
+		*page_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a page from the pool
+ * A new page is created if no page is available for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_get_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t **page,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_get_page";
+
+	if( page_pool == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_pool->is_detached != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page pool - pool is detached.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_pool->number_of_pages > 0 )
+	{
+		page_pool->number_of_pages -= 1;
+
+		*page = page_pool->pages[ page_pool->number_of_pages ];
+
+		page_pool->pages[ page_pool->number_of_pages ] = NULL;
+	}
+	else if( libesedb_page_initialize(
+	          page,
+	          error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
+		 function );
+
+		return( -1 );
+	}
+	( *page )->pool = page_pool;
+
+	page_pool->number_of_outstanding_pages += 1;
+
+	return( 1 );
+}
+
+/* Releases a page obtained from the pool
+ * The page is either kept for reuse or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_release_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t *page,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_release_page";
+	int result            = 1;
+
+	if( page_pool == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->pool != page_pool )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page - page was not obtained from pool.",
+		 function );
+
+		return( -1 );
+	}
+	page->pool = NULL;
+
+	page_pool->number_of_outstanding_pages -= 1;
+
+	if( ( page_pool->is_detached == 0 )
+	 && ( page_pool->number_of_pages < page_pool->maximum_number_of_pages ) )
+	{
+		if( libesedb_page_clear(
+		     page,
+		     error ) == 1 )
+		{
+			page_pool->pages[ page_pool->number_of_pages ] = page;
+
+			page_pool->number_of_pages += 1;
+
+			return( 1 );
+		}
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear page.",
+		 function );
+
+		result = -1;
+	}
+	libesedb_page_free(
+	 &page,
+	 NULL );
+
+	if( ( page_pool->is_detached != 0 )
+	 && ( page_pool->number_of_outstanding_pages == 0 ) )
+	{
+		memory_free(
+		 page_pool );
+	}
+	return( result );
+}
+
@@ -0,0 +1,83 @@
+/*
+ * Page pool functions
+ *
+ * Copyright (c) 2009-2012, Joachim Metz <jbmetz@users.sourceforge.net>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_POOL_H )
+#define _LIBESEDB_PAGE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include <liberror.h>
+
+#include "libesedb_page.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+struct libesedb_page_pool
+{
+	/* The pages available for reuse
+	 */
+	libesedb_page_t **pages;
+
+	/* The number of pages available for reuse
+	 */
+	int number_of_pages;
+
+	/* The maximum number of pages available for reuse
+	 */
+	int maximum_number_of_pages;
+
+	/* The number of pages obtained from the pool that have not been released
+	 */
+	int number_of_outstanding_pages;
+
+	/* Value to indicate the pool was freed while pages were outstanding
+	 */
+	uint8_t is_detached;
+};
+
+int libesedb_page_pool_initialize(
+     libesedb_page_pool_t **page_pool,
+     int maximum_number_of_pages,
+     liberror_error_t **error );
+
+int libesedb_page_pool_free(
+     libesedb_page_pool_t **page_pool,
+     liberror_error_t **error );
+
+int libesedb_page_pool_get_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t **page,
+     liberror_error_t **error );
+
+int libesedb_page_pool_release_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t *page,
+     liberror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -47,8 +47,7 @@
 int libesedb_page_tree_initialize(
      libesedb_page_tree_t **page_tree,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      uint32_t object_identifier,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
@@ -118,7 +117,6 @@ int libesedb_page_tree_initialize(
 		goto on_error;
 	}
 	( *page_tree )->io_handle                 = io_handle;
-	( *page_tree )->pages_vector              = pages_vector;
 	( *page_tree )->pages_cache               = pages_cache;
 	( *page_tree )->object_identifier         = object_identifier;
 	( *page_tree )->table_definition          = table_definition;
@@ -160,7 +158,7 @@ int libesedb_page_tree_free(
 	}
 	if( *page_tree != NULL )
 	{
-		/* The io_handle, pages_vector, pages_cache, table_definition and template_table_definition references
+		/* The io_handle, pages_cache, table_definition and template_table_definition references
 		 * are freed elsewhere
 		 */
 		memory_free(
@@ -206,13 +204,11 @@ int libesedb_page_tree_read_root_page(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     page_tree->pages_vector,
-	     file_io_handle,
+	if( libesedb_page_cache_get_page(
 	     page_tree->pages_cache,
+	     file_io_handle,
 	     page_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -224,7 +220,7 @@ int libesedb_page_tree_read_root_page(
 		 page_number,
 		 page_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page == NULL )
 	{
@@ -235,7 +231,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	required_flags = LIBESEDB_PAGE_FLAG_IS_ROOT;
 
@@ -249,10 +245,24 @@ int libesedb_page_tree_read_root_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
 	{
+		if( libesedb_page_cache_release_page(
+		     page_tree->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	supported_flags = required_flags
@@ -277,7 +287,7 @@ int libesedb_page_tree_read_root_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_number_of_values(
 	     page,
@@ -291,10 +301,24 @@ int libesedb_page_tree_read_root_page(
 		 "%s: unable to retrieve number of page values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( number_of_page_values == 0 )
 	{
+		if( libesedb_page_cache_release_page(
+		     page_tree->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	if( libesedb_page_get_value(
@@ -310,7 +334,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: unable to retrieve page value: 0.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -321,7 +345,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: missing page value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -332,7 +356,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: invalid page value - missing data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->size != 16 )
 	{
@@ -343,7 +367,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: unsupported size of page value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (esedb_root_page_header_t *) page_value->data )->space_tree_page_number,
@@ -409,7 +433,7 @@ int libesedb_page_tree_read_root_page(
 			 function,
 			 space_tree_page_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( space_tree_page_number > 0 )
 		{
@@ -429,7 +453,7 @@ int libesedb_page_tree_read_root_page(
 				 function,
 				 space_tree_page_number );
 
-				return( -1 );
+				goto on_error;
 			}
 			/* Read the available pages space tree page
 			 */
@@ -449,11 +473,35 @@ int libesedb_page_tree_read_root_page(
 				 function,
 				 space_tree_page_number );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 	}
+	if( libesedb_page_cache_release_page(
+	     page_tree->pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the space tree page
@@ -469,6 +517,7 @@ int libesedb_page_tree_read_space_tree_page(
 	libesedb_page_value_t *page_value = NULL;
 	uint8_t *page_value_data          = NULL;
 	static char *function             = "libesedb_page_tree_read_space_tree_page";
+	off64_t page_offset               = 0;
 	uint32_t number_of_pages          = 0;
 	uint32_t required_flags           = 0;
 	uint32_t supported_flags          = 0;
@@ -494,13 +543,27 @@ int libesedb_page_tree_read_space_tree_page(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     file_io_handle,
+	if( ( page_number == 0 )
+	 || ( page_number > page_tree->io_handle->last_page_number ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	page_offset  = page_number - 1;
+	page_offset *= page_tree->io_handle->page_size;
+
+	if( libesedb_page_cache_get_page(
 	     page_tree->pages_cache,
-	     (int) page_number - 1,
-	     (intptr_t **) &page,
-	     0,
+	     file_io_handle,
+	     page_offset,
+	     &page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -511,7 +574,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page_number );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page == NULL )
 	{
@@ -522,7 +585,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_tree->object_identifier != page->father_data_page_object_identifier )
 	{
@@ -535,7 +598,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 page_tree->object_identifier,
 		 page->father_data_page_object_identifier );
 
-		return( -1 );
+		goto on_error;
 	}
 	required_flags = LIBESEDB_PAGE_FLAG_IS_ROOT
 	               | LIBESEDB_PAGE_FLAG_IS_SPACE_TREE;
@@ -550,10 +613,24 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
 	{
+		if( libesedb_page_cache_release_page(
+		     page_tree->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	supported_flags = required_flags
@@ -577,7 +654,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page->previous_page_number != 0 )
 	{
@@ -589,7 +666,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->previous_page_number );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page->next_page_number != 0 )
 	{
@@ -601,7 +678,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->next_page_number );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_number_of_values(
 	     page,
@@ -615,10 +692,24 @@ int libesedb_page_tree_read_space_tree_page(
 		 "%s: unable to retrieve number of page values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( number_of_page_values == 0 )
 	{
+		if( libesedb_page_cache_release_page(
+		     page_tree->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	if( libesedb_page_get_value(
@@ -635,7 +726,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -646,7 +737,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 "%s: invalid page value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
@@ -685,7 +776,7 @@ int libesedb_page_tree_read_space_tree_page(
 			 "%s: unsupported header size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 	/* TODO handle the space tree page header */
@@ -708,7 +799,7 @@ int libesedb_page_tree_read_space_tree_page(
 			 function,
 			 page_value_index );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
@@ -748,7 +839,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 function,
 				 page_value->flags );
 
-				return( -1 );
+				goto on_error;
 			}
 			if( page_value_size < 2 )
 			{
@@ -759,7 +850,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 "%s: unsupported key size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			byte_stream_copy_to_uint16_little_endian(
 			 page_value_data,
@@ -787,7 +878,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 "%s: unsupported key size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libnotify_verbose != 0 )
@@ -825,7 +916,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 "%s: unsupported key size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			byte_stream_copy_to_uint32_little_endian(
 			 page_value_data,
@@ -881,7 +972,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 function,
 				 space_tree_page_number );
 
-				return( -1 );
+				goto on_error;
 			}
 #endif
 		}
@@ -898,6 +989,246 @@ int libesedb_page_tree_read_space_tree_page(
 		 "\n" );
 	}
 #endif
+	if( libesedb_page_cache_release_page(
+	     page_tree->pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads ahead the child pages of a branch page
+ * Contiguous ranges of child page numbers are passed to the file IO handle
+ * as a single prefetch, the number of pages is limited by the readahead window
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_read_ahead_child_pages(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     liberror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	uint8_t *page_value_data          = NULL;
+	static char *function             = "libesedb_page_tree_read_ahead_child_pages";
+	off64_t readahead_offset          = 0;
+	size64_t readahead_size           = 0;
+	size_t page_value_size            = 0;
+	uint32_t child_page_number        = 0;
+	uint32_t first_page_number        = 0;
+	uint32_t last_page_number         = 0;
+	uint32_t number_of_pages          = 0;
+	uint16_t local_key_size           = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+
+	if( page_tree == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle->readahead_window == 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The last iteration, or the first iteration after the readahead window
+	 * is filled, flushes the remaining range
+	 */
+	for( page_value_index = 1;
+	     page_value_index <= number_of_page_values;
+	     page_value_index++ )
+	{
+		child_page_number = 0;
+
+		if( ( page_value_index < number_of_page_values )
+		 && ( number_of_pages < page_tree->io_handle->readahead_window ) )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			page_value_data = page_value->data;
+			page_value_size = page_value->size;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+			{
+				if( page_value_size < 2 )
+				{
+					continue;
+				}
+				page_value_data += 2;
+				page_value_size -= 2;
+			}
+			if( page_value_size < 2 )
+			{
+				continue;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 page_value_data,
+			 local_key_size );
+
+			page_value_data += 2;
+			page_value_size -= 2;
+
+			if( ( (size_t) local_key_size + 4 ) > page_value_size )
+			{
+				continue;
+			}
+			page_value_data += local_key_size;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 page_value_data,
+			 child_page_number );
+
+			if( ( child_page_number == 0 )
+			 || ( child_page_number > page_tree->io_handle->last_page_number ) )
+			{
+				continue;
+			}
+			if( ( first_page_number != 0 )
+			 && ( child_page_number == ( last_page_number + 1 ) ) )
+			{
+				last_page_number = child_page_number;
+
+				number_of_pages++;
+
+				continue;
+			}
+		}
+		if( first_page_number != 0 )
+		{
+			readahead_offset = page_tree->io_handle->pages_data_offset
+			                 + ( (off64_t) ( first_page_number - 1 ) * page_tree->io_handle->page_size );
+			readahead_size   = (size64_t) ( last_page_number - first_page_number + 1 ) * page_tree->io_handle->page_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libnotify_verbose != 0 )
+			{
+				libnotify_printf(
+				 "%s: reading ahead child pages: %" PRIu32 " - %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 first_page_number,
+				 last_page_number,
+				 readahead_offset,
+				 readahead_offset );
+			}
+#endif
+			if( libbfio_handle_prefetch(
+			     file_io_handle,
+			     readahead_offset,
+			     readahead_size,
+			     error ) == -1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_IO,
+				 LIBERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read ahead child pages: %" PRIu32 " - %" PRIu32 ".",
+				 function,
+				 first_page_number,
+				 last_page_number );
+
+				return( -1 );
+			}
+		}
+		first_page_number = child_page_number;
+		last_page_number  = child_page_number;
+
+		if( child_page_number == 0 )
+		{
+			break;
+		}
+		number_of_pages++;
+	}
 	return( 1 );
 }
 
@@ -960,13 +1291,11 @@ int libesedb_page_tree_read_page(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     page_tree->pages_vector,
-	     file_io_handle,
+	if( libesedb_page_cache_get_page(
 	     page_tree->pages_cache,
+	     file_io_handle,
 	     page_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -978,7 +1307,7 @@ int libesedb_page_tree_read_page(
 		 page_number,
 		 page_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page == NULL )
 	{
@@ -989,10 +1318,24 @@ int libesedb_page_tree_read_page(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
 	{
+		if( libesedb_page_cache_release_page(
+		     page_tree->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	supported_flags = LIBESEDB_PAGE_FLAG_IS_ROOT
@@ -1016,7 +1359,7 @@ int libesedb_page_tree_read_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
 	{
@@ -1084,7 +1427,7 @@ int libesedb_page_tree_read_page(
 			 function,
 			 page->previous_page_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( page->next_page_number != 0 )
 		{
@@ -1096,7 +1439,23 @@ int libesedb_page_tree_read_page(
 			 function,
 			 page->next_page_number );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libesedb_page_tree_read_ahead_child_pages(
+		     page_tree,
+		     file_io_handle,
+		     page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_IO,
+			 LIBERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read ahead child pages of page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
 		}
 	}
 	if( libesedb_page_get_number_of_values(
@@ -1111,10 +1470,24 @@ int libesedb_page_tree_read_page(
 		 "%s: unable to retrieve number of page values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( number_of_page_values == 0 )
 	{
+		if( libesedb_page_cache_release_page(
+		     page_tree->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	if( libesedb_page_get_value(
@@ -1131,7 +1504,7 @@ int libesedb_page_tree_read_page(
 		 function,
 		 page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1143,7 +1516,7 @@ int libesedb_page_tree_read_page(
 		 function,
 		 page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
@@ -1222,7 +1595,7 @@ int libesedb_page_tree_read_page(
 			 function,
 			 page_value_index );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
 		{
@@ -1245,16 +1618,42 @@ int libesedb_page_tree_read_page(
 				 page_number,
 				 page_value_index );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 		/* TODO are defunct data definition of any value recovering
 		 */
 	}
+	if( libesedb_page_cache_release_page(
+	     page_tree->pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads a page value
+ * The value tree node is optional, if set it is made a leaf node
+ * or its sub nodes range is set to the child page
  * Returns 1 if successful or -1 on error
  */
 int libesedb_page_tree_read_page_value(
@@ -1318,13 +1717,11 @@ int libesedb_page_tree_read_page_value(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     page_tree->pages_vector,
-	     file_io_handle,
+	if( libesedb_page_cache_get_page(
 	     page_tree->pages_cache,
+	     file_io_handle,
 	     page_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1336,7 +1733,7 @@ int libesedb_page_tree_read_page_value(
 		 page_number,
 		 page_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page == NULL )
 	{
@@ -1347,7 +1744,7 @@ int libesedb_page_tree_read_page_value(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
@@ -1367,38 +1764,7 @@ int libesedb_page_tree_read_page_value(
 			 function,
 			 page_number );
 
-			return( -1 );
-		}
-		if( libfdata_vector_get_element_value_at_offset(
-		     page_tree->pages_vector,
-		     file_io_handle,
-		     page_tree->pages_cache,
-		     page_offset,
-		     (intptr_t **) &page,
-		     0,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page: %" PRIu32 " at offset: %" PRIi64 ".",
-			 function,
-			 page_number,
-			 page_offset );
-
-			return( -1 );
-		}
-		if( page == NULL )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing page.",
-			 function );
-
-			return( -1 );
+			goto on_error;
 		}
 	}
 #endif
@@ -1414,10 +1780,24 @@ int libesedb_page_tree_read_page_value(
 		 "%s: unable to retrieve number of page values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( number_of_page_values == 0 )
 	{
+		if( libesedb_page_cache_release_page(
+		     page_tree->pages_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	if( libesedb_page_get_value(
@@ -1434,7 +1814,7 @@ int libesedb_page_tree_read_page_value(
 		 function,
 		 page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1446,7 +1826,7 @@ int libesedb_page_tree_read_page_value(
 		 function,
 		 page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
@@ -1485,7 +1865,7 @@ int libesedb_page_tree_read_page_value(
 			 "%s: unsupported page flags - root flag is set.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_page_get_value(
 		     page,
@@ -1500,7 +1880,7 @@ int libesedb_page_tree_read_page_value(
 			 "%s: unable to retrieve page value: 0.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( header_page_value == NULL )
 		{
@@ -1511,7 +1891,7 @@ int libesedb_page_tree_read_page_value(
 			 "%s: missing page value: 0.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		byte_stream_copy_to_uint16_little_endian(
 		 page_value_data,
@@ -1540,7 +1920,7 @@ int libesedb_page_tree_read_page_value(
 			 "%s: common key size exceeds header page value size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
@@ -1581,7 +1961,7 @@ int libesedb_page_tree_read_page_value(
 			 "%s: unable to set common key in page tree values.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 	byte_stream_copy_to_uint16_little_endian(
@@ -1611,7 +1991,7 @@ int libesedb_page_tree_read_page_value(
 		 "%s: local key size exceeds page value size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
@@ -1652,7 +2032,7 @@ int libesedb_page_tree_read_page_value(
 		 "%s: unable to set local key in page tree values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	page_value_data   += local_key_size;
 	page_value_offset += local_key_size;
@@ -1699,18 +2079,21 @@ int libesedb_page_tree_read_page_value(
 		{
 			values_tree_value->type = LIBESEDB_VALUES_TREE_VALUE_TYPE_RECORD;
 		}
-		if( libfdata_tree_node_set_leaf(
-		     value_tree_node,
-		     error ) != 1 )
+		if( value_tree_node != NULL )
 		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to make value tree node a leaf.",
-			 function );
+			if( libfdata_tree_node_set_leaf(
+			     value_tree_node,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to make value tree node a leaf.",
+				 function );
 
-			return( -1 );
+				goto on_error;
+			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
@@ -1755,7 +2138,8 @@ int libesedb_page_tree_read_page_value(
 			 "\n" );
 		}
 #endif
-		if( ( child_page_number > 0 )
+		if( ( value_tree_node != NULL )
+		 && ( child_page_number > 0 )
 		 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 		{
 			sub_nodes_offset  = child_page_number - 1;
@@ -1775,7 +2159,7 @@ int libesedb_page_tree_read_page_value(
 				 function,
 				 child_page_number );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1793,7 +2177,31 @@ int libesedb_page_tree_read_page_value(
 #endif
 		values_tree_value->type = LIBESEDB_VALUES_TREE_VALUE_TYPE_NODE;
 	}
+	if( libesedb_page_cache_release_page(
+	     page_tree->pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads a page tree node value
@@ -31,6 +31,8 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_values_tree_value.h"
 
@@ -58,20 +60,15 @@ struct libesedb_page_tree
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
 	/* The pages cache
 	 */
-	libfcache_cache_t *pages_cache;
+	libesedb_page_cache_t *pages_cache;
 };
 
 int libesedb_page_tree_initialize(
      libesedb_page_tree_t **page_tree,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      uint32_t object_identifier,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
@@ -94,6 +91,12 @@ int libesedb_page_tree_read_space_tree_page(
      uint32_t page_number,
      liberror_error_t **error );
 
+int libesedb_page_tree_read_ahead_child_pages(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     liberror_error_t **error );
+
 int libesedb_page_tree_read_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
@@ -41,6 +41,7 @@
 #include "libesedb_values_tree_value.h"
 
 /* Creates a record
+ * If column identifiers are provided only the values of these columns are read
  * Returns 1 if successful or -1 on error
  */
 int libesedb_record_initialize(
@@ -49,20 +50,18 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
-     libfdata_tree_node_t *values_tree_node,
-     libfcache_cache_t *values_cache,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
+     libesedb_values_tree_value_t *values_tree_value,
      libfdata_tree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
      uint8_t flags,
      liberror_error_t **error )
 {
-	libesedb_internal_record_t *internal_record     = NULL;
-	libesedb_values_tree_value_t *values_tree_value = NULL;
-	static char *function                           = "libesedb_record_initialize";
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_initialize";
 
 	if( record == NULL )
 	{
@@ -186,46 +185,19 @@ int libesedb_record_initialize(
 			goto on_error;
 		}
 	}
-	if( libesedb_array_initialize(
-	     &( internal_record->values_array ),
-	     0,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create values array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_tree_node_get_node_value(
-	     values_tree_node,
-	     internal_record->file_io_handle,
-	     values_cache,
-	     (intptr_t **) &values_tree_value,
-	     0,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve node value from values tree node.",
-		 function );
-
-		goto on_error;
-	}
 	if( libesedb_values_tree_value_read_record(
 	     values_tree_value,
 	     internal_record->file_io_handle,
 	     io_handle,
-	     pages_vector,
 	     pages_cache,
 	     table_definition,
 	     template_table_definition,
-	     internal_record->values_array,
+	     column_identifiers,
+	     number_of_column_identifiers,
+	     &( internal_record->data ),
+	     &( internal_record->data_size ),
+	     &( internal_record->data_type_definitions ),
+	     &( internal_record->number_of_data_type_definitions ),
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -237,12 +209,24 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
+	if( libesedb_array_initialize(
+	     &( internal_record->values_array ),
+	     internal_record->number_of_data_type_definitions,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values array.",
+		 function );
+
+		goto on_error;
+	}
 	internal_record->io_handle                 = io_handle;
 	internal_record->table_definition          = table_definition;
 	internal_record->template_table_definition = template_table_definition;
-	internal_record->pages_vector              = pages_vector;
 	internal_record->pages_cache               = pages_cache;
-	internal_record->long_values_pages_vector  = long_values_pages_vector;
 	internal_record->long_values_pages_cache   = long_values_pages_cache;
 	internal_record->long_values_tree          = long_values_tree;
 	internal_record->long_values_cache         = long_values_cache;
@@ -262,6 +246,16 @@ on_error:
 			 NULL,
 			 NULL );
 		}
+		if( internal_record->data_type_definitions != NULL )
+		{
+			memory_free(
+			 internal_record->data_type_definitions );
+		}
+		if( internal_record->data != NULL )
+		{
+			memory_free(
+			 internal_record->data );
+		}
 		if( internal_record->file_io_handle != NULL )
 		{
 			if( ( flags & LIBESEDB_ITEM_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
@@ -304,9 +298,8 @@ int libesedb_record_free(
 		internal_record = (libesedb_internal_record_t *) *record;
 		*record         = NULL;
 
-		/* The io_handle, table_definition, template_table_definition, pages_vector, pages_cache,
-		 * long_values_pages_vector, long_values_pages_cache, long_values_tree
-		 * and long_values_cache references are freed elsewhere
+		/* The io_handle, table_definition, template_table_definition, pages_cache,
+		 * long_values_pages_cache, long_values_tree and long_values_cache references are freed elsewhere
 		 */
 		if( ( internal_record->flags & LIBESEDB_ITEM_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
 		{
@@ -354,6 +347,16 @@ int libesedb_record_free(
 
 			result = -1;
 		}
+		if( internal_record->data_type_definitions != NULL )
+		{
+			memory_free(
+			 internal_record->data_type_definitions );
+		}
+		if( internal_record->data != NULL )
+		{
+			memory_free(
+			 internal_record->data );
+		}
 		memory_free(
 		 internal_record );
 	}
@@ -401,17 +404,22 @@ int libesedb_record_get_number_of_values(
 	return( 1 );
 }
 
-/* Retrieves the column catalog definition of the specific entry
+/* Retrieves a specific record value
+ * The record value is created from its data type definition on first access
  * Returns 1 if successful or -1 on error
  */
-int libesedb_record_get_column_catalog_definition(
+int libesedb_record_get_record_value(
      libesedb_internal_record_t *internal_record,
      int value_entry,
-     libesedb_catalog_definition_t **column_catalog_definition,
+     libfvalue_value_t **record_value,
      liberror_error_t **error )
 {
-	static char *function                = "libesedb_record_get_column_identifier";
-	int template_table_number_of_columns = 0;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_type_definition_t *data_type_definition    = NULL;
+	libfvalue_value_t *safe_record_value                     = NULL;
+	static char *function                                    = "libesedb_record_get_record_value";
+	int record_value_codepage                                = 0;
+	uint8_t record_value_type                                = 0;
 
 	if( internal_record == NULL )
 	{
@@ -424,70 +432,297 @@ int libesedb_record_get_column_catalog_definition(
 
 		return( -1 );
 	}
-	if( internal_record->table_definition == NULL )
+	if( internal_record->io_handle == NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal record - missing table definition.",
+		 "%s: invalid internal record - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_record->template_table_definition != NULL )
+	if( record_value == NULL )
 	{
-		if( libesedb_list_get_number_of_elements(
-		     internal_record->template_table_definition->column_catalog_definition_list,
-		     &template_table_number_of_columns,
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) record_value,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( *record_value != NULL )
+	{
+		return( 1 );
+	}
+	data_type_definition      = &( internal_record->data_type_definitions[ value_entry ] );
+	column_catalog_definition = data_type_definition->column_catalog_definition;
+
+	if( column_catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing column catalog definition: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_NULL:
+			/* TODO handle this value type */
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+			record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
+			/* TODO handle this value type */
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+			break;
+
+		default:
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
+
+			goto on_error;
+	}
+	if( libfvalue_value_initialize(
+	     &safe_record_value,
+	     record_value_type,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		record_value_codepage = (int) column_catalog_definition->codepage;
+
+		/* If the codepage is not set use the default codepage
+		 */
+		if( record_value_codepage == 0 )
+		{
+			record_value_codepage = internal_record->io_handle->ascii_codepage;
+		}
+		if( libfvalue_value_set_codepage(
+		     safe_record_value,
+		     record_value_codepage,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of columns from template table.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value codepage.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	if( value_entry < template_table_number_of_columns )
+	if( ( data_type_definition->flags & LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_METADATA ) != 0 )
 	{
-		if( libesedb_list_get_value_by_index(
-		     internal_record->template_table_definition->column_catalog_definition_list,
-		     value_entry,
-		     (intptr_t **) column_catalog_definition,
+		if( libfvalue_value_set_metadata(
+		     safe_record_value,
+		     &( internal_record->data[ data_type_definition->data_offset - 1 ] ),
+		     1,
+		     LIBFVALUE_VALUE_METADATA_FLAG_MANAGED,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from template table.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set tagged data type flags in record value.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	else
+	if( ( data_type_definition->flags & LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_DATA ) != 0 )
 	{
-		if( libesedb_list_get_value_by_index(
-		     internal_record->table_definition->column_catalog_definition_list,
-		     value_entry - template_table_number_of_columns,
-		     (intptr_t **) column_catalog_definition,
+		if( libfvalue_value_set_data(
+		     safe_record_value,
+		     &( internal_record->data[ data_type_definition->data_offset ] ),
+		     (size_t) data_type_definition->data_size,
+		     LIBFVALUE_ENDIAN_LITTLE,
+		     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from table.",
+			 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data in record value.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
+	if( libesedb_array_set_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t *) safe_record_value,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value: %d in values array.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	*record_value = safe_record_value;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &safe_record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the column catalog definition of the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_column_catalog_definition(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_record_get_column_catalog_definition";
+
+	if( internal_record == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal record.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( value_entry >= internal_record->number_of_data_type_definitions ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*column_catalog_definition = internal_record->data_type_definitions[ value_entry ].column_catalog_definition;
+
 	return( 1 );
 }
 
@@ -937,10 +1172,10 @@ int libesedb_record_get_value(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1069,10 +1304,10 @@ int libesedb_record_get_value_boolean(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1192,10 +1427,10 @@ int libesedb_record_get_value_8bit(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1316,10 +1551,10 @@ int libesedb_record_get_value_16bit(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1440,10 +1675,10 @@ int libesedb_record_get_value_32bit(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1564,10 +1799,10 @@ int libesedb_record_get_value_64bit(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1687,10 +1922,10 @@ int libesedb_record_get_value_filetime(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1812,10 +2047,10 @@ int libesedb_record_get_value_floating_point_32bit(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1935,10 +2170,10 @@ int libesedb_record_get_value_floating_point_64bit(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -2065,10 +2300,10 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -2259,10 +2494,10 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -2453,10 +2688,10 @@ int libesedb_record_get_value_utf16_string_size(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -2647,10 +2882,10 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -2842,10 +3077,10 @@ int libesedb_record_get_value_binary_data_size(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -3023,10 +3258,10 @@ int libesedb_record_get_value_binary_data(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -3198,10 +3433,10 @@ int libesedb_record_get_long_value(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -3306,7 +3541,6 @@ int libesedb_record_get_long_value(
 		     internal_record->file_io_handle,
 		     internal_record->io_handle,
 		     column_catalog_definition,
-		     internal_record->long_values_pages_vector,
 		     internal_record->long_values_pages_cache,
 		     internal_record->long_values_tree,
 		     internal_record->long_values_cache,
@@ -3415,10 +3649,10 @@ int libesedb_record_get_multi_value(
 
 		return( -1 );
 	}
-	if( libesedb_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		liberror_error_set(
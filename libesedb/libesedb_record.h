@@ -33,8 +33,11 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
+#include "libesedb_values_tree_value.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -60,21 +63,13 @@ struct libesedb_internal_record
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
 	/* The pages cache
 	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
+	libesedb_page_cache_t *pages_cache;
 
 	/* The long values pages cache
 	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_page_cache_t *long_values_pages_cache;
 
 	/* The long values tree
 	 */
@@ -88,8 +83,25 @@ struct libesedb_internal_record
 	 */
 	uint8_t flags;
 
+	/* The record data
+	 */
+	uint8_t *data;
+
+	/* The record data size
+	 */
+	size_t data_size;
+
+	/* The data type definitions
+	 */
+	libesedb_data_type_definition_t *data_type_definitions;
+
+	/* The number of data type definitions
+	 */
+	int number_of_data_type_definitions;
+
 	/* The values array
-	*/
+	 * The values are created from the data type definitions on first access
+	 */
 	libesedb_array_t *values_array;
 };
 
@@ -99,14 +111,13 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
-     libfdata_tree_node_t *values_tree_node,
-     libfcache_cache_t *values_cache,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_cache_t *long_values_pages_cache,
+     libesedb_values_tree_value_t *values_tree_value,
      libfdata_tree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
      uint8_t flags,
      liberror_error_t **error );
 
@@ -121,6 +132,12 @@ int libesedb_record_get_number_of_values(
      int *number_of_values,
      liberror_error_t **error );
 
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     liberror_error_t **error );
+
 int libesedb_record_get_column_catalog_definition(
      libesedb_internal_record_t *internal_record,
      int value_entry,
@@ -401,31 +401,11 @@ int libesedb_check_file_signature_file_io_handle(
 			return( -1 );
 		}
 	}
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     4,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek file header offset: 4.",
-		 function );
-
-		if( file_io_handle_is_open == 0 )
-		{
-			libbfio_handle_close(
-			 file_io_handle,
-			 error );
-		}
-		return( -1 );
-	}
-	read_count = libbfio_handle_read(
+	read_count = libbfio_handle_read_at(
 	              file_io_handle,
 	              signature,
 	              4,
+	              4,
 	              error );
 
 	if( read_count != 4 )
@@ -26,6 +26,7 @@
 #include <liberror.h>
 
 #include "libesedb_column.h"
+#include "libesedb_cursor.h"
 #include "libesedb_definitions.h"
 #include "libesedb_index.h"
 #include "libesedb_io_handle.h"
@@ -40,12 +41,14 @@
 #include "libesedb_values_tree_value.h"
 
 /* Creates a table
+ * The pages vector and cache are shared with the file and are not managed by the table
  * Returns 1 if successful or -1 on error
  */
 int libesedb_table_initialize(
      libesedb_table_t **table,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
+     libesedb_page_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      uint8_t flags,
@@ -90,6 +93,17 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
+	if( pages_cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pages cache.",
+		 function );
+
+		return( -1 );
+	}
 	if( table_definition == NULL )
 	{
 		liberror_error_set(
@@ -190,61 +204,11 @@ int libesedb_table_initialize(
 			goto on_error;
 		}
 	}
-	/* TODO add clone function ?
-	 */
-	if( libfdata_vector_initialize(
-	     &( internal_table->pages_vector ),
-	     (size64_t) io_handle->page_size,
-	     (intptr_t *) io_handle,
-	     NULL,
-	     NULL,
-	     &libesedb_io_handle_read_page,
-	     LIBFDATA_FLAG_IO_HANDLE_NON_MANAGED,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_table->pages_vector,
-	     io_handle->pages_data_offset,
-	     io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
-		 function );
+	internal_table->pages_cache = pages_cache;
 
-		goto on_error;
-	}
-	if( libfcache_cache_initialize(
-	     &( internal_table->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
-		 function );
-
-		goto on_error;
-	}
 	if( libesedb_page_tree_initialize(
 	     &table_page_tree,
 	     io_handle,
-	     internal_table->pages_vector,
 	     internal_table->pages_cache,
 	     table_definition->table_catalog_definition->identifier,
 	     table_definition,
@@ -319,61 +283,11 @@ int libesedb_table_initialize(
 	}
 	if( table_definition->long_value_catalog_definition != NULL )
 	{
-		/* TODO add clone function ?
-		 */
-		if( libfdata_vector_initialize(
-		     &( internal_table->long_values_pages_vector ),
-		     (size64_t) io_handle->page_size,
-		     (intptr_t *) io_handle,
-		     NULL,
-		     NULL,
-		     &libesedb_io_handle_read_page,
-		     LIBFDATA_FLAG_IO_HANDLE_NON_MANAGED,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages vector.",
-			 function );
+		internal_table->long_values_pages_cache = pages_cache;
 
-			goto on_error;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_table->long_values_pages_vector,
-		     io_handle->pages_data_offset,
-		     io_handle->pages_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_table->long_values_pages_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages cache.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_tree_initialize(
 		     &long_values_page_tree,
 		     io_handle,
-		     internal_table->long_values_pages_vector,
 		     internal_table->long_values_pages_cache,
 		     table_definition->long_value_catalog_definition->identifier,
 		     table_definition,
@@ -471,18 +385,6 @@ on_error:
 			 &( internal_table->long_values_tree ),
 			 NULL );
 		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->long_values_pages_cache ),
-			 NULL );
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->long_values_pages_vector ),
-			 NULL );
-		}
 		if( internal_table->table_values_cache != NULL )
 		{
 			libfcache_cache_free(
@@ -495,18 +397,6 @@ on_error:
 			 &( internal_table->table_values_tree ),
 			 NULL );
 		}
-		if( internal_table->pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->pages_cache ),
-			 NULL );
-		}
-		if( internal_table->pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->pages_vector ),
-			 NULL );
-		}
 		if( internal_table->file_io_handle != NULL )
 		{
 			if( ( flags & LIBESEDB_ITEM_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
@@ -584,64 +474,6 @@ int libesedb_table_free(
 				}
 			}
 		}
-		if( libfdata_vector_free(
-		     &( internal_table->pages_vector ),
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages vector.",
-			 function );
-
-			result = -1;
-		}
-		if( libfcache_cache_free(
-		     &( internal_table->pages_cache ),
-		     error ) != 1 )
-		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages cache.",
-			 function );
-
-			result = -1;
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			if( libfdata_vector_free(
-			     &( internal_table->long_values_pages_vector ),
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages vector.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_pages_cache ),
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages cache.",
-				 function );
-
-				result = -1;
-			}
-		}
 		if( libfdata_tree_free(
 		     &( internal_table->table_values_tree ),
 		     error ) != 1 )
@@ -1569,6 +1401,317 @@ int libesedb_table_get_column(
 	return( 1 );
 }
 
+/* Retrieves the column for the specific UTF-8 encoded name
+ *
+ * Use the flag LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE to retrieve the column
+ * ignoring the template table
+ *
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     liberror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_table_t *internal_table                = NULL;
+	static char *function                                    = "libesedb_table_get_column_by_utf8_name";
+	int result                                               = 0;
+
+	if( table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
+	 && ( internal_table->template_table_definition != NULL ) )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+		          internal_table->template_table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+		          internal_table->table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libesedb_column_initialize(
+	     column,
+	     internal_table->io_handle,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the column for the specific UTF-16 encoded name
+ *
+ * Use the flag LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE to retrieve the column
+ * ignoring the template table
+ *
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     liberror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_table_t *internal_table                = NULL;
+	static char *function                                    = "libesedb_table_get_column_by_utf16_name";
+	int result                                               = 0;
+
+	if( table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->io_handle == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) ) != 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
+	 && ( internal_table->template_table_definition != NULL ) )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+		          internal_table->template_table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+		          internal_table->table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libesedb_column_initialize(
+	     column,
+	     internal_table->io_handle,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
 /* Retrieves the number of indexes
  * Returns 1 if successful or -1 on error
  */
@@ -1713,9 +1856,7 @@ int libesedb_table_get_index(
 	     internal_table->table_definition,
 	     internal_table->template_table_definition,
 	     index_catalog_definition,
-	     internal_table->pages_vector,
 	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
 	     internal_table->long_values_pages_cache,
 	     internal_table->table_values_tree,
 	     internal_table->table_values_cache,
@@ -1789,9 +1930,46 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      liberror_error_t **error )
 {
-	libfdata_tree_node_t *record_values_tree_node = NULL;
-	libesedb_internal_table_t *internal_table     = NULL;
-	static char *function                         = "libesedb_table_get_record";
+	static char *function = "libesedb_table_get_record";
+
+	if( libesedb_table_get_record_with_columns(
+	     table,
+	     record_entry,
+	     NULL,
+	     0,
+	     record,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record only reading the values of the specified columns
+ * The values of the other columns in the record are empty
+ * If column identifiers is NULL all the columns are read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record_with_columns(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libesedb_record_t **record,
+     liberror_error_t **error )
+{
+	libfdata_tree_node_t *record_values_tree_node          = NULL;
+	libesedb_internal_table_t *internal_table              = NULL;
+	libesedb_values_tree_value_t *record_values_tree_value = NULL;
+	static char *function                                  = "libesedb_table_get_record_with_columns";
 
 	if( table == NULL )
 	{
@@ -1847,20 +2025,36 @@ int libesedb_table_get_record(
 
 		return( -1 );
 	}
+	if( libfdata_tree_node_get_node_value(
+	     record_values_tree_node,
+	     internal_table->file_io_handle,
+	     internal_table->table_values_cache,
+	     (intptr_t **) &record_values_tree_value,
+	     0,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node value from record values tree node.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_record_initialize(
 	     record,
 	     internal_table->file_io_handle,
 	     internal_table->io_handle,
 	     internal_table->table_definition,
 	     internal_table->template_table_definition,
-	     internal_table->pages_vector,
 	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
 	     internal_table->long_values_pages_cache,
-	     record_values_tree_node,
-	     internal_table->table_values_cache,
+	     record_values_tree_value,
 	     internal_table->long_values_tree,
 	     internal_table->long_values_cache,
+	     column_identifiers,
+	     number_of_column_identifiers,
              LIBESEDB_ITEM_FLAGS_DEFAULT,
 	     error ) != 1 )
 	{
@@ -1876,3 +2070,78 @@ int libesedb_table_get_record(
 	return( 1 );
 }
 
+/* Opens a cursor to sequentially read the records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_open_cursor(
+     libesedb_table_t *table,
+     libesedb_cursor_t **cursor,
+     liberror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                   = "libesedb_table_open_cursor";
+
+	if( table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_initialize(
+	     cursor,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->pages_cache,
+	     internal_table->long_values_pages_cache,
+	     internal_table->table_values_tree,
+	     internal_table->table_values_cache,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     internal_table->table_definition->table_catalog_definition->identifier,
+	     internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	     LIBESEDB_CURSOR_TYPE_TABLE,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
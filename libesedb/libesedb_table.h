@@ -33,6 +33,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_list_type.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -64,21 +65,15 @@ struct libesedb_internal_table
 	 */
 	uint8_t flags;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
 	/* The pages cache
+	 * Shared with the file
 	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
+	libesedb_page_cache_t *pages_cache;
 
 	/* The long values pages cache
+	 * Shared with the file
 	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_page_cache_t *long_values_pages_cache;
 
 	/* The table values tree
 	 */
@@ -101,6 +96,7 @@ int libesedb_table_initialize(
      libesedb_table_t **table,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
+     libesedb_page_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      uint8_t flags,
@@ -184,6 +180,24 @@ int libesedb_table_get_column(
      uint8_t flags,
      liberror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     liberror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
@@ -210,6 +224,21 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      liberror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_with_columns(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libesedb_record_t **record,
+     liberror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_open_cursor(
+     libesedb_table_t *table,
+     libesedb_cursor_t **cursor,
+     liberror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
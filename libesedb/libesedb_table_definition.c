@@ -29,6 +29,8 @@
 #include "libesedb_array_type.h"
 #include "libesedb_catalog_definition.h"
 #include "libesedb_definitions.h"
+#include "libesedb_hash_table.h"
+#include "libesedb_libuna.h"
 #include "libesedb_table_definition.h"
 
 /* Creates a table definition
@@ -145,6 +147,19 @@ int libesedb_table_definition_initialize(
 
 		goto on_error;
 	}
+	if( libesedb_hash_table_initialize(
+	     &( ( *table_definition )->column_catalog_definition_hash_table ),
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column catalog definition hash table.",
+		 function );
+
+		goto on_error;
+	}
 	( *table_definition )->table_catalog_definition = table_catalog_definition;
 
 	return( 1 );
@@ -159,6 +174,13 @@ on_error:
 			 NULL,
 			 NULL );
 		}
+		if( ( *table_definition )->index_catalog_definition_list != NULL )
+		{
+			libesedb_list_free(
+			 &( ( *table_definition )->index_catalog_definition_list ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *table_definition );
 
@@ -266,6 +288,19 @@ int libesedb_table_definition_free(
 
 			result = -1;
 		}
+		if( libesedb_hash_table_free(
+		     &( ( *table_definition )->column_catalog_definition_hash_table ),
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column catalog definition hash table.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *table_definition );
 
@@ -395,14 +430,18 @@ int libesedb_table_definition_set_callback_catalog_definition(
 }
 
 /* Appends a column catalog definition to the table definition
+ * The column catalog definition is indexed by the hash of its name using the ASCII codepage
  * Returns 1 if successful or -1 on error
  */
 int libesedb_table_definition_append_column_catalog_definition(
      libesedb_table_definition_t *table_definition,
      libesedb_catalog_definition_t *column_catalog_definition,
+     int ascii_codepage,
      liberror_error_t **error )
 {
-	static char *function = "libesedb_table_definition_append_column_catalog_definition";
+	libesedb_list_element_t *list_element = NULL;
+	static char *function                 = "libesedb_table_definition_append_column_catalog_definition";
+	uint32_t hash                         = 0;
 
 	if( table_definition == NULL )
 	{
@@ -438,6 +477,25 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	if( column_catalog_definition->name != NULL )
+	{
+		if( libesedb_hash_table_calculate_hash_from_byte_stream(
+		     &hash,
+		     column_catalog_definition->name,
+		     column_catalog_definition->name_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of column name.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libesedb_list_append_value(
 	     table_definition->column_catalog_definition_list,
 	     (intptr_t *) column_catalog_definition,
@@ -452,7 +510,292 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	/* The hash table is only updated after the list has taken ownership
+	 * of the column catalog definition
+	 */
+	if( column_catalog_definition->name != NULL )
+	{
+		if( libesedb_hash_table_insert_value(
+		     table_definition->column_catalog_definition_hash_table,
+		     hash,
+		     (intptr_t *) column_catalog_definition,
+		     error ) != 1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert column catalog definition into hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
+
+on_error:
+	/* Remove the column catalog definition from the list
+	 * the caller retains ownership of the column catalog definition on error
+	 */
+	list_element = table_definition->column_catalog_definition_list->last_element;
+
+	if( libesedb_list_remove_element(
+	     table_definition->column_catalog_definition_list,
+	     list_element,
+	     NULL ) == 1 )
+	{
+		libesedb_list_element_free(
+		 &list_element,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the column catalog definition for the specific UTF-8 encoded name
+ * The ASCII codepage must match the one used to append the column catalog definitions
+ * Returns 1 if successful, 0 if no corresponding column catalog definition was found or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_get_column_catalog_definition_by_utf8_name";
+	uint32_t hash         = 0;
+	int probe_index       = 0;
+	int result            = 0;
+
+	if( table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_catalog_definition_hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing column catalog definition hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_hash_table_calculate_hash_from_utf8_string(
+	     &hash,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          table_definition->column_catalog_definition_hash_table,
+		          hash,
+		          &probe_index,
+		          (intptr_t **) column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libuna_utf8_string_compare_with_byte_stream(
+			  utf8_string,
+			  utf8_string_length,
+			  ( *column_catalog_definition )->name,
+			  ( *column_catalog_definition )->name_size,
+			  ascii_codepage,
+			  error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: unable to compare UTF-8 string with column catalog definition name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+		/* Continue with the next value with the same hash
+		 */
+		result = 1;
+	}
+	while( result != 0 );
+
+	*column_catalog_definition = NULL;
+
+	return( 0 );
+}
+
+/* Retrieves the column catalog definition for the specific UTF-16 encoded name
+ * The ASCII codepage must match the one used to append the column catalog definitions
+ * Returns 1 if successful, 0 if no corresponding column catalog definition was found or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_get_column_catalog_definition_by_utf16_name";
+	uint32_t hash         = 0;
+	int probe_index       = 0;
+	int result            = 0;
+
+	if( table_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_catalog_definition_hash_table == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing column catalog definition hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_hash_table_calculate_hash_from_utf16_string(
+	     &hash,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          table_definition->column_catalog_definition_hash_table,
+		          hash,
+		          &probe_index,
+		          (intptr_t **) column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libuna_utf16_string_compare_with_byte_stream(
+			  utf16_string,
+			  utf16_string_length,
+			  ( *column_catalog_definition )->name,
+			  ( *column_catalog_definition )->name_size,
+			  ascii_codepage,
+			  error );
+
+		if( result == -1 )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: unable to compare UTF-16 string with column catalog definition name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+		/* Continue with the next value with the same hash
+		 */
+		result = 1;
+	}
+	while( result != 0 );
+
+	*column_catalog_definition = NULL;
+
+	return( 0 );
 }
 
 /* Appends an index catalog definition to the table definition
@@ -28,6 +28,7 @@
 #include <liberror.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_hash_table.h"
 #include "libesedb_list_type.h"
 
 #if defined( __cplusplus )
@@ -54,9 +55,23 @@ struct libesedb_table_definition
 	 */
 	libesedb_list_t *column_catalog_definition_list;
 
+	/* The column catalog definition hash table
+	 * Contains the column catalog definitions by the hash of their name
+	 */
+	libesedb_hash_table_t *column_catalog_definition_hash_table;
+
 	/* The index catalog definition list
 	 */
 	libesedb_list_t *index_catalog_definition_list;
+
+	/* The catalog values tree leaf node index of the table catalog definition
+	 * Used to read the other catalog definitions of the table on demand
+	 */
+	int leaf_node_index;
+
+	/* Value to indicate the column, index, long value and callback catalog definitions have been read
+	 */
+	uint8_t values_read;
 };
 
 int libesedb_table_definition_initialize(
@@ -81,6 +96,23 @@ int libesedb_table_definition_set_callback_catalog_definition(
 int libesedb_table_definition_append_column_catalog_definition(
      libesedb_table_definition_t *table_definition,
      libesedb_catalog_definition_t *column_catalog_definition,
+     int ascii_codepage,
+     liberror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     liberror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libesedb_catalog_definition_t **column_catalog_definition,
      liberror_error_t **error );
 
 int libesedb_table_definition_append_index_catalog_definition(
@@ -37,6 +37,7 @@
 typedef struct libesedb_file {}		libesedb_file_t;
 typedef struct libesedb_table {}	libesedb_table_t;
 typedef struct libesedb_column {}	libesedb_column_t;
+typedef struct libesedb_cursor {}	libesedb_cursor_t;
 typedef struct libesedb_index {}	libesedb_index_t;
 typedef struct libesedb_record {}	libesedb_record_t;
 typedef struct libesedb_long_value {}	libesedb_long_value_t;
@@ -46,6 +47,7 @@ typedef struct libesedb_multi_value {}	libesedb_multi_value_t;
 typedef intptr_t libesedb_file_t;
 typedef intptr_t libesedb_table_t;
 typedef intptr_t libesedb_column_t;
+typedef intptr_t libesedb_cursor_t;
 typedef intptr_t libesedb_index_t;
 typedef intptr_t libesedb_record_t;
 typedef intptr_t libesedb_long_value_t;
@@ -156,6 +156,48 @@ int libesedb_values_tree_value_free(
 	return( 1 );
 }
 
+/* Clears the values tree value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_values_tree_value_clear(
+     libesedb_values_tree_value_t *values_tree_value,
+     liberror_error_t **error )
+{
+	static char *function = "libesedb_values_tree_value_clear";
+
+	if( values_tree_value == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values tree value.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_tree_value->key != NULL )
+	{
+		memory_free(
+		 values_tree_value->key );
+	}
+	if( memory_set(
+	     values_tree_value,
+	     0,
+	     sizeof( libesedb_values_tree_value_t ) ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values tree value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the common part of the key in the values tree value
  * Returns 1 if successful or -1 on error
  */
@@ -340,19 +382,21 @@ int libesedb_values_tree_value_set_key_local(
 }
 
 /* Reads the data
+ * The data is stored in the page, which is referenced and must be released
+ * with libesedb_page_cache_release_page when the data is no longer used
  * Returns 1 if successful or -1 on error
  */
 int libesedb_values_tree_value_read_data(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_t **page,
      uint8_t **data,
      size_t *data_size,
      liberror_error_t **error )
 {
-	libesedb_page_t *page             = NULL;
+	libesedb_page_t *safe_page        = NULL;
 	libesedb_page_value_t *page_value = NULL;
 	static char *function             = "libesedb_values_tree_value_read_data";
 
@@ -391,6 +435,17 @@ int libesedb_values_tree_value_read_data(
 
 		return( -1 );
 	}
+	if( page == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		liberror_error_set(
@@ -413,13 +468,11 @@ int libesedb_values_tree_value_read_data(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     file_io_handle,
+	if( libesedb_page_cache_get_page(
 	     pages_cache,
+	     file_io_handle,
 	     values_tree_value->page_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &safe_page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -431,9 +484,9 @@ int libesedb_values_tree_value_read_data(
 		 values_tree_value->page_number,
 		 values_tree_value->page_offset );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( page == NULL )
+	if( safe_page == NULL )
 	{
 		liberror_error_set(
 		 error,
@@ -442,10 +495,10 @@ int libesedb_values_tree_value_read_data(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value(
-	     page,
+	     safe_page,
 	     values_tree_value->page_value_index,
 	     &page_value,
 	     error ) != 1 )
@@ -458,7 +511,7 @@ int libesedb_values_tree_value_read_data(
 		 function,
 		 values_tree_value->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -470,7 +523,7 @@ int libesedb_values_tree_value_read_data(
 		 function,
 		 values_tree_value->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -481,7 +534,7 @@ int libesedb_values_tree_value_read_data(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( values_tree_value->data_offset > page_value->size )
 	{
@@ -492,38 +545,57 @@ int libesedb_values_tree_value_read_data(
 		 "%s: invalid values tree value - data offset exceeds page value size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	*page      = safe_page;
 	*data      = &( page_value->data[ values_tree_value->data_offset ] );
 	*data_size = (size_t) ( page_value->size - values_tree_value->data_offset );
 
 	return( 1 );
+
+on_error:
+	if( safe_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 pages_cache,
+		 &safe_page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the record
  * Uses the definition data in the catalog definitions
+ * Only the locations of the data type values are determined, the values
+ * are created from the copy of the record data when they are accessed
+ * If column identifiers are provided only the data of these columns is retrieved
  * Returns 1 if successful or -1 on error
  */
 int libesedb_values_tree_value_read_record(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libesedb_array_t *values_array,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     uint8_t **record_data,
+     size_t *record_data_size,
+     libesedb_data_type_definition_t **data_type_definitions,
+     int *number_of_data_type_definitions,
      liberror_error_t **error )
 {
 	libesedb_catalog_definition_t *column_catalog_definition        = NULL;
+	libesedb_data_type_definition_t *data_type_definition           = NULL;
+	libesedb_data_type_definition_t *safe_data_type_definitions     = NULL;
 	libesedb_list_element_t *column_catalog_definition_list_element = NULL;
 	libesedb_page_t *page                                           = NULL;
 	libesedb_page_value_t *page_value                               = NULL;
-	libfvalue_value_t *record_value                                 = NULL;
-	uint8_t *record_data                                            = NULL;
+	uint8_t *safe_record_data                                       = NULL;
 	uint8_t *tagged_data_type_offset_data                           = NULL;
 	static char *function                                           = "libesedb_values_tree_value_read_record";
-	size_t record_data_size                                         = 0;
+	size_t safe_record_data_size                                    = 0;
 	size_t remaining_definition_data_size                           = 0;
 	uint16_t fixed_size_data_type_value_offset                      = 0;
 	uint16_t previous_tagged_data_type_offset                       = 0;
@@ -542,13 +614,14 @@ int libesedb_values_tree_value_read_record(
 	uint8_t last_fixed_size_data_type                               = 0;
 	uint8_t last_variable_size_data_type                            = 0;
 	uint8_t number_of_variable_size_data_types                      = 0;
-	uint8_t record_value_type                                       = 0;
 	uint8_t tagged_data_types_format                                = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX;
+	uint8_t is_selected_column                                      = 0;
 	int column_catalog_definition_iterator                          = 0;
+	int column_identifier_index                                     = 0;
 	int number_of_column_catalog_definitions                        = 0;
+	int number_of_unread_column_identifiers                         = 0;
 	int number_of_table_column_catalog_definitions                  = 0;
 	int number_of_template_table_column_catalog_definitions         = 0;
-	int record_value_codepage                                       = 0;
 
 	if( values_tree_value == NULL )
 	{
@@ -595,6 +668,29 @@ int libesedb_values_tree_value_read_record(
 
 		return( -1 );
 	}
+	if( ( column_identifiers == NULL )
+	 && ( number_of_column_identifiers != 0 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_column_identifiers < 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of column identifiers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
 	if( table_definition->column_catalog_definition_list == NULL )
 	{
 		liberror_error_set(
@@ -618,24 +714,77 @@ int libesedb_values_tree_value_read_record(
 
 		return( -1 );
 	}
-	if( values_array == NULL )
+	if( record_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_data != NULL )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid values array.",
+		 "%s: invalid record data value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     file_io_handle,
+	if( record_data_size == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_type_definitions == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data type definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_type_definitions != NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data type definitions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_type_definitions == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of data type definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_get_page(
 	     pages_cache,
+	     file_io_handle,
 	     values_tree_value->page_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -710,10 +859,9 @@ int libesedb_values_tree_value_read_record(
 
 		goto on_error;
 	}
-	record_data      = &( page_value->data[ values_tree_value->data_offset ] );
-	record_data_size = page_value->size - values_tree_value->data_offset;
+	safe_record_data_size = page_value->size - values_tree_value->data_offset;
 
-	if( record_data_size < sizeof( esedb_data_definition_header_t ) )
+	if( safe_record_data_size < sizeof( esedb_data_definition_header_t ) )
 	{
 		liberror_error_set(
 		 error,
@@ -724,16 +872,63 @@ int libesedb_values_tree_value_read_record(
 
 		goto on_error;
 	}
+	/* The record data is copied since the page can be evicted from the cache
+	 * before the values are accessed
+	 */
+	safe_record_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * safe_record_data_size );
+
+	if( safe_record_data == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_record_data,
+	     &( page_value->data[ values_tree_value->data_offset ] ),
+	     safe_record_data_size ) == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_MEMORY,
+		 LIBERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The record data is a copy so the page is no longer needed
+	 */
+	if( libesedb_page_cache_release_page(
+	     pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
 	if( ( io_handle->format_version == 0x620 )
 	 && ( io_handle->format_revision <= 2 ) )
 	{
 		tagged_data_types_format = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_LINEAR;
 	}
-	last_fixed_size_data_type    = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
-	last_variable_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type;
+	last_fixed_size_data_type    = ( (esedb_data_definition_header_t *) safe_record_data )->last_fixed_size_data_type;
+	last_variable_size_data_type = ( (esedb_data_definition_header_t *) safe_record_data )->last_variable_size_data_type;
 
 	byte_stream_copy_to_uint16_little_endian(
-	 ( (esedb_data_definition_header_t *) record_data )->variable_size_data_types_offset,
+	 ( (esedb_data_definition_header_t *) safe_record_data )->variable_size_data_types_offset,
 	 variable_size_data_types_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -805,20 +1000,47 @@ int libesedb_values_tree_value_read_record(
 		}
 		number_of_column_catalog_definitions += number_of_template_table_column_catalog_definitions;
 	}
-	if( libesedb_array_resize(
-	     values_array,
-	     number_of_column_catalog_definitions,
-	     (int (*)(intptr_t **, liberror_error_t **)) &libfvalue_value_free,
-	     error ) != 1 )
+	if( number_of_column_catalog_definitions > 0 )
 	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize values array.",
-		 function );
+		if( (size_t) number_of_column_catalog_definitions > ( (size_t) SSIZE_MAX / sizeof( libesedb_data_type_definition_t ) ) )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of column catalog definitions value exceeds maximum.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		safe_data_type_definitions = (libesedb_data_type_definition_t *) memory_allocate(
+		                                                                  sizeof( libesedb_data_type_definition_t ) * number_of_column_catalog_definitions );
+
+		if( safe_data_type_definitions == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data type definitions.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     safe_data_type_definitions,
+		     0,
+		     sizeof( libesedb_data_type_definition_t ) * number_of_column_catalog_definitions ) == NULL )
+		{
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_MEMORY,
+			 LIBERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data type definitions.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( last_variable_size_data_type > 127 )
 	{
@@ -837,6 +1059,7 @@ int libesedb_values_tree_value_read_record(
 	current_variable_size_data_type      = 127;
 	variable_size_data_type_offset       = variable_size_data_types_offset;
 	variable_size_data_type_value_offset = variable_size_data_types_offset + ( number_of_variable_size_data_types * 2 );
+	number_of_unread_column_identifiers  = number_of_column_identifiers;
 
 	for( column_catalog_definition_iterator = 0;
 	     column_catalog_definition_iterator < number_of_column_catalog_definitions;
@@ -917,124 +1140,36 @@ int libesedb_values_tree_value_read_record(
 			  column_catalog_definition->column_type ) );
 		}
 #endif
-		switch( column_catalog_definition->column_type )
-		{
-			case LIBESEDB_COLUMN_TYPE_NULL:
-				/* TODO handle this value type */
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_CURRENCY:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
-				break;
+		is_selected_column = 1;
 
-			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_GUID:
-				record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
-			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_TEXT:
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
-				/* TODO handle this value type */
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
-				break;
-
-			default:
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported column type: %" PRIu32 ".",
-				 function,
-				 column_catalog_definition->column_type );
-
-				goto on_error;
-		}
-		if( libfvalue_value_initialize(
-		     &record_value,
-		     record_value_type,
-		     error ) != 1 )
+		if( column_identifiers != NULL )
 		{
-			liberror_error_set(
-			 error,
-			 LIBERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record value.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
-		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
-		{
-			record_value_codepage = (int) column_catalog_definition->codepage;
-
-			/* If the codepage is not set use the default codepage
+			/* Stop parsing the data once all the selected columns have been read
 			 */
-			if( record_value_codepage == 0 )
+			if( number_of_unread_column_identifiers == 0 )
 			{
-				record_value_codepage = io_handle->ascii_codepage;
+				break;
 			}
-			if( libfvalue_value_set_codepage(
-			     record_value,
-			     record_value_codepage,
-			     error ) != 1 )
+			is_selected_column = 0;
+
+			for( column_identifier_index = 0;
+			     column_identifier_index < number_of_column_identifiers;
+			     column_identifier_index++ )
 			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set value codepage.",
-				 function );
+				if( column_identifiers[ column_identifier_index ] == column_catalog_definition->identifier )
+				{
+					is_selected_column = 1;
 
-				goto on_error;
+					number_of_unread_column_identifiers--;
+
+					break;
+				}
 			}
 		}
+		data_type_definition = &( safe_data_type_definitions[ column_catalog_definition_iterator ] );
+
+		data_type_definition->column_catalog_definition = column_catalog_definition;
+
 		if( column_catalog_definition->identifier <= 127 )
 		{
 			if( column_catalog_definition->identifier <= last_fixed_size_data_type )
@@ -1048,38 +1183,36 @@ int libesedb_values_tree_value_read_record(
 					 column_catalog_definition->identifier,
 					 column_catalog_definition->size );
 					libnotify_print_data(
-					 &( record_data[ fixed_size_data_type_value_offset ] ),
+					 &( safe_record_data[ fixed_size_data_type_value_offset ] ),
 					 column_catalog_definition->size );
 				}
 #endif
-				if( libfvalue_value_set_data(
-				     record_value,
-				     &( record_data[ fixed_size_data_type_value_offset ] ),
-				     column_catalog_definition->size,
-				     LIBFVALUE_ENDIAN_LITTLE,
-				     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-				     error ) != 1 )
+				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
 				{
 					liberror_error_set(
 					 error,
 					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set data in fixed size data type definition.",
+					 LIBERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid common catalog definition size value exceeds maximum.",
 					 function );
 
 					goto on_error;
 				}
-				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+				if( ( (size_t) fixed_size_data_type_value_offset + column_catalog_definition->size ) > safe_record_data_size )
 				{
 					liberror_error_set(
 					 error,
 					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-					 "%s: invalid common catalog definition size value exceeds maximum.",
+					 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid fixed size data type size value exceeds record data size.",
 					 function );
 
 					goto on_error;
 				}
+				data_type_definition->data_offset = fixed_size_data_type_value_offset;
+				data_type_definition->data_size   = (uint16_t) column_catalog_definition->size;
+				data_type_definition->flags       = LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_DATA;
+
 				fixed_size_data_type_value_offset += (uint16_t) column_catalog_definition->size;
 			}
 		}
@@ -1087,8 +1220,19 @@ int libesedb_values_tree_value_read_record(
 		{
 			while( current_variable_size_data_type < column_catalog_definition->identifier )
 			{
+				if( ( (size_t) variable_size_data_type_offset + 2 ) > safe_record_data_size )
+				{
+					liberror_error_set(
+					 error,
+					 LIBERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid variable size data type offset value exceeds record data size.",
+					 function );
+
+					goto on_error;
+				}
 				byte_stream_copy_to_uint16_little_endian(
-				 &( record_data[ variable_size_data_type_offset ] ),
+				 &( safe_record_data[ variable_size_data_type_offset ] ),
 				 variable_size_data_type_size );
 
 				variable_size_data_type_offset += 2;
@@ -1120,27 +1264,25 @@ int libesedb_values_tree_value_read_record(
 							 function,
 							 column_catalog_definition->identifier );
 							libnotify_print_data(
-							 &( record_data[ variable_size_data_type_value_offset ] ),
+							 &( safe_record_data[ variable_size_data_type_value_offset ] ),
 							 variable_size_data_type_size - previous_variable_size_data_type_size );
 						}
 #endif
-						if( libfvalue_value_set_data(
-						     record_value,
-						     &( record_data[ variable_size_data_type_value_offset ] ),
-						     variable_size_data_type_size - previous_variable_size_data_type_size,
-						     LIBFVALUE_ENDIAN_LITTLE,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( ( (size_t) variable_size_data_type_value_offset + (uint16_t) ( variable_size_data_type_size - previous_variable_size_data_type_size ) ) > safe_record_data_size )
 						{
 							liberror_error_set(
 							 error,
 							 LIBERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in variable size data type definition.",
+							 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid variable size data type size value exceeds record data size.",
 							 function );
 
 							goto on_error;
 						}
+						data_type_definition->data_offset = variable_size_data_type_value_offset;
+						data_type_definition->data_size   = variable_size_data_type_size - previous_variable_size_data_type_size;
+						data_type_definition->flags       = LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_DATA;
+
 						variable_size_data_type_value_offset += variable_size_data_type_size - previous_variable_size_data_type_size;
 						previous_variable_size_data_type_size = variable_size_data_type_size;
 					}
@@ -1166,18 +1308,29 @@ int libesedb_values_tree_value_read_record(
 			{
 				if( tagged_data_types_offset == 0 )
 				{
+					if( ( (size_t) variable_size_data_type_value_offset + 4 ) > safe_record_data_size )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid tagged data types offset value exceeds record data size.",
+						 function );
+
+						goto on_error;
+					}
 					tagged_data_types_offset       = variable_size_data_type_value_offset;
 					tagged_data_type_value_offset  = variable_size_data_type_value_offset;
-					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
+					remaining_definition_data_size = safe_record_data_size - (size_t) tagged_data_types_offset;
 
 					byte_stream_copy_to_uint16_little_endian(
-					 &( record_data[ tagged_data_type_value_offset ] ),
+					 &( safe_record_data[ tagged_data_type_value_offset ] ),
 					 tagged_data_type_identifier );
 
 					tagged_data_type_value_offset += 2;
 
 					byte_stream_copy_to_uint16_little_endian(
-					 &( record_data[ tagged_data_type_value_offset ] ),
+					 &( safe_record_data[ tagged_data_type_value_offset ] ),
 					 tagged_data_type_size );
 
 					tagged_data_type_value_offset += 2;
@@ -1213,30 +1366,28 @@ int libesedb_values_tree_value_read_record(
 							 "%s: (%03" PRIu16 ") tagged data type flags\t\t: 0x%02" PRIx8 "\n",
 							 function,
 							 column_catalog_definition->identifier,
-							 record_data[ tagged_data_type_value_offset ] );
+							 safe_record_data[ tagged_data_type_value_offset ] );
 							libesedb_debug_print_tagged_data_type_flags(
-							 record_data[ tagged_data_type_value_offset ] );
+							 safe_record_data[ tagged_data_type_value_offset ] );
 							libnotify_printf(
 							 "\n" );
 						}
 #endif
 
-						if( libfvalue_value_set_metadata(
-						     record_value,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     1,
-						     LIBFVALUE_VALUE_METADATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( (size_t) tagged_data_type_value_offset >= safe_record_data_size )
 						{
 							liberror_error_set(
 							 error,
 							 LIBERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set tagged data type flags in tagged data type definition.",
+							 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type offset value exceeds record data size.",
 							 function );
 
 							goto on_error;
 						}
+						data_type_definition->data_offset = tagged_data_type_value_offset + 1;
+						data_type_definition->flags       = LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_METADATA;
+
 						tagged_data_type_value_offset  += 1;
 						tagged_data_type_size           = ( tagged_data_type_size & 0x5fff ) - 1;
 						remaining_definition_data_size -= 1;
@@ -1251,7 +1402,7 @@ int libesedb_values_tree_value_read_record(
 							 function,
 							 column_catalog_definition->identifier );
 							libnotify_print_data(
-							 &( record_data[ tagged_data_type_value_offset ] ),
+							 &( safe_record_data[ tagged_data_type_value_offset ] ),
 							 tagged_data_type_size );
 						}
 						else
@@ -1276,35 +1427,32 @@ int libesedb_values_tree_value_read_record(
 
 							goto on_error;
 						}
-						if( libfvalue_value_set_data(
-						     record_value,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     LIBFVALUE_ENDIAN_LITTLE,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( ( (size_t) tagged_data_type_value_offset + tagged_data_type_size ) > safe_record_data_size )
 						{
 							liberror_error_set(
 							 error,
 							 LIBERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
+							 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type size value exceeds record data size.",
 							 function );
 
 							goto on_error;
 						}
+						data_type_definition->data_offset = tagged_data_type_value_offset;
+						data_type_definition->data_size   = tagged_data_type_size;
+						data_type_definition->flags      |= LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_DATA;
 						remaining_definition_data_size -= tagged_data_type_size;
 					}
 					if( remaining_definition_data_size > 0 )
 					{
 						byte_stream_copy_to_uint16_little_endian(
-						 &( record_data[ tagged_data_type_value_offset ] ),
+						 &( safe_record_data[ tagged_data_type_value_offset ] ),
 						 tagged_data_type_identifier );
 
 						tagged_data_type_value_offset += 2;
 
 						byte_stream_copy_to_uint16_little_endian(
-						 &( record_data[ tagged_data_type_value_offset ] ),
+						 &( safe_record_data[ tagged_data_type_value_offset ] ),
 						 tagged_data_type_size );
 
 						tagged_data_type_value_offset += 2;
@@ -1317,11 +1465,22 @@ int libesedb_values_tree_value_read_record(
 			{
 				if( tagged_data_types_offset == 0 )
 				{
+					if( (size_t) variable_size_data_type_value_offset > safe_record_data_size )
+					{
+						liberror_error_set(
+						 error,
+						 LIBERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid tagged data types offset value exceeds record data size.",
+						 function );
+
+						goto on_error;
+					}
 					tagged_data_types_offset       = variable_size_data_type_value_offset;
-					tagged_data_type_offset_data   = &( record_data[ tagged_data_types_offset ] );
-					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
+					tagged_data_type_offset_data   = &( safe_record_data[ tagged_data_types_offset ] );
+					remaining_definition_data_size = safe_record_data_size - (size_t) tagged_data_types_offset;
 
-					if( remaining_definition_data_size > 0 )
+					if( remaining_definition_data_size >= 4 )
 					{
 						byte_stream_copy_to_uint16_little_endian(
 						 tagged_data_type_offset_data,
@@ -1346,6 +1505,18 @@ int libesedb_values_tree_value_read_record(
 
 							goto on_error;
 						}
+						if( ( ( tagged_data_type_offset & 0x3fff ) < 4 )
+						 || ( (size_t) ( tagged_data_type_offset & 0x3fff ) > remaining_definition_data_size ) )
+						{
+							liberror_error_set(
+							 error,
+							 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type offset value out of bounds.",
+							 function );
+
+							goto on_error;
+						}
 						tagged_data_type_offset_data_size = ( tagged_data_type_offset & 0x3fff ) - 4;
 
 						remaining_definition_data_size -= 4;
@@ -1513,29 +1684,27 @@ int libesedb_values_tree_value_read_record(
 								 "%s: (%03" PRIu16 ") tagged data type flags\t\t: 0x%02" PRIx8 "\n",
 								 function,
 								 column_catalog_definition->identifier,
-								 record_data[ tagged_data_type_value_offset ] );
+								 safe_record_data[ tagged_data_type_value_offset ] );
 								libesedb_debug_print_tagged_data_type_flags(
-								 record_data[ tagged_data_type_value_offset ] );
+								 safe_record_data[ tagged_data_type_value_offset ] );
 								libnotify_printf(
 								 "\n" );
 							}
 #endif
-							if( libfvalue_value_set_metadata(
-							     record_value,
-							     &( record_data[ tagged_data_type_value_offset ] ),
-							     1,
-							     LIBFVALUE_VALUE_METADATA_FLAG_MANAGED,
-							     error ) != 1 )
+							if( (size_t) tagged_data_type_value_offset >= safe_record_data_size )
 							{
 								liberror_error_set(
 								 error,
 								 LIBERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-								 "%s: unable to set tagged data type flags in tagged data type definition.",
+								 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: invalid tagged data type offset value exceeds record data size.",
 								 function );
 
 								goto on_error;
 							}
+							data_type_definition->data_offset = tagged_data_type_value_offset + 1;
+							data_type_definition->flags       = LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_METADATA;
+
 							tagged_data_type_value_offset += 1;
 							tagged_data_type_size         -= 1;
 						}
@@ -1547,7 +1716,7 @@ int libesedb_values_tree_value_read_record(
 							 function,
 							 column_catalog_definition->identifier );
 							libnotify_print_data(
-							 &( record_data[ tagged_data_type_value_offset ] ),
+							 &( safe_record_data[ tagged_data_type_value_offset ] ),
 							 tagged_data_type_size );
 						}
 #endif
@@ -1565,44 +1734,63 @@ int libesedb_values_tree_value_read_record(
 #endif
 					if( tagged_data_type_size > 0 )
 					{
-						if( libfvalue_value_set_data(
-						     record_value,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     LIBFVALUE_ENDIAN_LITTLE,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( ( (size_t) tagged_data_type_value_offset + tagged_data_type_size ) > safe_record_data_size )
 						{
 							liberror_error_set(
 							 error,
 							 LIBERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
+							 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type size value exceeds record data size.",
 							 function );
 
 							goto on_error;
 						}
+						data_type_definition->data_offset = tagged_data_type_value_offset;
+						data_type_definition->data_size   = tagged_data_type_size;
+						data_type_definition->flags      |= LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_DATA;
 					}
 				}
 			}
 		}
-		if( libesedb_array_set_entry_by_index(
-		     values_array,
-		     column_catalog_definition_iterator,
-		     (intptr_t *) record_value,
-		     error ) != 1 )
+		/* The offsets of the columns that were not selected are still parsed
+		 * to be able to determine the offsets of the columns that follow
+		 */
+		if( is_selected_column == 0 )
+		{
+			data_type_definition->data_offset = 0;
+			data_type_definition->data_size   = 0;
+			data_type_definition->flags       = 0;
+		}
+		if( ( column_catalog_definition_list_element->next_element == NULL )
+		 && ( template_table_definition != NULL )
+		 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+		{
+			column_catalog_definition_list_element = table_definition->column_catalog_definition_list->first_element;
+		}
+		else
+		{
+			column_catalog_definition_list_element = column_catalog_definition_list_element->next_element;
+		}
+	}
+	/* The remaining columns were not selected, only set their column catalog definitions
+	 */
+	while( column_catalog_definition_iterator < number_of_column_catalog_definitions )
+	{
+		if( ( column_catalog_definition_list_element == NULL )
+		 || ( column_catalog_definition_list_element->value == NULL ) )
 		{
 			liberror_error_set(
 			 error,
-			 LIBERROR_ERROR_DOMAIN_MEMORY,
-			 LIBERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data type definition: %d.",
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition list element: %d.",
 			 function,
 			 column_catalog_definition_iterator );
 
 			goto on_error;
 		}
-		record_value = NULL;
+		safe_data_type_definitions[ column_catalog_definition_iterator ].column_catalog_definition =
+		 (libesedb_catalog_definition_t *) column_catalog_definition_list_element->value;
 
 		if( ( column_catalog_definition_list_element->next_element == NULL )
 		 && ( template_table_definition != NULL )
@@ -1614,6 +1802,7 @@ int libesedb_values_tree_value_read_record(
 		{
 			column_catalog_definition_list_element = column_catalog_definition_list_element->next_element;
 		}
+		column_catalog_definition_iterator++;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
@@ -1624,22 +1813,38 @@ int libesedb_values_tree_value_read_record(
 			 "%s: fixed size data types trailing data:\n",
 			 function );
 			libnotify_print_data(
-			 &( record_data[ fixed_size_data_type_value_offset ] ),
+			 &( safe_record_data[ fixed_size_data_type_value_offset ] ),
 			 variable_size_data_types_offset - fixed_size_data_type_value_offset );
 		}
 		libnotify_printf(
 		 "\n" );
 	}
 #endif
+	*record_data                     = safe_record_data;
+	*record_data_size                = safe_record_data_size;
+	*data_type_definitions           = safe_data_type_definitions;
+	*number_of_data_type_definitions = number_of_column_catalog_definitions;
+
 	return( 1 );
 
 on_error:
-	if( record_value != NULL )
+	if( page != NULL )
 	{
-		libfvalue_value_free(
-		 &record_value,
+		libesedb_page_cache_release_page(
+		 pages_cache,
+		 &page,
 		 NULL );
 	}
+	if( safe_data_type_definitions != NULL )
+	{
+		memory_free(
+		 safe_data_type_definitions );
+	}
+	if( safe_record_data != NULL )
+	{
+		memory_free(
+		 safe_record_data );
+	}
 	return( -1 );
 }
 
@@ -1649,8 +1854,7 @@ on_error:
 int libesedb_values_tree_value_read_long_value(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      liberror_error_t **error )
 {
 	libesedb_page_t *page             = NULL;
@@ -1683,13 +1887,11 @@ int libesedb_values_tree_value_read_long_value(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     file_io_handle,
+	if( libesedb_page_cache_get_page(
 	     pages_cache,
+	     file_io_handle,
 	     values_tree_value->page_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1701,7 +1903,7 @@ int libesedb_values_tree_value_read_long_value(
 		 values_tree_value->page_number,
 		 values_tree_value->page_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page == NULL )
 	{
@@ -1712,7 +1914,7 @@ int libesedb_values_tree_value_read_long_value(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value(
 	     page,
@@ -1728,7 +1930,7 @@ int libesedb_values_tree_value_read_long_value(
 		 function,
 		 values_tree_value->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1740,7 +1942,7 @@ int libesedb_values_tree_value_read_long_value(
 		 function,
 		 values_tree_value->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -1751,7 +1953,7 @@ int libesedb_values_tree_value_read_long_value(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( values_tree_value->data_offset > page_value->size )
 	{
@@ -1762,7 +1964,7 @@ int libesedb_values_tree_value_read_long_value(
 		 "%s: invalid values tree value - data offset exceeds page value size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	long_value_data      = &( page_value->data[ values_tree_value->data_offset ] );
 	long_value_data_size = page_value->size - values_tree_value->data_offset;
@@ -1777,7 +1979,7 @@ int libesedb_values_tree_value_read_long_value(
 		 function,
 		 long_value_data_size );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libnotify_verbose != 0 )
@@ -1823,7 +2025,31 @@ int libesedb_values_tree_value_read_long_value(
 		 "\n" );
 	}
 #endif
+	if( libesedb_page_cache_release_page(
+	     pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the long value segment
@@ -1833,8 +2059,7 @@ int libesedb_values_tree_value_read_long_value_segment(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      uint32_t long_value_segment_offset,
      libfdata_block_t *data_block,
      liberror_error_t **error )
@@ -1880,13 +2105,11 @@ int libesedb_values_tree_value_read_long_value_segment(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     file_io_handle,
+	if( libesedb_page_cache_get_page(
 	     pages_cache,
+	     file_io_handle,
 	     values_tree_value->page_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		liberror_error_set(
@@ -1898,7 +2121,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 values_tree_value->page_number,
 		 values_tree_value->page_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page == NULL )
 	{
@@ -1909,7 +2132,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value(
 	     page,
@@ -1925,7 +2148,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 function,
 		 values_tree_value->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1937,7 +2160,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 function,
 		 values_tree_value->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -1948,7 +2171,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( values_tree_value->data_offset > page_value->size )
 	{
@@ -1959,7 +2182,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 "%s: invalid values tree value - data offset exceeds page value size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	long_value_segment_data_size = page_value->size - values_tree_value->data_offset;
 
@@ -1994,7 +2217,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 "%s: unable to retrieve number of data block size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( long_value_segment_offset != (off64_t) data_size )
 	{
@@ -2007,7 +2230,7 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 long_value_segment_offset,
 		 data_size );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libfdata_block_append_segment(
 	     data_block,
@@ -2024,8 +2247,32 @@ int libesedb_values_tree_value_read_long_value_segment(
 		 function,
 		 long_value_segment_offset );
 
+		goto on_error;
+	}
+	if( libesedb_page_cache_release_page(
+	     pages_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
 		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 pages_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
@@ -28,10 +28,12 @@
 #include <liberror.h>
 
 #include "libesedb_array_type.h"
+#include "libesedb_catalog_definition.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -46,6 +48,37 @@ enum LIBESEDB_VALUES_TREE_VALUE_TYPES
 	LIBESEDB_VALUES_TREE_VALUE_TYPE_RECORD		= (uint8_t) 'r',
 };
 
+enum LIBESEDB_DATA_TYPE_DEFINITION_FLAGS
+{
+	LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_DATA	= 0x01,
+
+	/* The metadata (tagged data type flags) is stored
+	 * in the byte preceding the data
+	 */
+	LIBESEDB_DATA_TYPE_DEFINITION_FLAG_HAS_METADATA	= 0x02
+};
+
+typedef struct libesedb_data_type_definition libesedb_data_type_definition_t;
+
+struct libesedb_data_type_definition
+{
+	/* The column catalog definition
+	 */
+	libesedb_catalog_definition_t *column_catalog_definition;
+
+	/* The data offset relative to the start of the record data
+	 */
+	uint16_t data_offset;
+
+	/* The data size
+	 */
+	uint16_t data_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+};
+
 typedef struct libesedb_values_tree_value libesedb_values_tree_value_t;
 
 struct libesedb_values_tree_value
@@ -91,6 +124,10 @@ int libesedb_values_tree_value_free(
      libesedb_values_tree_value_t **values_tree_value,
      liberror_error_t **error );
 
+int libesedb_values_tree_value_clear(
+     libesedb_values_tree_value_t *values_tree_value,
+     liberror_error_t **error );
+
 int libesedb_values_tree_value_set_key_common(
      libesedb_values_tree_value_t *values_tree_value,
      uint8_t *common_key,
@@ -107,8 +144,8 @@ int libesedb_values_tree_value_read_data(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
+     libesedb_page_t **page,
      uint8_t **data,
      size_t *data_size,
      liberror_error_t **error );
@@ -117,26 +154,28 @@ int libesedb_values_tree_value_read_record(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libesedb_array_t *values_array,
+     uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     uint8_t **record_data,
+     size_t *record_data_size,
+     libesedb_data_type_definition_t **data_type_definitions,
+     int *number_of_data_type_definitions,
      liberror_error_t **error );
 
 int libesedb_values_tree_value_read_long_value(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      liberror_error_t **error );
 
 int libesedb_values_tree_value_read_long_value_segment(
      libesedb_values_tree_value_t *values_tree_value,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *pages_cache,
      uint32_t long_value_segment_offset,
      libfdata_block_t *data_block,
      liberror_error_t **error );
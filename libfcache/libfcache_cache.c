@@ -31,6 +31,13 @@
 #include "libfcache_definitions.h"
 #include "libfcache_types.h"
 
+/* Calculates the set index of a cache value identifier
+ * The identifier is scrambled using a multiplicative hash so that values
+ * with a regular offset stride are spread over all the sets
+ */
+#define libfcache_cache_calculate_set_index( offset, timestamp, number_of_sets ) \
+	(int) ( ( ( ( (uint64_t) ( offset ) ^ (uint64_t) ( timestamp ) ) * 0x9e3779b97f4a7c15ULL ) >> 32 ) % (uint64_t) ( number_of_sets ) )
+
 /* Initializes the cache
  * Returns 1 if successful or -1 on error
  */
@@ -117,6 +124,12 @@ int libfcache_cache_initialize(
 
 		goto on_error;
 	}
+	internal_cache->number_of_sets = maximum_cache_entries / LIBFCACHE_CACHE_NUMBER_OF_WAYS;
+
+	if( ( maximum_cache_entries % LIBFCACHE_CACHE_NUMBER_OF_WAYS ) != 0 )
+	{
+		internal_cache->number_of_sets += 1;
+	}
 	*cache = (libfcache_cache_t *) internal_cache;
 
 	return( 1 );
@@ -536,3 +549,268 @@ int libfcache_cache_set_value_by_index(
 	return( 1 );
 }
 
+/* Retrieves the cache value for the specific identifier
+ * The cache is set associative, the identifier determines the set of
+ * LIBFCACHE_CACHE_NUMBER_OF_WAYS cache entries that can contain the value
+ * Do not mix the index and identifier based functions on the same cache
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_cache_get_value_by_identifier(
+     libfcache_cache_t *cache,
+     off64_t offset,
+     time_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     liberror_error_t **error )
+{
+	libfcache_cache_value_t *safe_cache_value  = NULL;
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                     = "libfcache_cache_get_value_by_identifier";
+	int cache_entry_index                      = 0;
+	int last_cache_entry_index                 = 0;
+
+	if( cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( internal_cache->entries == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache - missing entries array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->number_of_sets <= 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache - number of sets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry_index = libfcache_cache_calculate_set_index(
+	                     offset,
+	                     timestamp,
+	                     internal_cache->number_of_sets )
+	                  * LIBFCACHE_CACHE_NUMBER_OF_WAYS;
+
+	last_cache_entry_index = cache_entry_index + LIBFCACHE_CACHE_NUMBER_OF_WAYS;
+
+	if( last_cache_entry_index > internal_cache->entries->number_of_entries )
+	{
+		last_cache_entry_index = internal_cache->entries->number_of_entries;
+	}
+	while( cache_entry_index < last_cache_entry_index )
+	{
+		safe_cache_value = (libfcache_cache_value_t *) internal_cache->entries->entries[ cache_entry_index ];
+
+		if( ( safe_cache_value != NULL )
+		 && ( safe_cache_value->offset == offset )
+		 && ( safe_cache_value->timestamp == timestamp ) )
+		{
+			internal_cache->access_counter += 1;
+
+			safe_cache_value->access_time = internal_cache->access_counter;
+
+			*cache_value = safe_cache_value;
+
+			return( 1 );
+		}
+		cache_entry_index++;
+	}
+	*cache_value = NULL;
+
+	return( 0 );
+}
+
+/* Sets the cache value for the specific identifier
+ * If the set of the identifier is full the least recently used cache value
+ * in the set is replaced
+ * Do not mix the index and identifier based functions on the same cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_value_by_identifier(
+     libfcache_cache_t *cache,
+     off64_t offset,
+     time_t timestamp,
+     intptr_t *value,
+     int (*free_value)(
+            intptr_t **value,
+            liberror_error_t **error ),
+     uint8_t flags,
+     liberror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value       = NULL;
+	libfcache_cache_value_t *safe_cache_value  = NULL;
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                     = "libfcache_cache_set_value_by_identifier";
+	int cache_entry_index                      = 0;
+	int free_cache_entry_index                 = -1;
+	int last_cache_entry_index                 = 0;
+	int least_recently_used_cache_entry_index  = -1;
+
+	if( cache == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( internal_cache->entries == NULL )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache - missing entries array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->number_of_sets <= 0 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache - number of sets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry_index = libfcache_cache_calculate_set_index(
+	                     offset,
+	                     timestamp,
+	                     internal_cache->number_of_sets )
+	                  * LIBFCACHE_CACHE_NUMBER_OF_WAYS;
+
+	last_cache_entry_index = cache_entry_index + LIBFCACHE_CACHE_NUMBER_OF_WAYS;
+
+	if( last_cache_entry_index > internal_cache->entries->number_of_entries )
+	{
+		last_cache_entry_index = internal_cache->entries->number_of_entries;
+	}
+	/* Prefer the cache value with the same identifier, then an empty cache entry
+	 * and then the least recently used cache value
+	 */
+	while( cache_entry_index < last_cache_entry_index )
+	{
+		safe_cache_value = (libfcache_cache_value_t *) internal_cache->entries->entries[ cache_entry_index ];
+
+		if( safe_cache_value == NULL )
+		{
+			if( free_cache_entry_index == -1 )
+			{
+				free_cache_entry_index = cache_entry_index;
+			}
+		}
+		else if( ( safe_cache_value->offset == offset )
+		      && ( safe_cache_value->timestamp == timestamp ) )
+		{
+			cache_value = safe_cache_value;
+
+			break;
+		}
+		else if( ( least_recently_used_cache_entry_index == -1 )
+		      || ( safe_cache_value->access_time < ( (libfcache_cache_value_t *) internal_cache->entries->entries[ least_recently_used_cache_entry_index ] )->access_time ) )
+		{
+			least_recently_used_cache_entry_index = cache_entry_index;
+		}
+		cache_entry_index++;
+	}
+	if( cache_value == NULL )
+	{
+		if( free_cache_entry_index == -1 )
+		{
+			cache_value = (libfcache_cache_value_t *) internal_cache->entries->entries[ least_recently_used_cache_entry_index ];
+		}
+		else
+		{
+			if( libfcache_cache_value_initialize(
+			     &cache_value,
+			     error ) != 1 )
+			{
+				liberror_error_set(
+				 error,
+				 LIBERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create cache value.",
+				 function );
+
+				return( -1 );
+			}
+			internal_cache->entries->entries[ free_cache_entry_index ] = (intptr_t *) cache_value;
+
+			internal_cache->number_of_cache_values++;
+		}
+	}
+	if( libfcache_cache_value_set_value(
+	     cache_value,
+	     value,
+	     free_value,
+	     flags,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value in cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_set_identifier(
+	     cache_value,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set identifier in cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache->access_counter += 1;
+
+	cache_value->access_time = internal_cache->access_counter;
+
+	return( 1 );
+}
+
@@ -37,6 +37,10 @@
 extern "C" {
 #endif
 
+/* The number of cache entries per set used by the identifier based functions
+ */
+#define LIBFCACHE_CACHE_NUMBER_OF_WAYS		8
+
 typedef struct libfcache_internal_cache libfcache_internal_cache_t;
 
 struct libfcache_internal_cache
@@ -48,6 +52,14 @@ struct libfcache_internal_cache
 	/* The number of cache values
 	 */
 	int number_of_cache_values;
+
+	/* The number of sets
+	 */
+	int number_of_sets;
+
+	/* The access counter
+	 */
+	uint64_t access_counter;
 };
 
 LIBFCACHE_EXTERN \
@@ -102,6 +114,24 @@ int libfcache_cache_set_value_by_index(
      uint8_t flags,
      liberror_error_t **error );
 
+int libfcache_cache_get_value_by_identifier(
+     libfcache_cache_t *cache,
+     off64_t offset,
+     time_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     liberror_error_t **error );
+
+int libfcache_cache_set_value_by_identifier(
+     libfcache_cache_t *cache,
+     off64_t offset,
+     time_t timestamp,
+     intptr_t *value,
+     int (*free_value)(
+            intptr_t **value,
+            liberror_error_t **error ),
+     uint8_t flags,
+     liberror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
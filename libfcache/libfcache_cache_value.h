@@ -58,6 +58,11 @@ struct libfcache_cache_value
 	/* The flags
 	 */
 	uint8_t flags;
+
+	/* The access time
+	 * Used to determine the least recently used cache value
+	 */
+	uint64_t access_time;
 };
 
 int libfcache_cache_value_initialize(
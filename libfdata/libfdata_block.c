@@ -59,6 +59,7 @@ int libfdata_block_initialize(
                 intptr_t *io_handle,
                 libbfio_handle_t *file_io_handle,
                 int segment_index,
+                off64_t segment_offset,
                 uint8_t *data,
                 size_t data_size,
                 uint8_t read_flags,
@@ -943,30 +944,11 @@ int libfdata_block_get_data(
 
 				return( -1 );
 			}
-			if( libbfio_handle_seek_offset(
-			     file_io_handle,
-			     segment_offset,
-			     SEEK_SET,
-			     error ) == -1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_IO,
-				 LIBERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek segment offset: %" PRIi64 ".",
-				 function,
-				 segment_offset );
-
-				libfdata_buffer_free(
-				 &data_buffer,
-				 NULL );
-
-				return( -1 );
-			}
 			read_count = internal_block->read_segment_data(
 				      internal_block->io_handle,
 				      file_io_handle,
 				      segment_index,
+				      segment_offset,
 				      &( data_buffer_data[ data_offset ] ),
 				      (size_t) segment_size,
 				      0,
@@ -2150,26 +2132,11 @@ int libfdata_block_read_element_data(
 
 		goto on_error;
 	}
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     element_data_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_IO,
-		 LIBERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek element data offset: %" PRIi64 ".",
-		 function,
-		 element_data_offset );
-
-		goto on_error;
-	}
 	read_count = internal_block->read_segment_data(
 		      internal_block->io_handle,
 		      file_io_handle,
 		      segment_index,
+		      element_data_offset,
 		      data_buffer_data,
 		      (size_t) element_data_size,
 		      read_flags,
@@ -2216,13 +2183,14 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the segment data into the buffer
+/* Reads the segment data at the segment offset into the buffer
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libfdata_block_read_segment_data(
          intptr_t *io_handle LIBFDATA_ATTRIBUTE_UNUSED,
          libbfio_handle_t *file_io_handle,
          int segment_index LIBFDATA_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
          uint8_t *data,
          size_t data_size,
          uint8_t read_flags LIBFDATA_ATTRIBUTE_UNUSED,
@@ -2235,10 +2203,11 @@ ssize_t libfdata_block_read_segment_data(
 	LIBFDATA_UNREFERENCED_PARAMETER( segment_index )
 	LIBFDATA_UNREFERENCED_PARAMETER( read_flags )
 
-	read_count = libbfio_handle_read(
+	read_count = libbfio_handle_read_at(
 		      file_io_handle,
 		      data,
 		      data_size,
+		      segment_offset,
 		      error );
 
 	if( read_count != (ssize_t) data_size )
@@ -2247,8 +2216,9 @@ ssize_t libfdata_block_read_segment_data(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_IO,
 		 LIBERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read segment data.",
-		 function );
+		 "%s: unable to read segment data at offset: %" PRIi64 ".",
+		 function,
+		 segment_offset );
 
 		return( -1 );
 	}
@@ -83,6 +83,7 @@ struct libfdata_internal_block
 	           intptr_t *io_handle,
 	           libbfio_handle_t *file_io_handle,
                    int segment_index,
+	           off64_t segment_offset,
 	           uint8_t *data,
 	           size_t data_size,
                    uint8_t read_flags,
@@ -104,6 +105,7 @@ int libfdata_block_initialize(
                 intptr_t *io_handle,
                 libbfio_handle_t *file_io_handle,
                 int segment_index,
+                off64_t segment_offset,
                 uint8_t *data,
                 size_t data_size,
                 uint8_t read_flags,
@@ -241,6 +243,7 @@ ssize_t libfdata_block_read_segment_data(
          intptr_t *io_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index,
+         off64_t segment_offset,
          uint8_t *data,
          size_t data_size,
          uint8_t read_flags,
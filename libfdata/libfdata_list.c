@@ -34,9 +34,6 @@
 #include "libfdata_list_element.h"
 #include "libfdata_types.h"
 
-#define libfdata_list_calculate_cache_entry_index( element_index, number_of_cache_entries ) \
-	element_index % number_of_cache_entries
-
 /* Initializes the list
  *
  * If the flag LIBFDATA_FLAG_IO_HANDLE_MANAGED is set the list
@@ -1810,15 +1807,11 @@ int libfdata_list_get_element_value(
 	libfcache_cache_value_t *cache_value     = NULL;
 	libfdata_internal_list_t *internal_list = NULL;
 	static char *function                   = "libfdata_list_get_element_value";
-        off64_t cache_value_offset              = (off64_t) -1;
 	off64_t range_offset                    = 0;
 	size64_t range_size                     = 0;
-	time_t cache_value_timestamp            = 0;
 	time_t element_timestamp                = 0;
 	uint32_t range_flags                    = 0;
-	int cache_entry_index                   = -1;
 	int element_index                       = -1;
-	int number_of_cache_entries             = 0;
 	int result                              = 0;
 
 	if( list == NULL )
@@ -1850,16 +1843,16 @@ int libfdata_list_get_element_value(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
-	     cache,
-	     &number_of_cache_entries,
+	if( libfdata_list_element_get_timestamp(
+	     element,
+	     &element_timestamp,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
+		 "%s: unable to retrieve time stamp from list element.",
 		 function );
 
 		return( -1 );
@@ -1878,96 +1871,45 @@ int libfdata_list_get_element_value(
 
 		return( -1 );
 	}
-	if( number_of_cache_entries <= 0 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( ( read_flags & LIBFDATA_READ_FLAG_IGNORE_CACHE ) == 0 )
 	{
-		cache_entry_index = libfdata_list_calculate_cache_entry_index(
-		                     element_index,
-		                     number_of_cache_entries );
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          range_offset,
+		          element_timestamp,
+		          &cache_value,
+		          error );
 
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
+			 "%s: unable to retrieve cache value of element: %d.",
 			 function,
-			 cache_entry_index );
+			 element_index );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libfdata_list_element_get_timestamp(
-			     element,
-			     &element_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve time stamp from list element.",
-				 function );
-
-				return( -1 );
-			}
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( ( range_offset == cache_value_offset )
-		 && ( element_timestamp == cache_value_timestamp ) )
-		{
-			result = 1;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
 		{
 			if( result == 0 )
 			{
 				libnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " miss (%d out of %d)\n",
+				 "%s: cache: 0x%08" PRIjx " miss for element: %d\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index,
-				 number_of_cache_entries );
+				 element_index );
 			}
 			else
 			{
 				libnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " hit (%d out of %d)\n",
+				 "%s: cache: 0x%08" PRIjx " hit for element: %d\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index,
-				 number_of_cache_entries );
+				 element_index );
 			}
 		}
 #endif
@@ -2008,60 +1950,26 @@ int libfdata_list_get_element_value(
 
 			return( -1 );
 		}
-		cache_entry_index = libfdata_list_calculate_cache_entry_index(
-		                     element_index,
-		                     number_of_cache_entries );
-
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
-		     error ) != 1 )
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          range_offset,
+		          element_timestamp,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
+			 "%s: unable to retrieve cache value of element: %d.",
 			 function,
-			 cache_entry_index );
+			 element_index );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libfdata_list_element_get_timestamp(
-			     element,
-			     &element_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve time stamp from list element.",
-				 function );
-
-				return( -1 );
-			}
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( ( range_offset != cache_value_offset )
-		 || ( element_timestamp != cache_value_timestamp ) )
+		else if( result == 0 )
 		{
 			liberror_error_set(
 			 error,
@@ -2230,14 +2138,12 @@ int libfdata_list_set_element_value(
      uint8_t flags,
      liberror_error_t **error )
 {
-	static char *function       = "libfdata_list_set_element_value";
-	off64_t range_offset        = 0;
-	size64_t range_size         = 0;
-	time_t element_timestamp    = 0;
-	uint32_t range_flags        = 0;
-	int cache_entry_index       = -1;
-	int element_index           = -1;
-	int number_of_cache_entries = 0;
+	static char *function    = "libfdata_list_set_element_value";
+	off64_t range_offset     = 0;
+	size64_t range_size      = 0;
+	time_t element_timestamp = 0;
+	uint32_t range_flags     = 0;
+	int element_index        = -1;
 
 	if( list == NULL )
 	{
@@ -2280,20 +2186,6 @@ int libfdata_list_set_element_value(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
-	     cache,
-	     &number_of_cache_entries,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
-		 function );
-
-		return( -1 );
-	}
 	if( libfdata_list_element_get_element_index(
 	     element,
 	     &element_index,
@@ -2308,25 +2200,9 @@ int libfdata_list_set_element_value(
 
 		return( -1 );
 	}
-	if( number_of_cache_entries <= 0 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	cache_entry_index = libfdata_list_calculate_cache_entry_index(
-	                     element_index,
-	                     number_of_cache_entries );
-
-	if( libfcache_cache_set_value_by_index(
+	if( libfcache_cache_set_value_by_identifier(
 	     cache,
-	     cache_entry_index,
-	     (int64_t) range_offset,
+	     range_offset,
 	     element_timestamp,
 	     element_value,
 	     free_element_value,
@@ -2337,9 +2213,9 @@ int libfdata_list_set_element_value(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value in cache entry: %d.",
+		 "%s: unable to set cache value of element: %d.",
 		 function,
-		 cache_entry_index );
+		 element_index );
 
 		return( -1 );
 	}
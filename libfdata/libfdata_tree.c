@@ -425,14 +425,10 @@ int libfdata_tree_get_node_value(
 	libfcache_cache_value_t *cache_value     = NULL;
 	libfdata_internal_tree_t *internal_tree = NULL;
 	static char *function                   = "libfdata_tree_get_node_value";
-	off64_t cache_value_offset              = (off64_t) -1;
 	off64_t node_data_offset                = 0;
 	size64_t node_data_size                 = 0;
-	time_t cache_value_timestamp            = 0;
 	time_t node_timestamp                   = 0;
 	uint32_t node_data_flags                = 0;
-	int cache_entry_index                   = -1;
-	int number_of_cache_entries             = 0;
 	int result                              = 0;
 
 	if( tree == NULL )
@@ -475,119 +471,59 @@ int libfdata_tree_get_node_value(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
-	     cache,
-	     &number_of_cache_entries,
+	if( libfdata_tree_node_get_timestamp(
+	     node,
+	     &node_timestamp,
 	     error ) != 1 )
 	{
 		liberror_error_set(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_cache_entries <= 0 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
+		 "%s: unable to retrieve time stamp from tree node.",
 		 function );
 
 		return( -1 );
 	}
 	if( ( read_flags & LIBFDATA_READ_FLAG_IGNORE_CACHE ) == 0 )
 	{
-		if( ( ( ( (libfdata_internal_tree_node_t *) node )->flags & LIBFDATA_TREE_NODE_FLAG_IS_VIRTUAL ) == 0 )
-		 && ( ( ( (libfdata_internal_tree_node_t *) node )->flags & LIBFDATA_TREE_NODE_FLAG_IS_LEAF ) != 0 ) )
-		{
-			cache_entry_index = libfdata_tree_node_calculate_leaf_node_cache_entry_index(
-			                     node_data_offset,
-			                     number_of_cache_entries );
-		}
-		else
-		{
-			cache_entry_index = libfdata_tree_node_calculate_branch_node_cache_entry_index(
-			                     node_data_offset,
-			                     number_of_cache_entries );
-		}
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
-		     error ) != 1 )
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          node_data_offset,
+		          node_timestamp,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
+			 "%s: unable to retrieve cache value of node at offset: %" PRIi64 ".",
 			 function,
-			 cache_entry_index );
+			 node_data_offset );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libfdata_tree_node_get_timestamp(
-			     node,
-			     &node_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve time stamp from tree node.",
-				 function );
-
-				return( -1 );
-			}
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( ( node_data_offset == cache_value_offset )
-		 && ( node_timestamp == cache_value_timestamp ) )
-		{
-			result = 1;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
 		{
 			if( result == 0 )
 			{
 				libnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " miss (entry: %d, want: %" PRIi64 ", got: %" PRIi64 ")\n",
+				 "%s: cache: 0x%08" PRIjx " miss for node at offset: %" PRIi64 "\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index,
-				 node_data_offset,
-				 cache_value_offset );
+				 node_data_offset );
 			}
 			else
 			{
 				libnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " hit (entry: %d)\n",
+				 "%s: cache: 0x%08" PRIjx " hit for node at offset: %" PRIi64 "\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index );
+				 node_data_offset );
 			}
 		}
 #endif
@@ -627,69 +563,26 @@ int libfdata_tree_get_node_value(
 
 			return( -1 );
 		}
-		if( ( ( ( (libfdata_internal_tree_node_t *) node )->flags & LIBFDATA_TREE_NODE_FLAG_IS_VIRTUAL ) == 0 )
-		 && ( ( ( (libfdata_internal_tree_node_t *) node )->flags & LIBFDATA_TREE_NODE_FLAG_IS_LEAF ) != 0 ) )
-		{
-			cache_entry_index = libfdata_tree_node_calculate_leaf_node_cache_entry_index(
-			                     node_data_offset,
-			                     number_of_cache_entries );
-		}
-		else
-		{
-			cache_entry_index = libfdata_tree_node_calculate_branch_node_cache_entry_index(
-			                     node_data_offset,
-			                     number_of_cache_entries );
-		}
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
-		     error ) != 1 )
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          node_data_offset,
+		          node_timestamp,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
+			 "%s: unable to retrieve cache value of node at offset: %" PRIi64 ".",
 			 function,
-			 cache_entry_index );
+			 node_data_offset );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libfdata_tree_node_get_timestamp(
-			     node,
-			     &node_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve time stamp from tree node.",
-				 function );
-
-				return( -1 );
-			}
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( ( node_data_offset != cache_value_offset )
-		 || ( node_timestamp != cache_value_timestamp ) )
+		else if( result == 0 )
 		{
 			liberror_error_set(
 			 error,
@@ -737,13 +630,11 @@ int libfdata_tree_set_node_value(
      uint8_t flags,
      liberror_error_t **error )
 {
-	static char *function       = "libfdata_tree_set_node_value";
-	off64_t node_data_offset    = 0;
-	size64_t node_data_size     = 0;
-	time_t node_timestamp       = 0;
-	uint32_t node_data_flags    = 0;
-	int cache_entry_index       = -1;
-	int number_of_cache_entries = 0;
+	static char *function    = "libfdata_tree_set_node_value";
+	off64_t node_data_offset = 0;
+	size64_t node_data_size  = 0;
+	time_t node_timestamp    = 0;
+	uint32_t node_data_flags = 0;
 
 	if( tree == NULL )
 	{
@@ -786,48 +677,9 @@ int libfdata_tree_set_node_value(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
-	     cache,
-	     &number_of_cache_entries,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_cache_entries <= 0 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( ( ( (libfdata_internal_tree_node_t *) node )->flags & LIBFDATA_TREE_NODE_FLAG_IS_VIRTUAL ) == 0 )
-	 && ( ( ( (libfdata_internal_tree_node_t *) node )->flags & LIBFDATA_TREE_NODE_FLAG_IS_LEAF ) != 0 ) )
-	{
-		cache_entry_index = libfdata_tree_node_calculate_leaf_node_cache_entry_index(
-				     node_data_offset,
-				     number_of_cache_entries );
-	}
-	else
-	{
-		cache_entry_index = libfdata_tree_node_calculate_branch_node_cache_entry_index(
-				     node_data_offset,
-				     number_of_cache_entries );
-	}
-	if( libfcache_cache_set_value_by_index(
+	if( libfcache_cache_set_value_by_identifier(
 	     cache,
-	     cache_entry_index,
-	     (int64_t) node_data_offset,
+	     node_data_offset,
 	     node_timestamp,
 	     node_value,
 	     free_node_value,
@@ -838,9 +690,9 @@ int libfdata_tree_set_node_value(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value in cache entry: %d.",
+		 "%s: unable to set cache value of node at offset: %" PRIi64 ".",
 		 function,
-		 cache_entry_index );
+		 node_data_offset );
 
 		return( -1 );
 	}
@@ -2851,6 +2851,7 @@ int libfdata_tree_node_get_number_of_leaf_nodes(
 }
 
 /* Retrieves a specific leaf node
+ * The sub node containing the leaf node is determined using a binary search
  * Returns 1 if successful or -1 on error
  */
 int libfdata_tree_node_get_leaf_node_by_index(
@@ -2867,10 +2868,12 @@ int libfdata_tree_node_get_leaf_node_by_index(
 	static char *function                             = "libfdata_tree_node_get_leaf_node_by_index";
 	int first_deleted_leaf_node_index                 = 0;
 	int first_leaf_node_index                         = 0;
+	int lower_sub_node_index                          = 0;
 	int number_of_leaf_nodes                          = 0;
 	int number_of_sub_nodes                           = 0;
 	int result                                        = 0;
 	int sub_node_index                                = 0;
+	int upper_sub_node_index                          = 0;
 
 	if( node == NULL )
 	{
@@ -2930,10 +2933,19 @@ int libfdata_tree_node_get_leaf_node_by_index(
 
 		return( -1 );
 	}
-	for( sub_node_index = 0;
-	     sub_node_index < number_of_sub_nodes;
-	     sub_node_index++ )
+	/* The first leaf node index of a sub node contains the cumulative number
+	 * of leaf nodes of the preceding sub nodes. The sub node that contains
+	 * the leaf node is the last sub node with a first leaf node index
+	 * that is less than or equal to the leaf node index.
+	 */
+	lower_sub_node_index = 0;
+	upper_sub_node_index = number_of_sub_nodes;
+
+	while( lower_sub_node_index < upper_sub_node_index )
 	{
+		sub_node_index = lower_sub_node_index
+		               + ( ( upper_sub_node_index - lower_sub_node_index ) / 2 );
+
 		if( libfdata_array_get_entry_by_index(
 		     internal_tree_node->sub_nodes,
 		     sub_node_index,
@@ -2950,49 +2962,124 @@ int libfdata_tree_node_get_leaf_node_by_index(
 
 			return( -1 );
 		}
-		if( libfdata_tree_node_get_number_of_leaf_nodes(
+		if( libfdata_tree_node_get_first_leaf_node_index(
 		     sub_node,
-		     file_io_handle,
-		     cache,
-		     &number_of_leaf_nodes,
-		     read_flags,
+		     &first_leaf_node_index,
+		     &first_deleted_leaf_node_index,
 		     error ) != 1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of leaf nodes from sub node: %d.",
+			 "%s: unable to retrieve first leaf node index from sub node: %d.",
 			 function,
 			 sub_node_index );
 
 			return( -1 );
 		}
-		if( libfdata_tree_node_get_first_leaf_node_index(
-		     sub_node,
-		     &first_leaf_node_index,
-		     &first_deleted_leaf_node_index,
-		     error ) != 1 )
+		if( first_leaf_node_index <= leaf_node_index )
+		{
+			lower_sub_node_index = sub_node_index + 1;
+		}
+		else
+		{
+			upper_sub_node_index = sub_node_index;
+		}
+	}
+	if( ( leaf_node_index < 0 )
+	 || ( lower_sub_node_index == 0 ) )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sub_node_index = lower_sub_node_index - 1;
+
+	if( libfdata_array_get_entry_by_index(
+	     internal_tree_node->sub_nodes,
+	     sub_node_index,
+	     (intptr_t **) &sub_node,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d from sub nodes array.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	if( libfdata_tree_node_get_number_of_leaf_nodes(
+	     sub_node,
+	     file_io_handle,
+	     cache,
+	     &number_of_leaf_nodes,
+	     read_flags,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf nodes from sub node: %d.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	if( libfdata_tree_node_get_first_leaf_node_index(
+	     sub_node,
+	     &first_leaf_node_index,
+	     &first_deleted_leaf_node_index,
+	     error ) != 1 )
+	{
+		liberror_error_set(
+		 error,
+		 LIBERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf node index from sub node: %d.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	result = 0;
+
+	if( number_of_leaf_nodes == 0 )
+	{
+		/* It is possible to have branch nodes without leaf nodes
+		 */
+		result = libfdata_tree_node_is_leaf(
+			  sub_node,
+			  file_io_handle,
+			  cache,
+			  read_flags,
+			  error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve first leaf node index from sub node: %d.",
+			 "%s: unable to determine if sub node: %d is a leaf.",
 			 function,
 			 sub_node_index );
 
 			return( -1 );
 		}
-		if( number_of_leaf_nodes == 0 )
+		else if( result != 0 )
 		{
-			/* It is possible to have branch nodes without leaf nodes
-			 */
-			result = libfdata_tree_node_is_leaf(
+			result = libfdata_tree_node_is_deleted(
 				  sub_node,
-				  file_io_handle,
-				  cache,
-				  read_flags,
 				  error );
 
 			if( result == -1 )
@@ -3001,70 +3088,52 @@ int libfdata_tree_node_get_leaf_node_by_index(
 				 error,
 				 LIBERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine if sub node: %d is a leaf.",
+				 "%s: unable to determine if sub node: %d is deleted.",
 				 function,
 				 sub_node_index );
 
 				return( -1 );
 			}
-			else if( result != 0 )
+			else if( ( result == 0 )
+			      && ( leaf_node_index == first_leaf_node_index ) )
 			{
-				result = libfdata_tree_node_is_deleted(
-					  sub_node,
-					  error );
-
-				if( result == -1 )
-				{
-					liberror_error_set(
-					 error,
-					 LIBERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine if sub node: %d is deleted.",
-					 function,
-					 sub_node_index );
-
-					return( -1 );
-				}
-				else if( result == 0 )
-				{
-					if( leaf_node_index == first_leaf_node_index )
-					{
-						*leaf_node = sub_node;
+				*leaf_node = sub_node;
 
-						break;
-					}
-				}
+				result = 1;
+			}
+			else
+			{
+				result = 0;
 			}
 		}
-		else if( ( leaf_node_index >= first_leaf_node_index )
-		      && ( leaf_node_index < ( first_leaf_node_index + number_of_leaf_nodes ) ) )
+	}
+	else if( leaf_node_index < ( first_leaf_node_index + number_of_leaf_nodes ) )
+	{
+		/* Note that the first_leaf_node_index is relative for a branch
+		 */
+		if( libfdata_tree_node_get_leaf_node_by_index(
+		     sub_node,
+		     file_io_handle,
+		     cache,
+		     leaf_node_index - first_leaf_node_index,
+		     leaf_node,
+		     read_flags,
+		     error ) != 1 )
 		{
-			/* Note that the first_leaf_node_index is relative for a branch
-			 */
-			if( libfdata_tree_node_get_leaf_node_by_index(
-			     sub_node,
-			     file_io_handle,
-			     cache,
-			     leaf_node_index - first_leaf_node_index,
-			     leaf_node,
-			     read_flags,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve leaf node: %d from sub node: %d.",
-				 function,
-				 leaf_node_index - first_leaf_node_index,
-				 sub_node_index );
+			liberror_error_set(
+			 error,
+			 LIBERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf node: %d from sub node: %d.",
+			 function,
+			 leaf_node_index - first_leaf_node_index,
+			 sub_node_index );
 
-				return( -1 );
-			}
-			break;
+			return( -1 );
 		}
+		result = 1;
 	}
-	if( sub_node_index >= number_of_sub_nodes )
+	if( result == 0 )
 	{
 		liberror_error_set(
 		 error,
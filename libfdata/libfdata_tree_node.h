@@ -40,12 +40,6 @@
 extern "C" {
 #endif
 
-#define libfdata_tree_node_calculate_branch_node_cache_entry_index( node_data_offset, number_of_cache_entries ) \
-	( number_of_cache_entries > 4 ) ? ( node_data_offset % ( number_of_cache_entries / 4 ) ) : ( node_data_offset % number_of_cache_entries )
-
-#define libfdata_tree_node_calculate_leaf_node_cache_entry_index( node_data_offset, number_of_cache_entries ) \
-	( number_of_cache_entries > 4 ) ? ( number_of_cache_entries / 4 ) + ( node_data_offset % ( ( number_of_cache_entries * 3 ) / 4 ) ) : ( node_data_offset % number_of_cache_entries )
-
 typedef struct libfdata_internal_tree_node libfdata_internal_tree_node_t;
 
 struct libfdata_internal_tree_node
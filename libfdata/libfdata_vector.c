@@ -35,9 +35,6 @@
 #include "libfdata_types.h"
 #include "libfdata_vector.h"
 
-#define libfdata_vector_calculate_cache_entry_index( element_index, number_of_cache_entries ) \
-	element_index % number_of_cache_entries
-
 /* Initializes the vector
  *
  * If the flag LIBFDATA_FLAG_IO_HANDLE_MANAGED is set the vector
@@ -608,11 +605,7 @@ int libfdata_vector_get_element_value_by_index(
 	libfdata_internal_vector_t *internal_vector = NULL;
 	libfdata_range_t *segment_data_range        = NULL;
 	static char *function                       = "libfdata_vector_get_element_value_by_index";
-	off64_t cache_value_offset                  = (off64_t) -1;
 	off64_t element_data_offset                 = 0;
-	time_t cache_value_timestamp                = 0;
-	int cache_entry_index                       = -1;
-	int number_of_cache_entries                 = 0;
 	int number_of_segments                      = 0;
 	int result                                  = 0;
 	int segment_index                           = 0;
@@ -754,96 +747,45 @@ int libfdata_vector_get_element_value_by_index(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
-	     cache,
-	     &number_of_cache_entries,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_cache_entries <= 0 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( ( read_flags & LIBFDATA_READ_FLAG_IGNORE_CACHE ) == 0 )
 	{
-		cache_entry_index = libfdata_vector_calculate_cache_entry_index(
-		                     element_index,
-		                     number_of_cache_entries );
-
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
-		     error ) != 1 )
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          element_data_offset,
+		          internal_vector->timestamp,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
+			 "%s: unable to retrieve cache value of element: %d.",
 			 function,
-			 cache_entry_index );
+			 element_index );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( ( element_data_offset == cache_value_offset )
-		 && ( internal_vector->timestamp == cache_value_timestamp ) )
-		{
-			result = 1;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libnotify_verbose != 0 )
 		{
 			if( result == 0 )
 			{
 				libnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " miss (%d out of %d)\n",
+				 "%s: cache: 0x%08" PRIjx " miss for element: %d\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index,
-				 number_of_cache_entries );
+				 element_index );
 			}
 			else
 			{
 				libnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " hit (%d out of %d)\n",
+				 "%s: cache: 0x%08" PRIjx " hit for element: %d\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index,
-				 number_of_cache_entries );
+				 element_index );
 			}
 		}
 #endif
@@ -884,46 +826,26 @@ int libfdata_vector_get_element_value_by_index(
 
 			return( -1 );
 		}
-		cache_entry_index = libfdata_vector_calculate_cache_entry_index(
-		                     element_index,
-		                     number_of_cache_entries );
-
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
-		     error ) != 1 )
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          element_data_offset,
+		          internal_vector->timestamp,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
 		{
 			liberror_error_set(
 			 error,
 			 LIBERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
+			 "%s: unable to retrieve cache value of element: %d.",
 			 function,
-			 cache_entry_index );
+			 element_index );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				liberror_error_set(
-				 error,
-				 LIBERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( ( element_data_offset != cache_value_offset )
-		 || ( internal_vector->timestamp != cache_value_timestamp ) )
+		else if( result == 0 )
 		{
 			liberror_error_set(
 			 error,
@@ -1030,8 +952,6 @@ int libfdata_vector_set_element_value_by_index(
 	libfdata_range_t *segment_data_range        = NULL;
 	static char *function                       = "libfdata_vector_set_element_value_by_index";
 	off64_t element_data_offset                 = 0;
-	int cache_entry_index                       = -1;
-	int number_of_cache_entries                 = 0;
 	int number_of_segments                      = 0;
 	int segment_index                           = 0;
 
@@ -1172,39 +1092,9 @@ int libfdata_vector_set_element_value_by_index(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
+	if( libfcache_cache_set_value_by_identifier(
 	     cache,
-	     &number_of_cache_entries,
-	     error ) != 1 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_cache_entries <= 0 )
-	{
-		liberror_error_set(
-		 error,
-		 LIBERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	cache_entry_index = libfdata_vector_calculate_cache_entry_index(
-	                     element_index,
-	                     number_of_cache_entries );
-
-	if( libfcache_cache_set_value_by_index(
-	     cache,
-	     cache_entry_index,
-	     (int64_t) element_data_offset,
+	     element_data_offset,
 	     internal_vector->timestamp,
 	     element_value,
 	     free_element_value,
@@ -1215,9 +1105,9 @@ int libfdata_vector_set_element_value_by_index(
 		 error,
 		 LIBERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value in cache entry: %d.",
+		 "%s: unable to set cache value of element: %d.",
 		 function,
-		 cache_entry_index );
+		 element_index );
 
 		return( -1 );
 	}
@@ -57,6 +57,16 @@ AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
     libbfio_handle_read,
     [ac_cv_libbfio_dummy=yes],
     [ac_cv_libbfio=no])
+   AC_CHECK_LIB(
+    bfio,
+    libbfio_handle_read_at,
+    [ac_cv_libbfio_dummy=yes],
+    [ac_cv_libbfio=no])
+   AC_CHECK_LIB(
+    bfio,
+    libbfio_handle_supports_concurrent_reads,
+    [ac_cv_libbfio_dummy=yes],
+    [ac_cv_libbfio=no])
    AC_CHECK_LIB(
     bfio,
     libbfio_handle_write,
@@ -253,11 +263,20 @@ AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
 dnl Function to detect if libbfio dependencies are available
 AC_DEFUN([AX_LIBBFIO_CHECK_LOCAL],
  [dnl Headers included in libbfio/libbfio_file.c
- AC_CHECK_HEADERS([errno.h fcntl.h sys/stat.h unistd.h])
+ AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
 
  dnl File input/output functions used in libbfio/libbfio_file.h
  AC_CHECK_FUNCS([close fstat ftruncate getcwd lseek open read stat write])
 
+ dnl Memory mapped file functions used in libbfio/libbfio_file.h
+ AC_CHECK_FUNCS([mmap munmap])
+
+ dnl Positional read function used in libbfio/libbfio_file.h
+ AC_CHECK_FUNCS([pread])
+
+ dnl Read ahead hint function used in libbfio/libbfio_file.h
+ AC_CHECK_FUNCS([posix_fadvise])
+
  AS_IF(
   [test "x$ac_cv_func_close" != xyes],
   [AC_MSG_FAILURE(
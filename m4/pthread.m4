@@ -0,0 +1,46 @@
+dnl Functions for pthread
+dnl
+dnl Version: 20120116
+
+dnl Function to detect if pthread is available
+AC_DEFUN([AX_PTHREAD_CHECK_LIB],
+ [dnl Check for headers
+ AC_CHECK_HEADERS([pthread.h])
+
+ AS_IF(
+  [test "x$ac_cv_header_pthread_h" = xno],
+  [ac_cv_pthread=no],
+  [dnl Check for the thread functions
+  AC_CHECK_LIB(
+   pthread,
+   pthread_create,
+   [ac_cv_pthread=yes],
+   [ac_cv_pthread=no])
+  ])
+
+ AS_IF(
+  [test "x$ac_cv_pthread" = xyes],
+  [AC_DEFINE(
+   [HAVE_PTHREAD],
+   [1],
+   [Define to 1 if you have the 'pthread' library (-lpthread).])
+  AC_SUBST(
+   [PTHREAD_LIBADD],
+   [-lpthread])
+  ])
+ ])
+
+dnl Function to detect if multi-threading support should be enabled
+AC_DEFUN([AX_PTHREAD_CHECK_ENABLE],
+ [AX_COMMON_ARG_ENABLE(
+  [multi-threading-support],
+  [multi_threading_support],
+  [enable multi-threading support],
+  [yes])
+
+ AS_IF(
+  [test "x$ac_cv_enable_multi_threading_support" != xno],
+  [AX_PTHREAD_CHECK_LIB],
+  [ac_cv_pthread=no])
+ ])
+